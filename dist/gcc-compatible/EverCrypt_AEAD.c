@@ -24,6 +24,12 @@
 
 #include "EverCrypt_AEAD.h"
 
+#include "Hacl_AES_GCM_NI.h"
+#include "Lib_Memzero0.h"
+#if EVERCRYPT_CAN_COMPILE_VAES
+#include "Hacl_AES_GCM_NI_Vec256.h"
+#endif
+
 typedef struct EverCrypt_AEAD_state_s_s
 {
   Spec_Cipher_Expansion_impl impl;
@@ -97,11 +103,12 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   #if EVERCRYPT_CAN_COMPILE_VALE
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)480U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)992U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)176U;
     uint64_t scrut = aes128_key_expansion(k, keys_b);
     uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+    Hacl_AES_GCM_NI_gcm_precomp(ek + (uint32_t)480U, (uint32_t)10U, keys_b);
     KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
     EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
     p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek });
@@ -123,11 +130,12 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   #if EVERCRYPT_CAN_COMPILE_VALE
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)544U, sizeof (uint8_t));
+    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)1056U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
     uint8_t *hkeys_b = ek + (uint32_t)240U;
     uint64_t scrut = aes256_key_expansion(k, keys_b);
     uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+    Hacl_AES_GCM_NI_gcm_precomp(ek + (uint32_t)544U, (uint32_t)14U, keys_b);
     KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
     EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
     p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek });
@@ -1547,6 +1555,796 @@ EverCrypt_AEAD_decrypt_expand(
   }
 }
 
+/*
+  Scatter/gather support. Both constructions are driven by the same two pieces
+  of state: a MAC that absorbs an arbitrarily segmented stream (buffering at
+  most one 16-byte block across segment boundaries), and a keystream that
+  carries the unused part of its last window over to the next segment. The
+  bulk of every segment is processed in place by the same kernels as the
+  contiguous API; only the tails go through the window.
+*/
+typedef struct iov_mac_s
+{
+  Spec_Cipher_Expansion_impl impl;
+  uint32_t vec;
+  union {
+    uint64_t case_poly32[25U];
+    #if EVERCRYPT_CAN_COMPILE_VEC128
+    Lib_IntVector_Intrinsics_vec128 case_poly128[25U];
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VEC256
+    Lib_IntVector_Intrinsics_vec256 case_poly256[25U];
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VEC512
+    Lib_IntVector_Intrinsics_vec512 case_poly512[30U];
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VALE
+    Lib_IntVector_Intrinsics_vec128 case_ghash[33U];
+    #endif
+  }
+  ctx;
+  uint8_t blk[16U];
+  uint32_t blk_len;
+}
+iov_mac;
+
+typedef struct iov_ctr_s
+{
+  Spec_Cipher_Expansion_impl impl;
+  uint32_t vec;
+  uint8_t *key;
+  uint8_t *iv;
+  uint32_t ctr;
+  uint8_t ks[1024U];
+  uint32_t ks_pos;
+}
+iov_ctr;
+
+static uint32_t chacha20_poly1305_vec()
+{
+  bool vec512 = EverCrypt_AutoConfig2_has_vec512();
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if EVERCRYPT_CAN_COMPILE_VEC512
+  if (vec512)
+  {
+    return (uint32_t)512U;
+  }
+  #endif
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    return (uint32_t)256U;
+  }
+  #endif
+  #if EVERCRYPT_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    return (uint32_t)128U;
+  }
+  #endif
+  return (uint32_t)32U;
+}
+
+static uint32_t iov_nr(Spec_Cipher_Expansion_impl impl)
+{
+  if (impl == Spec_Cipher_Expansion_Vale_AES128)
+  {
+    return (uint32_t)10U;
+  }
+  return (uint32_t)14U;
+}
+
+/* The GHASH table follows the Vale key schedule, hash keys and scratch space. */
+static uint8_t *iov_table(Spec_Cipher_Expansion_impl impl, uint8_t *ek)
+{
+  if (impl == Spec_Cipher_Expansion_Vale_AES128)
+  {
+    return ek + (uint32_t)480U;
+  }
+  return ek + (uint32_t)544U;
+}
+
+static void iov_mac_update_blocks(iov_mac *m, uint32_t len, uint8_t *text)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  if (m->impl != Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    #if EVERCRYPT_CAN_COMPILE_VAES
+    if (m->vec == (uint32_t)256U)
+    {
+      Hacl_AES_GCM_NI_Vec256_gcm_update_blocks(m->ctx.case_ghash, len, text);
+      return;
+    }
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VALE
+    Hacl_AES_GCM_NI_gcm_update_blocks(m->ctx.case_ghash, len, text);
+    #endif
+    return;
+  }
+  switch (m->vec)
+  {
+    #if EVERCRYPT_CAN_COMPILE_VEC512
+    case 512U:
+      {
+        Hacl_Poly1305_512_poly1305_update(m->ctx.case_poly512, len, text);
+        break;
+      }
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VEC256
+    case 256U:
+      {
+        Hacl_Poly1305_256_poly1305_update(m->ctx.case_poly256, len, text);
+        break;
+      }
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VEC128
+    case 128U:
+      {
+        Hacl_Poly1305_128_poly1305_update(m->ctx.case_poly128, len, text);
+        break;
+      }
+    #endif
+    default:
+      {
+        Hacl_Poly1305_32_poly1305_update(m->ctx.case_poly32, len, text);
+      }
+  }
+}
+
+static void iov_mac_absorb(iov_mac *m, uint32_t len, uint8_t *text)
+{
+  uint32_t len0 = len;
+  uint8_t *text0 = text;
+  if (m->blk_len > (uint32_t)0U)
+  {
+    uint32_t n = (uint32_t)16U - m->blk_len;
+    if (len0 < n)
+    {
+      n = len0;
+    }
+    memcpy(m->blk + m->blk_len, text0, n * sizeof (uint8_t));
+    m->blk_len = m->blk_len + n;
+    len0 = len0 - n;
+    text0 = text0 + n;
+    if (m->blk_len < (uint32_t)16U)
+    {
+      return;
+    }
+    iov_mac_update_blocks(m, (uint32_t)16U, m->blk);
+    m->blk_len = (uint32_t)0U;
+  }
+  uint32_t len16 = len0 / (uint32_t)16U * (uint32_t)16U;
+  iov_mac_update_blocks(m, len16, text0);
+  memcpy(m->blk, text0 + len16, (len0 - len16) * sizeof (uint8_t));
+  m->blk_len = len0 - len16;
+}
+
+static void iov_mac_absorb_iov(iov_mac *m, EverCrypt_AEAD_iovec *v, uint32_t n)
+{
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    iov_mac_absorb(m, v[i].len, v[i].base);
+  }
+}
+
+/* Both constructions zero-pad the AAD and the ciphertext to a block boundary. */
+static void iov_mac_pad(iov_mac *m)
+{
+  if (m->blk_len > (uint32_t)0U)
+  {
+    memset(m->blk + m->blk_len, 0U, ((uint32_t)16U - m->blk_len) * sizeof (uint8_t));
+    iov_mac_update_blocks(m, (uint32_t)16U, m->blk);
+    m->blk_len = (uint32_t)0U;
+  }
+}
+
+static void iov_ctr_blocks(iov_ctr *c, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  if (c->impl != Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    #if EVERCRYPT_CAN_COMPILE_VAES
+    if (c->vec == (uint32_t)256U)
+    {
+      Hacl_AES_GCM_NI_Vec256_aes_ctr32(len, out, in, iov_nr(c->impl), c->key, c->iv, c->ctr);
+      c->ctr = c->ctr + len / (uint32_t)16U;
+      return;
+    }
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VALE
+    Hacl_AES_GCM_NI_aes_ctr32(len, out, in, iov_nr(c->impl), c->key, c->iv, c->ctr);
+    c->ctr = c->ctr + len / (uint32_t)16U;
+    #endif
+    return;
+  }
+  switch (c->vec)
+  {
+    #if EVERCRYPT_CAN_COMPILE_VEC512
+    case 512U:
+      {
+        Hacl_Chacha20_Vec512_chacha20_encrypt_512(len, out, in, c->key, c->iv, c->ctr);
+        break;
+      }
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VEC256
+    case 256U:
+      {
+        Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, out, in, c->key, c->iv, c->ctr);
+        break;
+      }
+    #endif
+    #if EVERCRYPT_CAN_COMPILE_VEC128
+    case 128U:
+      {
+        Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, out, in, c->key, c->iv, c->ctr);
+        break;
+      }
+    #endif
+    default:
+      {
+        Hacl_Chacha20_chacha20_encrypt(len, out, in, c->key, c->iv, c->ctr);
+      }
+  }
+  c->ctr = c->ctr + len / (uint32_t)64U;
+}
+
+/*
+  The keystream window: one AES block, or one batch of the ChaCha20 kernel in
+  use (1, 4, 8 or 16 blocks), which is the granularity at which the kernel
+  works anyway, since it pads a shorter input to a full batch.
+*/
+static uint32_t iov_ctr_block_len(iov_ctr *c)
+{
+  if (c->impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    return (uint32_t)2U * c->vec;
+  }
+  return (uint32_t)16U;
+}
+
+static void iov_ctr_next(iov_ctr *c)
+{
+  uint32_t bs = iov_ctr_block_len(c);
+  memset(c->ks, 0U, bs * sizeof (uint8_t));
+  iov_ctr_blocks(c, bs, c->ks, c->ks);
+  c->ks_pos = (uint32_t)0U;
+}
+
+static void iov_ctr_take(iov_ctr *c, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  uint8_t *ks = c->ks + c->ks_pos;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    out[i] = in[i] ^ ks[i];
+  }
+  c->ks_pos = c->ks_pos + len;
+}
+
+/*
+  Since the AAD is padded, the MAC input and the keystream both start on a
+  block boundary, and whenever the keystream is at a block boundary so is the
+  MAC buffer; the bulk of each chunk can thus go to the fused AES-GCM kernel.
+*/
+static void iov_ctr_xor(iov_ctr *c, iov_mac *m, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  uint32_t bs = iov_ctr_block_len(c);
+  uint32_t i = bs - c->ks_pos;
+  if (len < i)
+  {
+    i = len;
+  }
+  iov_ctr_take(c, i, out, in);
+  uint32_t full = (len - i) / bs * bs;
+  if (m == NULL)
+  {
+    iov_ctr_blocks(c, full, out + i, in + i);
+  }
+  else
+  {
+    iov_mac_absorb(m, i, out);
+    #if EVERCRYPT_CAN_COMPILE_VALE
+    #if EVERCRYPT_CAN_COMPILE_VAES
+    if (c->impl != Spec_Cipher_Expansion_Hacl_CHACHA20 && c->vec == (uint32_t)256U)
+    {
+      Hacl_AES_GCM_NI_Vec256_gcm_encrypt_blocks(m->ctx.case_ghash,
+        full,
+        out + i,
+        in + i,
+        iov_nr(c->impl),
+        c->key,
+        c->iv,
+        c->ctr);
+      c->ctr = c->ctr + full / (uint32_t)16U;
+    }
+    else
+    #endif
+    if (c->impl != Spec_Cipher_Expansion_Hacl_CHACHA20)
+    {
+      Hacl_AES_GCM_NI_gcm_encrypt_blocks(m->ctx.case_ghash,
+        full,
+        out + i,
+        in + i,
+        iov_nr(c->impl),
+        c->key,
+        c->iv,
+        c->ctr);
+      c->ctr = c->ctr + full / (uint32_t)16U;
+    }
+    else
+    {
+      iov_ctr_blocks(c, full, out + i, in + i);
+      iov_mac_absorb(m, full, out + i);
+    }
+    #else
+    iov_ctr_blocks(c, full, out + i, in + i);
+    iov_mac_absorb(m, full, out + i);
+    #endif
+  }
+  i = i + full;
+  if (i < len)
+  {
+    iov_ctr_next(c);
+    iov_ctr_take(c, len - i, out + i, in + i);
+    if (m != NULL)
+    {
+      iov_mac_absorb(m, len - i, out + i);
+    }
+  }
+}
+
+/*
+  Walks the input and output segment lists in lockstep; the two lists may be
+  split at different offsets. When m is not NULL, the output is also fed to the
+  MAC, which is what encryption wants.
+*/
+static void
+iov_ctr_xor_iov(
+  iov_ctr *c,
+  iov_mac *m,
+  EverCrypt_AEAD_iovec *in,
+  uint32_t in_n,
+  EverCrypt_AEAD_iovec *out,
+  uint32_t out_n
+)
+{
+  uint32_t i = (uint32_t)0U;
+  uint32_t j = (uint32_t)0U;
+  uint32_t oi = (uint32_t)0U;
+  uint32_t oj = (uint32_t)0U;
+  while (i < in_n && j < out_n)
+  {
+    uint32_t a = in[i].len - oi;
+    uint32_t b = out[j].len - oj;
+    if (a == (uint32_t)0U)
+    {
+      i++;
+      oi = (uint32_t)0U;
+    }
+    else if (b == (uint32_t)0U)
+    {
+      j++;
+      oj = (uint32_t)0U;
+    }
+    else
+    {
+      uint32_t n = a < b ? a : b;
+      uint8_t *dst = out[j].base + oj;
+      iov_ctr_xor(c, m, n, dst, in[i].base + oi);
+      oi = oi + n;
+      oj = oj + n;
+    }
+  }
+}
+
+static bool iov_total(EverCrypt_AEAD_iovec *v, uint32_t n, uint32_t *len)
+{
+  uint64_t total = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    total = total + (uint64_t)v[i].len;
+  }
+  len[0U] = (uint32_t)total;
+  return total <= (uint64_t)0xffffffffU;
+}
+
+static uint8_t *iov_base(EverCrypt_AEAD_iovec *v, uint32_t n)
+{
+  if (n == (uint32_t)0U)
+  {
+    return NULL;
+  }
+  return v[0U].base;
+}
+
+/* Returns the bytes of v contiguously: in place when there is at most one segment, copied to dst otherwise. */
+static uint8_t *iov_flatten(EverCrypt_AEAD_iovec *v, uint32_t n, uint8_t *dst)
+{
+  if (n <= (uint32_t)1U)
+  {
+    return iov_base(v, n);
+  }
+  uint32_t o = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    memcpy(dst + o, v[i].base, v[i].len * sizeof (uint8_t));
+    o = o + v[i].len;
+  }
+  return dst;
+}
+
+static void iov_scatter(EverCrypt_AEAD_iovec *v, uint32_t n, uint8_t *src)
+{
+  uint32_t o = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    memcpy(v[i].base, src + o, v[i].len * sizeof (uint8_t));
+    o = o + v[i].len;
+  }
+}
+
+/*
+  Without VAES, the segment-wise AES-GCM path runs on the 128-bit kernels,
+  which are slower than the Vale one-shot; a packet-sized message is then
+  handed to EverCrypt_AEAD_encrypt/decrypt instead, with each split segment
+  list gathered on the stack.
+*/
+static bool iov_stages(EverCrypt_AEAD_state_s *s, uint32_t ad_len, uint32_t len)
+{
+  EverCrypt_AEAD_state_s scrut = *s;
+  if (scrut.impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    return false;
+  }
+  #if EVERCRYPT_CAN_COMPILE_VAES
+  if (EverCrypt_AutoConfig2_has_vaes())
+  {
+    return false;
+  }
+  #endif
+  return (uint64_t)ad_len + (uint64_t)len <= (uint64_t)2048U;
+}
+
+/*
+  Sets up the MAC and the keystream for one message and absorbs the AAD. For
+  ChaCha20-Poly1305, the Poly1305 key is the first keystream block; for
+  AES-GCM, the pre-counter block J0 is derived from the IV as in SP 800-38D.
+  Either one ends up in k0 (32 bytes), which iov_finish consumes.
+*/
+static EverCrypt_Error_error_code
+iov_init(
+  EverCrypt_AEAD_state_s *s,
+  iov_mac *m,
+  iov_ctr *c,
+  uint8_t *k0,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_iovec *ad,
+  uint32_t ad_n
+)
+{
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  m->impl = impl;
+  m->blk_len = (uint32_t)0U;
+  c->impl = impl;
+  c->key = ek;
+  if (impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    if (iv_len != (uint32_t)12U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    uint32_t vec = chacha20_poly1305_vec();
+    m->vec = vec;
+    c->vec = vec;
+    c->iv = iv;
+    c->ctr = (uint32_t)0U;
+    /* The rest of the window holds the keystream of the message, from counter 1 on. */
+    iov_ctr_next(c);
+    c->ks_pos = (uint32_t)64U;
+    uint8_t *key = c->ks;
+    switch (vec)
+    {
+      #if EVERCRYPT_CAN_COMPILE_VEC512
+      case 512U:
+        {
+          Hacl_Poly1305_512_poly1305_init(m->ctx.case_poly512, key);
+          break;
+        }
+      #endif
+      #if EVERCRYPT_CAN_COMPILE_VEC256
+      case 256U:
+        {
+          Hacl_Poly1305_256_poly1305_init(m->ctx.case_poly256, key);
+          break;
+        }
+      #endif
+      #if EVERCRYPT_CAN_COMPILE_VEC128
+      case 128U:
+        {
+          Hacl_Poly1305_128_poly1305_init(m->ctx.case_poly128, key);
+          break;
+        }
+      #endif
+      default:
+        {
+          Hacl_Poly1305_32_poly1305_init(m->ctx.case_poly32, key);
+        }
+    }
+    memcpy(k0, key, (uint32_t)32U * sizeof (uint8_t));
+  }
+  else
+  {
+    #if EVERCRYPT_CAN_COMPILE_VALE
+    if (iv_len == (uint32_t)0U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    uint32_t vec = (uint32_t)128U;
+    #if EVERCRYPT_CAN_COMPILE_VAES
+    if (EverCrypt_AutoConfig2_has_vaes())
+    {
+      vec = (uint32_t)256U;
+    }
+    #endif
+    m->vec = vec;
+    c->vec = vec;
+    Hacl_AES_GCM_NI_gcm_init(m->ctx.case_ghash, iov_table(impl, ek));
+    if (iv_len == (uint32_t)12U)
+    {
+      memcpy(k0, iv, (uint32_t)12U * sizeof (uint8_t));
+      store32_be(k0 + (uint32_t)12U, (uint32_t)1U);
+    }
+    else
+    {
+      uint8_t len_b[16U] = { 0U };
+      store64_be(len_b + (uint32_t)8U, (uint64_t)iv_len * (uint64_t)8U);
+      iov_mac_absorb(m, iv_len, iv);
+      iov_mac_pad(m);
+      iov_mac_update_blocks(m, (uint32_t)16U, len_b);
+      Hacl_AES_GCM_NI_gcm_emit(k0, m->ctx.case_ghash);
+      m->ctx.case_ghash[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+    }
+    c->iv = k0;
+    c->ctr = (uint32_t)1U;
+    c->ks_pos = (uint32_t)16U;
+    #else
+    return EverCrypt_Error_UnsupportedAlgorithm;
+    #endif
+  }
+  iov_mac_absorb_iov(m, ad, ad_n);
+  iov_mac_pad(m);
+  return EverCrypt_Error_Success;
+}
+
+static void
+iov_finish(iov_mac *m, iov_ctr *c, uint8_t *k0, uint32_t ad_len, uint32_t len, uint8_t *tag)
+{
+  uint8_t len_b[16U] = { 0U };
+  iov_mac_pad(m);
+  if (m->impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    store64_le(len_b, (uint64_t)ad_len);
+    store64_le(len_b + (uint32_t)8U, (uint64_t)len);
+    iov_mac_update_blocks(m, (uint32_t)16U, len_b);
+    switch (m->vec)
+    {
+      #if EVERCRYPT_CAN_COMPILE_VEC512
+      case 512U:
+        {
+          Hacl_Poly1305_512_poly1305_finish(tag, k0, m->ctx.case_poly512);
+          break;
+        }
+      #endif
+      #if EVERCRYPT_CAN_COMPILE_VEC256
+      case 256U:
+        {
+          Hacl_Poly1305_256_poly1305_finish(tag, k0, m->ctx.case_poly256);
+          break;
+        }
+      #endif
+      #if EVERCRYPT_CAN_COMPILE_VEC128
+      case 128U:
+        {
+          Hacl_Poly1305_128_poly1305_finish(tag, k0, m->ctx.case_poly128);
+          break;
+        }
+      #endif
+      default:
+        {
+          Hacl_Poly1305_32_poly1305_finish(tag, k0, m->ctx.case_poly32);
+        }
+    }
+    return;
+  }
+  #if EVERCRYPT_CAN_COMPILE_VALE
+  store64_be(len_b, (uint64_t)ad_len * (uint64_t)8U);
+  store64_be(len_b + (uint32_t)8U, (uint64_t)len * (uint64_t)8U);
+  iov_mac_update_blocks(m, (uint32_t)16U, len_b);
+  Hacl_AES_GCM_NI_gcm_emit(tag, m->ctx.case_ghash);
+  Hacl_AES_GCM_NI_aes_ctr32((uint32_t)16U, tag, tag, iov_nr(m->impl), c->key, k0, (uint32_t)0U);
+  #endif
+}
+
+/* k0 holds the Poly1305 key or J0, c the unused keystream and m the MAC state:
+   none of them may outlive the call. */
+static void iov_wipe(iov_mac *m, iov_ctr *c, uint8_t *k0)
+{
+  Lib_Memzero0_memzero(m, sizeof (iov_mac));
+  Lib_Memzero0_memzero(c, sizeof (iov_ctr));
+  Lib_Memzero0_memzero(k0, (uint32_t)32U);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_iovec *ad,
+  uint32_t ad_n,
+  EverCrypt_AEAD_iovec *plain,
+  uint32_t plain_n,
+  EverCrypt_AEAD_iovec *cipher,
+  uint32_t cipher_n,
+  uint8_t *tag
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  uint32_t ad_len = (uint32_t)0U;
+  uint32_t plain_len = (uint32_t)0U;
+  uint32_t cipher_len = (uint32_t)0U;
+  bool ok0 = iov_total(ad, ad_n, &ad_len);
+  bool ok1 = iov_total(plain, plain_n, &plain_len);
+  bool ok2 = iov_total(cipher, cipher_n, &cipher_len);
+  if (!(ok0 && ok1 && ok2) || plain_len != cipher_len)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  if (ad_n <= (uint32_t)1U && plain_n <= (uint32_t)1U && cipher_n <= (uint32_t)1U)
+  {
+    return
+      EverCrypt_AEAD_encrypt(s,
+        iv,
+        iv_len,
+        iov_base(ad, ad_n),
+        ad_len,
+        iov_base(plain, plain_n),
+        plain_len,
+        iov_base(cipher, cipher_n),
+        tag);
+  }
+  if (iov_stages(s, ad_len, plain_len))
+  {
+    uint8_t stage[4096U];
+    uint8_t *ad_b = iov_flatten(ad, ad_n, stage);
+    uint8_t *in = iov_flatten(plain, plain_n, stage + ad_len);
+    uint8_t *out = stage + (uint32_t)2048U;
+    if (cipher_n <= (uint32_t)1U)
+    {
+      out = iov_base(cipher, cipher_n);
+    }
+    EverCrypt_Error_error_code
+    r = EverCrypt_AEAD_encrypt(s, iv, iv_len, ad_b, ad_len, in, plain_len, out, tag);
+    if (r == EverCrypt_Error_Success && cipher_n > (uint32_t)1U)
+    {
+      iov_scatter(cipher, cipher_n, out);
+    }
+    if (plain_n > (uint32_t)1U)
+    {
+      Lib_Memzero0_memzero(in, plain_len);
+    }
+    return r;
+  }
+  iov_mac m;
+  iov_ctr c;
+  uint8_t k0[32U] = { 0U };
+  EverCrypt_Error_error_code r = iov_init(s, &m, &c, k0, iv, iv_len, ad, ad_n);
+  if (r != EverCrypt_Error_Success)
+  {
+    iov_wipe(&m, &c, k0);
+    return r;
+  }
+  iov_ctr_xor_iov(&c, &m, plain, plain_n, cipher, cipher_n);
+  iov_finish(&m, &c, k0, ad_len, plain_len, tag);
+  iov_wipe(&m, &c, k0);
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_iovec *ad,
+  uint32_t ad_n,
+  EverCrypt_AEAD_iovec *cipher,
+  uint32_t cipher_n,
+  uint8_t *tag,
+  EverCrypt_AEAD_iovec *dst,
+  uint32_t dst_n
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  uint32_t ad_len = (uint32_t)0U;
+  uint32_t cipher_len = (uint32_t)0U;
+  uint32_t dst_len = (uint32_t)0U;
+  bool ok0 = iov_total(ad, ad_n, &ad_len);
+  bool ok1 = iov_total(cipher, cipher_n, &cipher_len);
+  bool ok2 = iov_total(dst, dst_n, &dst_len);
+  if (!(ok0 && ok1 && ok2) || cipher_len != dst_len)
+  {
+    return EverCrypt_Error_DecodeError;
+  }
+  if (ad_n <= (uint32_t)1U && cipher_n <= (uint32_t)1U && dst_n <= (uint32_t)1U)
+  {
+    return
+      EverCrypt_AEAD_decrypt(s,
+        iv,
+        iv_len,
+        iov_base(ad, ad_n),
+        ad_len,
+        iov_base(cipher, cipher_n),
+        cipher_len,
+        tag,
+        iov_base(dst, dst_n));
+  }
+  if (iov_stages(s, ad_len, cipher_len))
+  {
+    uint8_t stage[4096U];
+    uint8_t *ad_b = iov_flatten(ad, ad_n, stage);
+    uint8_t *in = iov_flatten(cipher, cipher_n, stage + ad_len);
+    uint8_t *out = stage + (uint32_t)2048U;
+    EverCrypt_Error_error_code
+    r = EverCrypt_AEAD_decrypt(s, iv, iv_len, ad_b, ad_len, in, cipher_len, tag, out);
+    if (r == EverCrypt_Error_Success)
+    {
+      iov_scatter(dst, dst_n, out);
+    }
+    Lib_Memzero0_memzero(out, cipher_len);
+    return r;
+  }
+  iov_mac m;
+  iov_ctr c;
+  uint8_t k0[32U] = { 0U };
+  EverCrypt_Error_error_code r = iov_init(s, &m, &c, k0, iv, iv_len, ad, ad_n);
+  if (r != EverCrypt_Error_Success)
+  {
+    iov_wipe(&m, &c, k0);
+    return r;
+  }
+  uint8_t computed_tag[16U] = { 0U };
+  iov_mac_absorb_iov(&m, cipher, cipher_n);
+  iov_finish(&m, &c, k0, ad_len, cipher_len, computed_tag);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_tag[i], tag[i]);
+    res = uu____0 & res;
+  }
+  if (res != (uint8_t)255U)
+  {
+    iov_wipe(&m, &c, k0);
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  iov_ctr_xor_iov(&c, NULL, cipher, cipher_n, dst, dst_n);
+  iov_wipe(&m, &c, k0);
+  return EverCrypt_Error_Success;
+}
+
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s)
 {
   EverCrypt_AEAD_state_s scrut = *s;
@@ -46,6 +46,13 @@ extern "C" {
 
 typedef struct EverCrypt_AEAD_state_s_s EverCrypt_AEAD_state_s;
 
+typedef struct EverCrypt_AEAD_iovec_s
+{
+  uint8_t *base;
+  uint32_t len;
+}
+EverCrypt_AEAD_iovec;
+
 bool EverCrypt_AEAD_uu___is_Ek(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s projectee);
 
 Spec_Cipher_Expansion_impl
@@ -191,6 +198,47 @@ EverCrypt_AEAD_decrypt_expand(
   uint8_t *dst
 );
 
+/*
+  Scatter/gather variants of encrypt and decrypt: the AAD, the input and the
+  output are each given as an array of segments, and the computation streams
+  across segment boundaries without staging the data in a contiguous buffer.
+  Input and output may be split at different offsets but must have the same
+  total length, otherwise EverCrypt_Error_DecodeError is returned. Segments may
+  alias in place (an output segment list describing the same bytes as the input
+  one).
+
+  decrypt_iov checks the tag before writing any plaintext, except when every
+  list has at most one segment: that case is forwarded to the contiguous
+  EverCrypt_AEAD_decrypt, whose output must likewise be discarded on failure.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_iovec *ad,
+  uint32_t ad_n,
+  EverCrypt_AEAD_iovec *plain,
+  uint32_t plain_n,
+  EverCrypt_AEAD_iovec *cipher,
+  uint32_t cipher_n,
+  uint8_t *tag
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_iov(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  EverCrypt_AEAD_iovec *ad,
+  uint32_t ad_n,
+  EverCrypt_AEAD_iovec *cipher,
+  uint32_t cipher_n,
+  uint8_t *tag,
+  EverCrypt_AEAD_iovec *dst,
+  uint32_t dst_n
+);
+
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s);
 
 #if defined(__cplusplus)
@@ -46,6 +46,8 @@ static bool cpu_has_rdrand[1U] = { false };
 
 static bool cpu_has_avx512[1U] = { false };
 
+static bool cpu_has_vaes[1U] = { false };
+
 static bool user_wants_hacl[1U] = { true };
 
 static bool user_wants_vale[1U] = { true };
@@ -109,6 +111,11 @@ bool EverCrypt_AutoConfig2_has_avx512()
   return cpu_has_avx512[0U];
 }
 
+bool EverCrypt_AutoConfig2_has_vaes()
+{
+  return cpu_has_vaes[0U];
+}
+
 KRML_DEPRECATED("")
 
 bool EverCrypt_AutoConfig2_wants_vale()
@@ -214,6 +221,11 @@ void EverCrypt_AutoConfig2_init()
       }
     }
   }
+  uint64_t scrut11 = check_vaes();
+  if (scrut11 != (uint64_t)0U && cpu_has_avx2[0U] && cpu_has_aesni[0U] && cpu_has_pclmulqdq[0U])
+  {
+    cpu_has_vaes[0U] = true;
+  }
   #endif
   user_wants_hacl[0U] = true;
   user_wants_vale[0U] = true;
@@ -276,6 +288,11 @@ void EverCrypt_AutoConfig2_disable_avx512()
   cpu_has_avx512[0U] = false;
 }
 
+void EverCrypt_AutoConfig2_disable_vaes()
+{
+  cpu_has_vaes[0U] = false;
+}
+
 void EverCrypt_AutoConfig2_disable_vale()
 {
   user_wants_vale[0U] = false;
@@ -310,3 +327,8 @@ bool EverCrypt_AutoConfig2_has_vec256()
   return avx2 || other;
 }
 
+bool EverCrypt_AutoConfig2_has_vec512()
+{
+  return EverCrypt_AutoConfig2_has_avx512();
+}
+
@@ -61,6 +61,8 @@ bool EverCrypt_AutoConfig2_has_rdrand();
 
 bool EverCrypt_AutoConfig2_has_avx512();
 
+bool EverCrypt_AutoConfig2_has_vaes();
+
 KRML_DEPRECATED("")
 
 bool EverCrypt_AutoConfig2_wants_vale();
@@ -99,6 +101,8 @@ void EverCrypt_AutoConfig2_disable_rdrand();
 
 void EverCrypt_AutoConfig2_disable_avx512();
 
+void EverCrypt_AutoConfig2_disable_vaes();
+
 void EverCrypt_AutoConfig2_disable_vale();
 
 void EverCrypt_AutoConfig2_disable_hacl();
@@ -111,6 +115,8 @@ bool EverCrypt_AutoConfig2_has_vec128();
 
 bool EverCrypt_AutoConfig2_has_vec256();
 
+bool EverCrypt_AutoConfig2_has_vec512();
+
 #if defined(__cplusplus)
 }
 #endif
@@ -38,8 +38,16 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
 {
   bool avx2 = EverCrypt_AutoConfig2_has_avx2();
   bool avx = EverCrypt_AutoConfig2_has_avx();
+  bool vec512 = EverCrypt_AutoConfig2_has_vec512();
   bool vec256 = EverCrypt_AutoConfig2_has_vec256();
   bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if EVERCRYPT_CAN_COMPILE_VEC512
+  if (vec512)
+  {
+    Hacl_Chacha20Poly1305_512_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    return;
+  }
+  #endif
   #if EVERCRYPT_CAN_COMPILE_VEC256
   if (vec256)
   {
@@ -71,8 +79,15 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
 {
   bool avx2 = EverCrypt_AutoConfig2_has_avx2();
   bool avx = EverCrypt_AutoConfig2_has_avx();
+  bool vec512 = EverCrypt_AutoConfig2_has_vec512();
   bool vec256 = EverCrypt_AutoConfig2_has_vec256();
   bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if EVERCRYPT_CAN_COMPILE_VEC512
+  if (vec512)
+  {
+    return Hacl_Chacha20Poly1305_512_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  }
+  #endif
   #if EVERCRYPT_CAN_COMPILE_VEC256
   if (vec256)
   {
@@ -41,6 +41,7 @@ extern "C" {
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_32.h"
 #include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Chacha20Poly1305_512.h"
 
 void
 EverCrypt_Chacha20Poly1305_aead_encrypt(
@@ -33,14 +33,8 @@ static inline bool has_adx_bmi2()
 
 void EverCrypt_Curve25519_secret_to_public(uint8_t *pub, uint8_t *priv)
 {
-  #if EVERCRYPT_CAN_COMPILE_VALE
-  if (has_adx_bmi2())
-  {
-    Hacl_Curve25519_64_secret_to_public(pub, priv);
-    return;
-  }
-  #endif
-  Hacl_Curve25519_51_secret_to_public(pub, priv);
+  /* The fixed-base comb beats the ladder even when the latter runs on Vale. */
+  Hacl_Ed25519_x25519_secret_to_public(pub, priv);
 }
 
 void EverCrypt_Curve25519_scalarmult(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub)
@@ -66,3 +60,28 @@ bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their
   return Hacl_Curve25519_51_ecdh(shared, my_priv, their_pub);
 }
 
+void
+EverCrypt_Curve25519_scalarmult_batch(
+  uint8_t *shared,
+  uint8_t *my_priv,
+  uint8_t *their_pub,
+  uint32_t n
+)
+{
+  uint32_t done = (uint32_t)0U;
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_avx2())
+  {
+    /* Only whole groups of four: a partial group costs as much as a full one,
+       which loses to the scalar code for the remainder. */
+    done = n / (uint32_t)4U * (uint32_t)4U;
+    Hacl_Curve25519_Vec256_scalarmult_batch(shared, my_priv, their_pub, done);
+  }
+  #endif
+  for (uint32_t i = done; i < n; i++)
+  {
+    EverCrypt_Curve25519_scalarmult(shared + i * (uint32_t)32U,
+      my_priv + i * (uint32_t)32U,
+      their_pub + i * (uint32_t)32U);
+  }
+}
@@ -40,6 +40,8 @@ extern "C" {
 #include "EverCrypt_AutoConfig2.h"
 #include "Hacl_Curve25519_64.h"
 #include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_Vec256.h"
+#include "Hacl_Ed25519.h"
 
 void EverCrypt_Curve25519_secret_to_public(uint8_t *pub, uint8_t *priv);
 
@@ -47,6 +49,19 @@ void EverCrypt_Curve25519_scalarmult(uint8_t *shared, uint8_t *my_priv, uint8_t
 
 bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub);
 
+/*
+  n independent scalar multiplications over contiguous 32-byte arrays:
+  shared + 32 * i receives X25519(my_priv + 32 * i, their_pub + 32 * i). Uses the
+  4-way AVX2 implementation for whole groups of four when available.
+*/
+void
+EverCrypt_Curve25519_scalarmult_batch(
+  uint8_t *shared,
+  uint8_t *my_priv,
+  uint8_t *their_pub,
+  uint32_t n
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1128,17 +1128,20 @@ EverCrypt_DRBG_generate_sha1(
     uint8_t *output1 = output;
     uint32_t max = n / (uint32_t)20U;
     uint8_t *out = output1;
+    EverCrypt_HMAC_ctx_s hctx;
+    EverCrypt_HMAC_key_init_into(&hctx, Spec_Hash_Definitions_SHA1, k, (uint32_t)20U);
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha1(v, k, (uint32_t)20U, v, (uint32_t)20U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)20U);
       memcpy(out + i * (uint32_t)20U, v, (uint32_t)20U * sizeof (uint8_t));
     }
     if (max * (uint32_t)20U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)20U;
-      EverCrypt_HMAC_compute_sha1(v, k, (uint32_t)20U, v, (uint32_t)20U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)20U);
       memcpy(block, v, (n - max * (uint32_t)20U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hctx, sizeof (hctx));
     uint32_t input_len = (uint32_t)21U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1349,17 +1352,20 @@ EverCrypt_DRBG_generate_sha2_256(
     uint8_t *output1 = output;
     uint32_t max = n / (uint32_t)32U;
     uint8_t *out = output1;
+    EverCrypt_HMAC_ctx_s hctx;
+    EverCrypt_HMAC_key_init_into(&hctx, Spec_Hash_Definitions_SHA2_256, k, (uint32_t)32U);
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)32U);
       memcpy(out + i * (uint32_t)32U, v, (uint32_t)32U * sizeof (uint8_t));
     }
     if (max * (uint32_t)32U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)32U;
-      EverCrypt_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)32U);
       memcpy(block, v, (n - max * (uint32_t)32U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hctx, sizeof (hctx));
     uint32_t input_len = (uint32_t)33U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1570,17 +1576,20 @@ EverCrypt_DRBG_generate_sha2_384(
     uint8_t *output1 = output;
     uint32_t max = n / (uint32_t)48U;
     uint8_t *out = output1;
+    EverCrypt_HMAC_ctx_s hctx;
+    EverCrypt_HMAC_key_init_into(&hctx, Spec_Hash_Definitions_SHA2_384, k, (uint32_t)48U);
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)48U);
       memcpy(out + i * (uint32_t)48U, v, (uint32_t)48U * sizeof (uint8_t));
     }
     if (max * (uint32_t)48U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)48U;
-      EverCrypt_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)48U);
       memcpy(block, v, (n - max * (uint32_t)48U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hctx, sizeof (hctx));
     uint32_t input_len = (uint32_t)49U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1791,17 +1800,20 @@ EverCrypt_DRBG_generate_sha2_512(
     uint8_t *output1 = output;
     uint32_t max = n / (uint32_t)64U;
     uint8_t *out = output1;
+    EverCrypt_HMAC_ctx_s hctx;
+    EverCrypt_HMAC_key_init_into(&hctx, Spec_Hash_Definitions_SHA2_512, k, (uint32_t)64U);
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)64U);
       memcpy(out + i * (uint32_t)64U, v, (uint32_t)64U * sizeof (uint8_t));
     }
     if (max * (uint32_t)64U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)64U;
-      EverCrypt_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
+      EverCrypt_HMAC_compute_with_ctx(&hctx, v, v, (uint32_t)64U);
       memcpy(block, v, (n - max * (uint32_t)64U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hctx, sizeof (hctx));
     uint32_t input_len = (uint32_t)65U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -43,6 +43,16 @@ void EverCrypt_Ed25519_sign(uint8_t *signature, uint8_t *secret, uint32_t len, u
 
 bool EverCrypt_Ed25519_verify(uint8_t *pubkey, uint32_t len, uint8_t *msg, uint8_t *signature);
 
+bool
+EverCrypt_Ed25519_verify_batch(
+  uint32_t len,
+  uint8_t **pubkeys,
+  uint32_t *msg_lens,
+  uint8_t **msgs,
+  uint8_t **signatures,
+  bool *results
+);
+
 void EverCrypt_Ed25519_secret_to_public(uint8_t *output, uint8_t *secret);
 
 void EverCrypt_Ed25519_expand_keys(uint8_t *ks, uint8_t *secret);
@@ -44,16 +44,18 @@ EverCrypt_HKDF_expand_sha1(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, Spec_Hash_Definitions_SHA1, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -62,15 +64,16 @@ EverCrypt_HKDF_expand_sha1(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&ctx, sizeof (ctx));
 }
 
 void
@@ -105,16 +108,18 @@ EverCrypt_HKDF_expand_sha2_256(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, Spec_Hash_Definitions_SHA2_256, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -123,15 +128,16 @@ EverCrypt_HKDF_expand_sha2_256(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&ctx, sizeof (ctx));
 }
 
 void
@@ -166,16 +172,18 @@ EverCrypt_HKDF_expand_sha2_384(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, Spec_Hash_Definitions_SHA2_384, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -184,15 +192,16 @@ EverCrypt_HKDF_expand_sha2_384(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&ctx, sizeof (ctx));
 }
 
 void
@@ -227,16 +236,18 @@ EverCrypt_HKDF_expand_sha2_512(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, Spec_Hash_Definitions_SHA2_512, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -245,15 +256,16 @@ EverCrypt_HKDF_expand_sha2_512(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&ctx, sizeof (ctx));
 }
 
 void
@@ -288,16 +300,18 @@ EverCrypt_HKDF_expand_blake2s(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, Spec_Hash_Definitions_Blake2S, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -306,15 +320,16 @@ EverCrypt_HKDF_expand_blake2s(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&ctx, sizeof (ctx));
 }
 
 void
@@ -349,16 +364,18 @@ EverCrypt_HKDF_expand_blake2b(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, Spec_Hash_Definitions_Blake2B, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -367,15 +384,16 @@ EverCrypt_HKDF_expand_blake2b(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&ctx, sizeof (ctx));
 }
 
 void
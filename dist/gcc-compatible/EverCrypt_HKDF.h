@@ -38,6 +38,7 @@ extern "C" {
 
 
 #include "EverCrypt_HMAC.h"
+#include "Lib_Memzero0.h"
 #include "Hacl_Spec.h"
 
 void
@@ -848,3 +848,272 @@ EverCrypt_HMAC_compute(
   }
 }
 
+static void
+midstate_init(
+  Spec_Hash_Definitions_hash_alg a,
+  EverCrypt_HMAC_midstate *st,
+  uint8_t *key_block,
+  uint8_t pad
+)
+{
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint8_t block[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    block[i] = key_block[i] ^ pad;
+  }
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        Hacl_Hash_Core_SHA1_legacy_init(st->case_32);
+        Hacl_Hash_SHA1_legacy_update_multi(st->case_32, block, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        Hacl_Hash_Core_SHA2_init_256(st->case_32);
+        EverCrypt_Hash_update_multi_256(st->case_32, block, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        Hacl_Hash_Core_SHA2_init_384(st->case_64);
+        Hacl_Hash_SHA2_update_multi_384(st->case_64, block, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        Hacl_Hash_Core_SHA2_init_512(st->case_64);
+        Hacl_Hash_SHA2_update_multi_512(st->case_64, block, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        uint32_t wv[16U] = { 0U };
+        Hacl_Blake2s_32_blake2s_init(wv, st->case_32, (uint32_t)0U, NULL, (uint32_t)32U);
+        Hacl_Hash_Blake2_update_multi_blake2s_32(st->case_32, (uint64_t)0U, block, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        uint64_t wv[16U] = { 0U };
+        Hacl_Blake2b_32_blake2b_init(wv, st->case_64, (uint32_t)0U, NULL, (uint32_t)64U);
+        Hacl_Hash_Blake2_update_multi_blake2b_32(st->case_64,
+          FStar_UInt128_uint64_to_uint128((uint64_t)0U),
+          block,
+          (uint32_t)1U);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/*
+  Finishes a copy of the midstate st, which has absorbed exactly one block,
+  over input.
+*/
+static void
+midstate_finish(
+  Spec_Hash_Definitions_hash_alg a,
+  EverCrypt_HMAC_midstate *st,
+  uint8_t *dst,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  EverCrypt_HMAC_midstate s = st[0U];
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        Hacl_Hash_SHA1_legacy_update_last(s.case_32, (uint64_t)l, input, input_len);
+        Hacl_Hash_Core_SHA1_legacy_finish(s.case_32, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        EverCrypt_Hash_update_last_256(s.case_32, (uint64_t)l, input, input_len);
+        Hacl_Hash_Core_SHA2_finish_256(s.case_32, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        Hacl_Hash_SHA2_update_last_384(s.case_64,
+          FStar_UInt128_uint64_to_uint128((uint64_t)l),
+          input,
+          input_len);
+        Hacl_Hash_Core_SHA2_finish_384(s.case_64, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        Hacl_Hash_SHA2_update_last_512(s.case_64,
+          FStar_UInt128_uint64_to_uint128((uint64_t)l),
+          input,
+          input_len);
+        Hacl_Hash_Core_SHA2_finish_512(s.case_64, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        uint64_t
+        ev =
+          Hacl_Hash_Blake2_update_last_blake2s_32(s.case_32,
+            (uint64_t)l,
+            (uint64_t)l,
+            input,
+            input_len);
+        Hacl_Hash_Core_Blake2_finish_blake2s_32(s.case_32, ev, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        FStar_UInt128_uint128
+        ev =
+          Hacl_Hash_Blake2_update_last_blake2b_32(s.case_64,
+            FStar_UInt128_uint64_to_uint128((uint64_t)l),
+            FStar_UInt128_uint64_to_uint128((uint64_t)l),
+            input,
+            input_len);
+        Hacl_Hash_Core_Blake2_finish_blake2b_32(s.case_64, ev, dst);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+void
+EverCrypt_HMAC_key_init_into(
+  EverCrypt_HMAC_ctx_s *ctx,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+)
+{
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  ctx->alg = a;
+  memset(ctx->key_block, 0U, (uint32_t)128U * sizeof (uint8_t));
+  if (key_len <= l)
+  {
+    memcpy(ctx->key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash(a, ctx->key_block, key, key_len);
+  }
+  midstate_init(a, &ctx->inner, ctx->key_block, (uint8_t)0x36U);
+  midstate_init(a, &ctx->outer, ctx->key_block, (uint8_t)0x5cU);
+}
+
+EverCrypt_HMAC_ctx_s
+*EverCrypt_HMAC_key_init(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len)
+{
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HMAC_ctx_s), (uint32_t)1U);
+  EverCrypt_HMAC_ctx_s *ctx = KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_ctx_s));
+  EverCrypt_HMAC_key_init_into(ctx, a, key, key_len);
+  return ctx;
+}
+
+void
+EverCrypt_HMAC_compute_with_ctx(
+  EverCrypt_HMAC_ctx_s *ctx,
+  uint8_t *dst,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  Spec_Hash_Definitions_hash_alg a = ctx->alg;
+  if
+  (
+    data_len
+    == (uint32_t)0U
+    && (a == Spec_Hash_Definitions_Blake2S || a == Spec_Hash_Definitions_Blake2B)
+  )
+  {
+    EverCrypt_HMAC_compute(a, dst, ctx->key_block, Hacl_Hash_Definitions_block_len(a), data, data_len);
+    return;
+  }
+  uint8_t hash1[64U] = { 0U };
+  midstate_finish(a, &ctx->inner, hash1, data, data_len);
+  midstate_finish(a, &ctx->outer, dst, hash1, Hacl_Hash_Definitions_hash_len(a));
+}
+
+void EverCrypt_HMAC_ctx_free(EverCrypt_HMAC_ctx_s *ctx)
+{
+  Lib_Memzero0_memzero(ctx, sizeof (EverCrypt_HMAC_ctx_s));
+  KRML_HOST_FREE(ctx);
+}
+
+static void
+incremental_absorb_ipad(EverCrypt_HMAC_Incremental_state_s *s)
+{
+  Spec_Hash_Definitions_hash_alg a = s->ctx->alg;
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint8_t ipad[128U];
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    ipad[i] = s->ctx->key_block[i] ^ (uint8_t)0x36U;
+  }
+  EverCrypt_Hash_Incremental_init(s->inner);
+  EverCrypt_Hash_Incremental_update(s->inner, ipad, l);
+  Lib_Memzero0_memzero(ipad, (uint32_t)128U * sizeof (uint8_t));
+}
+
+EverCrypt_HMAC_Incremental_state_s
+*EverCrypt_HMAC_Incremental_create_in(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+)
+{
+  EverCrypt_HMAC_ctx_s *ctx = EverCrypt_HMAC_key_init(a, key, key_len);
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+  *inner = EverCrypt_Hash_Incremental_create_in(a);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HMAC_Incremental_state_s), (uint32_t)1U);
+  EverCrypt_HMAC_Incremental_state_s
+  *s = KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_Incremental_state_s));
+  s->inner = inner;
+  s->ctx = ctx;
+  incremental_absorb_ipad(s);
+  return s;
+}
+
+void EverCrypt_HMAC_Incremental_init(EverCrypt_HMAC_Incremental_state_s *s)
+{
+  incremental_absorb_ipad(s);
+}
+
+void
+EverCrypt_HMAC_Incremental_update(
+  EverCrypt_HMAC_Incremental_state_s *s,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  EverCrypt_Hash_Incremental_update(s->inner, data, len);
+}
+
+void EverCrypt_HMAC_Incremental_finish(EverCrypt_HMAC_Incremental_state_s *s, uint8_t *dst)
+{
+  Spec_Hash_Definitions_hash_alg a = s->ctx->alg;
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_Hash_Incremental_finish(s->inner, hash1);
+  midstate_finish(a, &s->ctx->outer, dst, hash1, Hacl_Hash_Definitions_hash_len(a));
+}
+
+void EverCrypt_HMAC_Incremental_free(EverCrypt_HMAC_Incremental_state_s *s)
+{
+  EverCrypt_Hash_Incremental_free(s->inner);
+  EverCrypt_HMAC_ctx_free(s->ctx);
+  KRML_HOST_FREE(s);
+}
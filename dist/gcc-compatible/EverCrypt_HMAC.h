@@ -112,6 +112,91 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+/*
+  A keyed HMAC context: the hash states reached after absorbing the key block
+  xored with ipad (inner) and with opad (outer). A MAC computed from it takes
+  two compression calls fewer than EverCrypt_HMAC_compute. The padded key
+  block is kept for BLAKE2 over an empty message, where the ipad block is the
+  final block and no midstate applies.
+*/
+typedef union {
+  uint32_t case_32[16U];
+  uint64_t case_64[16U];
+}
+EverCrypt_HMAC_midstate;
+
+typedef struct EverCrypt_HMAC_ctx_s_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  EverCrypt_HMAC_midstate inner;
+  EverCrypt_HMAC_midstate outer;
+  uint8_t key_block[128U];
+}
+EverCrypt_HMAC_ctx_s;
+
+/*
+  Fills a caller-provided context (e.g. on the stack) for key under a, which
+  must satisfy EverCrypt_HMAC_is_supported_alg. The context is as sensitive as
+  the key: wipe it with Lib_Memzero0_memzero once done.
+*/
+void
+EverCrypt_HMAC_key_init_into(
+  EverCrypt_HMAC_ctx_s *ctx,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+);
+
+EverCrypt_HMAC_ctx_s
+*EverCrypt_HMAC_key_init(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len);
+
+/*
+  Same result as EverCrypt_HMAC_compute with the key of ctx; dst may alias data.
+*/
+void
+EverCrypt_HMAC_compute_with_ctx(
+  EverCrypt_HMAC_ctx_s *ctx,
+  uint8_t *dst,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+void EverCrypt_HMAC_ctx_free(EverCrypt_HMAC_ctx_s *ctx);
+
+/*
+  Streaming HMAC. The inner hash runs in an EverCrypt_Hash_Incremental state
+  that has absorbed the key block xored with ipad; the outer hash starts from
+  the opad midstate of a keyed context. finish leaves the state unchanged, so
+  it may be called at any point and the MAC extended afterwards. init restarts
+  the MAC under the same key.
+*/
+typedef struct EverCrypt_HMAC_Incremental_state_s_s
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *inner;
+  EverCrypt_HMAC_ctx_s *ctx;
+}
+EverCrypt_HMAC_Incremental_state_s;
+
+EverCrypt_HMAC_Incremental_state_s
+*EverCrypt_HMAC_Incremental_create_in(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+);
+
+void EverCrypt_HMAC_Incremental_init(EverCrypt_HMAC_Incremental_state_s *s);
+
+void
+EverCrypt_HMAC_Incremental_update(
+  EverCrypt_HMAC_Incremental_state_s *s,
+  uint8_t *data,
+  uint32_t len
+);
+
+void EverCrypt_HMAC_Incremental_finish(EverCrypt_HMAC_Incremental_state_s *s, uint8_t *dst);
+
+void EverCrypt_HMAC_Incremental_free(EverCrypt_HMAC_Incremental_state_s *s);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -60,6 +60,22 @@ C_String_t EverCrypt_Hash_string_of_alg(Spec_Hash_Definitions_hash_alg uu___)
       {
         return "Blake2B";
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return "SHA3_256";
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return "SHA3_224";
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return "SHA3_384";
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return "SHA3_512";
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -308,6 +324,126 @@ uint64_t
   KRML_HOST_EXIT(255U);
 }
 
+bool
+EverCrypt_Hash_uu___is_SHA3_256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_256_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return projectee.case_SHA3_256_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_224_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_224_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return projectee.case_SHA3_224_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_384_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_384_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return projectee.case_SHA3_384_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_512_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_512_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return projectee.case_SHA3_512_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
 Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -343,6 +479,22 @@ Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_
   {
     return Spec_Hash_Definitions_Blake2B;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return Spec_Hash_Definitions_SHA3_256;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return Spec_Hash_Definitions_SHA3_224;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return Spec_Hash_Definitions_SHA3_384;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return Spec_Hash_Definitions_SHA3_512;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -407,6 +559,34 @@ EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg
         s = ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2B_s, { .case_Blake2B_s = buf } });
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_256_s, { .case_SHA3_256_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_224_s, { .case_SHA3_224_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_384_s, { .case_SHA3_384_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_512_s, { .case_SHA3_512_s = buf } });
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -535,6 +715,30 @@ void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s)
     FStar_UInt128_uint128 uu____1 = FStar_UInt128_uint64_to_uint128((uint64_t)0U);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -633,6 +837,34 @@ void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t
         block);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_loadState((uint32_t)136U, block, p1);
+    Hacl_Impl_SHA3_state_permute(p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_loadState((uint32_t)144U, block, p1);
+    Hacl_Impl_SHA3_state_permute(p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_loadState((uint32_t)104U, block, p1);
+    Hacl_Impl_SHA3_state_permute(p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_loadState((uint32_t)72U, block, p1);
+    Hacl_Impl_SHA3_state_permute(p1);
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -717,6 +949,50 @@ EverCrypt_Hash_update_multi2(
         n);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    uint32_t n = len / (uint32_t)136U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_loadState((uint32_t)136U, blocks + i * (uint32_t)136U, p1);
+      Hacl_Impl_SHA3_state_permute(p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    uint32_t n = len / (uint32_t)144U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_loadState((uint32_t)144U, blocks + i * (uint32_t)144U, p1);
+      Hacl_Impl_SHA3_state_permute(p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    uint32_t n = len / (uint32_t)104U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_loadState((uint32_t)104U, blocks + i * (uint32_t)104U, p1);
+      Hacl_Impl_SHA3_state_permute(p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    uint32_t n = len / (uint32_t)72U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_loadState((uint32_t)72U, blocks + i * (uint32_t)72U, p1);
+      Hacl_Impl_SHA3_state_permute(p1);
+    }
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -826,6 +1102,30 @@ EverCrypt_Hash_update_last2(
         last_len);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)136U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)144U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)104U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)72U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -881,6 +1181,26 @@ void EverCrypt_Hash_update_last(EverCrypt_Hash_state_s *s, uint8_t *last, uint64
         sw = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw = (uint32_t)72U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -945,6 +1265,30 @@ void EverCrypt_Hash_finish(EverCrypt_Hash_state_s *s, uint8_t *dst)
       dst);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)136U, (uint32_t)32U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)144U, (uint32_t)28U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)104U, (uint32_t)48U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)72U, (uint32_t)64U, dst);
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -995,6 +1339,26 @@ void EverCrypt_Hash_free(EverCrypt_Hash_state_s *s)
     uint64_t *p1 = scrut.case_Blake2B_s;
     KRML_HOST_FREE(p1);
   }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    KRML_HOST_FREE(p1);
+  }
   else
   {
     KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
@@ -1137,32 +1501,96 @@ void EverCrypt_Hash_copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *
     memcpy(p_dst, p_src, (uint32_t)16U * sizeof (uint64_t));
     return;
   }
-  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
-    __FILE__,
-    __LINE__,
-    "unreachable (pattern matches are exhaustive in F*)");
-  KRML_HOST_EXIT(255U);
-}
-
-void EverCrypt_Hash_hash_256(uint8_t *input, uint32_t input_len, uint8_t *dst)
-{
-  uint32_t
-  scrut[8U] =
-    {
-      (uint32_t)0x6a09e667U, (uint32_t)0xbb67ae85U, (uint32_t)0x3c6ef372U, (uint32_t)0xa54ff53aU,
-      (uint32_t)0x510e527fU, (uint32_t)0x9b05688cU, (uint32_t)0x1f83d9abU, (uint32_t)0x5be0cd19U
-    };
-  uint32_t *s = scrut;
-  uint32_t blocks_n0 = input_len / (uint32_t)64U;
-  uint32_t blocks_n1;
-  if (input_len % (uint32_t)64U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
   {
-    blocks_n1 = blocks_n0 - (uint32_t)1U;
+    uint64_t *p_src = scrut.case_SHA3_256_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_256_s)
+    {
+      p_dst = x1.case_SHA3_256_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
   }
-  else
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
   {
-    blocks_n1 = blocks_n0;
-  }
+    uint64_t *p_src = scrut.case_SHA3_224_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_224_s)
+    {
+      p_dst = x1.case_SHA3_224_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p_src = scrut.case_SHA3_384_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_384_s)
+    {
+      p_dst = x1.case_SHA3_384_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p_src = scrut.case_SHA3_512_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_512_s)
+    {
+      p_dst = x1.case_SHA3_512_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+void EverCrypt_Hash_hash_256(uint8_t *input, uint32_t input_len, uint8_t *dst)
+{
+  uint32_t
+  scrut[8U] =
+    {
+      (uint32_t)0x6a09e667U, (uint32_t)0xbb67ae85U, (uint32_t)0x3c6ef372U, (uint32_t)0xa54ff53aU,
+      (uint32_t)0x510e527fU, (uint32_t)0x9b05688cU, (uint32_t)0x1f83d9abU, (uint32_t)0x5be0cd19U
+    };
+  uint32_t *s = scrut;
+  uint32_t blocks_n0 = input_len / (uint32_t)64U;
+  uint32_t blocks_n1;
+  if (input_len % (uint32_t)64U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  {
+    blocks_n1 = blocks_n0 - (uint32_t)1U;
+  }
+  else
+  {
+    blocks_n1 = blocks_n0;
+  }
   uint32_t blocks_len0 = blocks_n1 * (uint32_t)64U;
   uint8_t *blocks0 = input;
   uint32_t rest_len0 = input_len - blocks_len0;
@@ -1260,6 +1688,26 @@ EverCrypt_Hash_hash(
         Hacl_Hash_Blake2_hash_blake2b_32(input, len, dst);
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        Hacl_SHA3_sha3_256(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        Hacl_SHA3_sha3_224(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        Hacl_SHA3_sha3_384(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        Hacl_SHA3_sha3_512(len, input, dst);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1268,6 +1716,121 @@ EverCrypt_Hash_hash(
   }
 }
 
+void
+EverCrypt_Hash_hash_multi(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  bool vec512 = EverCrypt_AutoConfig2_has_vec512();
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_CAN_COMPILE_VEC512
+  if (vec512 && (a == Spec_Hash_Definitions_SHA2_384 || a == Spec_Hash_Definitions_SHA2_512))
+  {
+    if (a == Spec_Hash_Definitions_SHA2_384)
+    {
+      Hacl_SHA2_Vec512_sha384_multi(n, dsts, inputs, input_lens);
+    }
+    else
+    {
+      Hacl_SHA2_Vec512_sha512_multi(n, dsts, inputs, input_lens);
+    }
+    return;
+  }
+  /* Unlike eight AVX2 lanes, sixteen AVX-512 lanes beat the SHA extensions,
+     but only once there are enough messages to fill them. */
+  if
+  (
+    vec512
+    && (!(has_shaext && has_sse) || n >= (uint32_t)16U)
+    && (a == Spec_Hash_Definitions_SHA2_224 || a == Spec_Hash_Definitions_SHA2_256)
+  )
+  {
+    if (a == Spec_Hash_Definitions_SHA2_224)
+    {
+      Hacl_SHA2_Vec512_sha224_multi(n, dsts, inputs, input_lens);
+    }
+    else
+    {
+      Hacl_SHA2_Vec512_sha256_multi(n, dsts, inputs, input_lens);
+    }
+    return;
+  }
+  #endif
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (vec256 && (a == Spec_Hash_Definitions_SHA2_384 || a == Spec_Hash_Definitions_SHA2_512))
+  {
+    if (a == Spec_Hash_Definitions_SHA2_384)
+    {
+      Hacl_SHA2_Vec256_sha384_multi(n, dsts, inputs, input_lens);
+    }
+    else
+    {
+      Hacl_SHA2_Vec256_sha512_multi(n, dsts, inputs, input_lens);
+    }
+    return;
+  }
+  if
+  (
+    vec256
+    &&
+      (
+        a == Spec_Hash_Definitions_SHA3_224
+        || a == Spec_Hash_Definitions_SHA3_256
+        || a == Spec_Hash_Definitions_SHA3_384
+        || a == Spec_Hash_Definitions_SHA3_512
+      )
+  )
+  {
+    if (a == Spec_Hash_Definitions_SHA3_224)
+    {
+      Hacl_SHA3_Vec256_sha3_224_multi(n, dsts, inputs, input_lens);
+    }
+    else if (a == Spec_Hash_Definitions_SHA3_256)
+    {
+      Hacl_SHA3_Vec256_sha3_256_multi(n, dsts, inputs, input_lens);
+    }
+    else if (a == Spec_Hash_Definitions_SHA3_384)
+    {
+      Hacl_SHA3_Vec256_sha3_384_multi(n, dsts, inputs, input_lens);
+    }
+    else
+    {
+      Hacl_SHA3_Vec256_sha3_512_multi(n, dsts, inputs, input_lens);
+    }
+    return;
+  }
+  /* The SHA extensions beat eight AVX2 lanes, so only fall back to the
+     multi-buffer code when they are not available. */
+  if
+  (
+    vec256
+    && !(has_shaext && has_sse)
+    && (a == Spec_Hash_Definitions_SHA2_224 || a == Spec_Hash_Definitions_SHA2_256)
+  )
+  {
+    if (a == Spec_Hash_Definitions_SHA2_224)
+    {
+      Hacl_SHA2_Vec256_sha224_multi(n, dsts, inputs, input_lens);
+    }
+    else
+    {
+      Hacl_SHA2_Vec256_sha256_multi(n, dsts, inputs, input_lens);
+    }
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_Hash_hash(a, dsts[i], inputs[i], input_lens[i]);
+  }
+}
+
 uint32_t EverCrypt_Hash_Incremental_hash_len(Spec_Hash_Definitions_hash_alg a)
 {
   switch (a)
@@ -1304,6 +1867,22 @@ uint32_t EverCrypt_Hash_Incremental_hash_len(Spec_Hash_Definitions_hash_alg a)
       {
         return (uint32_t)64U;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return (uint32_t)28U;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return (uint32_t)48U;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return (uint32_t)64U;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1348,6 +1927,22 @@ uint32_t EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_hash_alg a)
       {
         return (uint32_t)128U;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return (uint32_t)136U;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return (uint32_t)144U;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return (uint32_t)104U;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return (uint32_t)72U;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2062,6 +2657,230 @@ EverCrypt_Hash_Incremental_finish_blake2b(
   EverCrypt_Hash_finish(&tmp_block_state, dst);
 }
 
+void
+EverCrypt_Hash_Incremental_finish_sha3_256(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_256_s, { .case_SHA3_256_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  uint32_t ite;
+  if
+  (
+    r
+    % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256)
+    == (uint32_t)0U
+    && r > (uint32_t)0U
+  )
+  {
+    ite = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256);
+  }
+  else
+  {
+    ite = r % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_256);
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  EverCrypt_Hash_update_multi2(&tmp_block_state, prev_len, buf_multi, (uint32_t)0U);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_224(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_224_s, { .case_SHA3_224_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  uint32_t ite;
+  if
+  (
+    r
+    % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224)
+    == (uint32_t)0U
+    && r > (uint32_t)0U
+  )
+  {
+    ite = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224);
+  }
+  else
+  {
+    ite = r % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_224);
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  EverCrypt_Hash_update_multi2(&tmp_block_state, prev_len, buf_multi, (uint32_t)0U);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_384(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_384_s, { .case_SHA3_384_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  uint32_t ite;
+  if
+  (
+    r
+    % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384)
+    == (uint32_t)0U
+    && r > (uint32_t)0U
+  )
+  {
+    ite = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384);
+  }
+  else
+  {
+    ite = r % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_384);
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  EverCrypt_Hash_update_multi2(&tmp_block_state, prev_len, buf_multi, (uint32_t)0U);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_512(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if
+  (
+    total_len
+    % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512)
+    == (uint64_t)0U
+    && total_len > (uint64_t)0U
+  )
+  {
+    r = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512);
+  }
+  else
+  {
+    r =
+      (uint32_t)(total_len
+      % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512));
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_512_s, { .case_SHA3_512_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  uint32_t ite;
+  if
+  (
+    r
+    % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512)
+    == (uint32_t)0U
+    && r > (uint32_t)0U
+  )
+  {
+    ite = EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512);
+  }
+  else
+  {
+    ite = r % EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_SHA3_512);
+  }
+  uint8_t *buf_last = buf_1 + r - ite;
+  uint8_t *buf_multi = buf_1;
+  EverCrypt_Hash_update_multi2(&tmp_block_state, prev_len, buf_multi, (uint32_t)0U);
+  uint64_t prev_len_last = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
 Spec_Hash_Definitions_hash_alg
 EverCrypt_Hash_Incremental_alg_of_state(
   Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s
@@ -2121,6 +2940,26 @@ EverCrypt_Hash_Incremental_finish(
         EverCrypt_Hash_Incremental_finish_blake2b(s, dst);
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_256(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_224(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_384(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_512(s, dst);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -41,6 +41,10 @@ extern "C" {
 #include "Hacl_Impl_Blake2_Constants.h"
 #include "Vale.h"
 #include "Hacl_Hash.h"
+#include "Hacl_SHA2_Vec256.h"
+#include "Hacl_SHA2_Vec512.h"
+#include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
 #include "EverCrypt_AutoConfig2.h"
 #include "Hacl_Spec.h"
 
@@ -62,6 +66,10 @@ typedef void *EverCrypt_Hash_e_alg;
 #define EverCrypt_Hash_SHA2_512_s 5
 #define EverCrypt_Hash_Blake2S_s 6
 #define EverCrypt_Hash_Blake2B_s 7
+#define EverCrypt_Hash_SHA3_256_s 8
+#define EverCrypt_Hash_SHA3_224_s 9
+#define EverCrypt_Hash_SHA3_384_s 10
+#define EverCrypt_Hash_SHA3_512_s 11
 
 typedef uint8_t EverCrypt_Hash_state_s_tags;
 
@@ -77,6 +85,10 @@ typedef struct EverCrypt_Hash_state_s_s
     uint64_t *case_SHA2_512_s;
     uint32_t *case_Blake2S_s;
     uint64_t *case_Blake2B_s;
+    uint64_t *case_SHA3_256_s;
+    uint64_t *case_SHA3_224_s;
+    uint64_t *case_SHA3_384_s;
+    uint64_t *case_SHA3_512_s;
   }
   ;
 }
@@ -178,6 +190,54 @@ uint64_t
   EverCrypt_Hash_state_s projectee
 );
 
+bool
+EverCrypt_Hash_uu___is_SHA3_256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_256_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_SHA3_224_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_224_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_SHA3_384_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_384_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_SHA3_512_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_512_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
 Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_s *s);
 
 EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg a);
@@ -244,6 +304,24 @@ EverCrypt_Hash_hash(
   uint32_t len
 );
 
+/*
+Hash `n` independent messages: `dsts[i]` receives the digest of the
+  `input_lens[i]`-byte buffer `inputs[i]`.
+
+  On AVX2 machines, SHA2 uses a multi-buffer implementation that processes
+  several messages in parallel (see Hacl_SHA2_Vec256.h); AVX-512 machines use
+  twice as many lanes (see Hacl_SHA2_Vec512.h). Other algorithms, and other
+  machines, hash the messages one after the other.
+*/
+void
+EverCrypt_Hash_hash_multi(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+);
+
 uint32_t EverCrypt_Hash_Incremental_hash_len(Spec_Hash_Definitions_hash_alg a);
 
 uint32_t EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_hash_alg a);
@@ -317,6 +395,30 @@ EverCrypt_Hash_Incremental_finish_blake2b(
   uint8_t *dst
 );
 
+void
+EverCrypt_Hash_Incremental_finish_sha3_256(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_224(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_384(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_512(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
 Spec_Hash_Definitions_hash_alg
 EverCrypt_Hash_Incremental_alg_of_state(
   Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s
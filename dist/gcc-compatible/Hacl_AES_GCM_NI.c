@@ -0,0 +1,509 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_GCM_NI.h"
+
+/*
+  The AES and GHASH loops below take the number of rounds as a parameter;
+  the exported functions call them with a literal 10 or 14 so that the
+  compiler fully unrolls the rounds and keeps the round keys in registers.
+*/
+
+static inline Lib_IntVector_Intrinsics_vec128
+aes_encrypt1(uint32_t nr, Lib_IntVector_Intrinsics_vec128 *rk, Lib_IntVector_Intrinsics_vec128 b)
+{
+  Lib_IntVector_Intrinsics_vec128 st = Lib_IntVector_Intrinsics_vec128_xor(b, rk[0U]);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    st = Lib_IntVector_Intrinsics_ni_aes_enc(st, rk[i]);
+  }
+  return Lib_IntVector_Intrinsics_ni_aes_enc_last(st, rk[nr]);
+}
+
+static inline void load_round_keys(Lib_IntVector_Intrinsics_vec128 *rk, uint32_t nr, uint8_t *keys)
+{
+  for (uint32_t i = (uint32_t)0U; i < nr + (uint32_t)1U; i++)
+  {
+    rk[i] = Lib_IntVector_Intrinsics_vec128_load64_le(keys + i * (uint32_t)16U);
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+ctr_block_at(Lib_IntVector_Intrinsics_vec128 base, uint32_t ctr)
+{
+  return Lib_IntVector_Intrinsics_vec128_insert32(base, htobe32(ctr), (uint32_t)3U);
+}
+
+/* Eight AES encryptions, interleaved so that the rounds of different blocks overlap. */
+static inline void
+aes_encrypt8(uint32_t nr, Lib_IntVector_Intrinsics_vec128 *rk, Lib_IntVector_Intrinsics_vec128 *st)
+{
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    st[j] = Lib_IntVector_Intrinsics_vec128_xor(st[j], rk[0U]);
+  }
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    Lib_IntVector_Intrinsics_vec128 k = rk[r];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      st[j] = Lib_IntVector_Intrinsics_ni_aes_enc(st[j], k);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    st[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last(st[j], rk[nr]);
+  }
+}
+
+static inline void
+aes_ctr32_(
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+)
+{
+  Lib_IntVector_Intrinsics_vec128 rk[15U];
+  for (uint32_t _i = 0U; _i < (uint32_t)15U; ++_i)
+    rk[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  load_round_keys(rk, nr, keys);
+  Lib_IntVector_Intrinsics_vec128 base = Lib_IntVector_Intrinsics_vec128_load64_le(ctr_block);
+  uint32_t ctr0 = load32_be(ctr_block + (uint32_t)12U) + c;
+  uint32_t nb = len / (uint32_t)16U;
+  uint32_t nb8 = nb / (uint32_t)8U;
+  for (uint32_t i = (uint32_t)0U; i < nb8; i++)
+  {
+    uint8_t *ib = in + i * (uint32_t)128U;
+    uint8_t *ob = out + i * (uint32_t)128U;
+    uint32_t ctr = ctr0 + i * (uint32_t)8U;
+    Lib_IntVector_Intrinsics_vec128 st[8U];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      st[j] = ctr_block_at(base, ctr + j);
+    }
+    aes_encrypt8(nr, rk, st);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      Lib_IntVector_Intrinsics_vec128
+      x = Lib_IntVector_Intrinsics_vec128_load64_le(ib + j * (uint32_t)16U);
+      Lib_IntVector_Intrinsics_vec128_store64_le(ob + j * (uint32_t)16U,
+        Lib_IntVector_Intrinsics_vec128_xor(x, st[j]));
+    }
+  }
+  for (uint32_t i = nb8 * (uint32_t)8U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128 ks = aes_encrypt1(nr, rk, ctr_block_at(base, ctr0 + i));
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load64_le(in + i * (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128_store64_le(out + i * (uint32_t)16U,
+      Lib_IntVector_Intrinsics_vec128_xor(x, ks));
+  }
+}
+
+static inline void
+aes_ecb_(uint32_t nr, uint32_t len, uint8_t *out, uint8_t *in, uint8_t *keys)
+{
+  Lib_IntVector_Intrinsics_vec128 rk[15U];
+  for (uint32_t _i = 0U; _i < (uint32_t)15U; ++_i)
+    rk[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  load_round_keys(rk, nr, keys);
+  uint32_t nb = len / (uint32_t)16U;
+  uint32_t nb8 = nb / (uint32_t)8U;
+  for (uint32_t i = (uint32_t)0U; i < nb8; i++)
+  {
+    uint8_t *ib = in + i * (uint32_t)128U;
+    uint8_t *ob = out + i * (uint32_t)128U;
+    Lib_IntVector_Intrinsics_vec128 st[8U];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      st[j] = Lib_IntVector_Intrinsics_vec128_load64_le(ib + j * (uint32_t)16U);
+    }
+    aes_encrypt8(nr, rk, st);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      Lib_IntVector_Intrinsics_vec128_store64_le(ob + j * (uint32_t)16U, st[j]);
+    }
+  }
+  for (uint32_t i = nb8 * (uint32_t)8U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load64_le(in + i * (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128_store64_le(out + i * (uint32_t)16U, aes_encrypt1(nr, rk, x));
+  }
+}
+
+void
+Hacl_AES_GCM_NI_aes_encrypt_block(uint8_t *out, uint32_t nr, uint8_t *keys, uint8_t *in)
+{
+  Lib_IntVector_Intrinsics_vec128 rk[15U];
+  for (uint32_t _i = 0U; _i < (uint32_t)15U; ++_i)
+    rk[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  load_round_keys(rk, nr, keys);
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load64_le(in);
+  Lib_IntVector_Intrinsics_vec128_store64_le(out, aes_encrypt1(nr, rk, b));
+}
+
+void
+Hacl_AES_GCM_NI_aes_ctr32(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+)
+{
+  if (nr == (uint32_t)10U)
+  {
+    aes_ctr32_((uint32_t)10U, len, out, in, keys, ctr_block, c);
+  }
+  else
+  {
+    aes_ctr32_((uint32_t)14U, len, out, in, keys, ctr_block, c);
+  }
+}
+
+void
+Hacl_AES_GCM_NI_aes_ecb(uint32_t len, uint8_t *out, uint8_t *in, uint32_t nr, uint8_t *keys)
+{
+  if (nr == (uint32_t)10U)
+  {
+    aes_ecb_((uint32_t)10U, len, out, in, keys);
+  }
+  else
+  {
+    aes_ecb_((uint32_t)14U, len, out, in, keys);
+  }
+}
+
+/*
+  GF(2^128) arithmetic on byte-reversed blocks. Products are computed with
+  Karatsuba (three carry-less multiplications) and accumulated unreduced in
+  (lo, mid, hi), so that several products share a single fold and reduction.
+  For each power of H, the table also keeps the XOR of its two halves, the
+  second Karatsuba operand.
+*/
+static inline void
+clmul_acc(
+  Lib_IntVector_Intrinsics_vec128 *lo,
+  Lib_IntVector_Intrinsics_vec128 *mid,
+  Lib_IntVector_Intrinsics_vec128 *hi,
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 h,
+  Lib_IntVector_Intrinsics_vec128 hk
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  xk = Lib_IntVector_Intrinsics_vec128_xor(x, Lib_IntVector_Intrinsics_vec128_shift_right(x, (uint32_t)64U));
+  lo[0U] = Lib_IntVector_Intrinsics_vec128_xor(lo[0U], Lib_IntVector_Intrinsics_ni_clmul(x, h, (uint8_t)0x00U));
+  hi[0U] = Lib_IntVector_Intrinsics_vec128_xor(hi[0U], Lib_IntVector_Intrinsics_ni_clmul(x, h, (uint8_t)0x11U));
+  mid[0U] = Lib_IntVector_Intrinsics_vec128_xor(mid[0U], Lib_IntVector_Intrinsics_ni_clmul(xk, hk, (uint8_t)0x00U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+reduce(Lib_IntVector_Intrinsics_vec128 lo, Lib_IntVector_Intrinsics_vec128 hi)
+{
+  Lib_IntVector_Intrinsics_vec128 c0 = Lib_IntVector_Intrinsics_vec128_shift_right32(lo, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 c1 = Lib_IntVector_Intrinsics_vec128_shift_right32(hi, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 l = Lib_IntVector_Intrinsics_vec128_shift_left32(lo, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 h = Lib_IntVector_Intrinsics_vec128_shift_left32(hi, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 c2 = Lib_IntVector_Intrinsics_vec128_shift_right(c0, (uint32_t)96U);
+  l = Lib_IntVector_Intrinsics_vec128_or(l, Lib_IntVector_Intrinsics_vec128_shift_left(c0, (uint32_t)32U));
+  h = Lib_IntVector_Intrinsics_vec128_or(h, Lib_IntVector_Intrinsics_vec128_shift_left(c1, (uint32_t)32U));
+  h = Lib_IntVector_Intrinsics_vec128_or(h, c2);
+  Lib_IntVector_Intrinsics_vec128 a = Lib_IntVector_Intrinsics_vec128_shift_left32(l, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_shift_left32(l, (uint32_t)30U);
+  Lib_IntVector_Intrinsics_vec128 d = Lib_IntVector_Intrinsics_vec128_shift_left32(l, (uint32_t)25U);
+  a = Lib_IntVector_Intrinsics_vec128_xor(a, Lib_IntVector_Intrinsics_vec128_xor(b, d));
+  Lib_IntVector_Intrinsics_vec128 e = Lib_IntVector_Intrinsics_vec128_shift_right(a, (uint32_t)32U);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_vec128_shift_left(a, (uint32_t)96U));
+  Lib_IntVector_Intrinsics_vec128 f = Lib_IntVector_Intrinsics_vec128_shift_right32(l, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 g = Lib_IntVector_Intrinsics_vec128_shift_right32(l, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec128 k = Lib_IntVector_Intrinsics_vec128_shift_right32(l, (uint32_t)7U);
+  f = Lib_IntVector_Intrinsics_vec128_xor(f, Lib_IntVector_Intrinsics_vec128_xor(g, k));
+  f = Lib_IntVector_Intrinsics_vec128_xor(f, e);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, f);
+  return Lib_IntVector_Intrinsics_vec128_xor(h, l);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+fold(
+  Lib_IntVector_Intrinsics_vec128 lo,
+  Lib_IntVector_Intrinsics_vec128 mid,
+  Lib_IntVector_Intrinsics_vec128 hi
+)
+{
+  Lib_IntVector_Intrinsics_vec128
+  m = Lib_IntVector_Intrinsics_vec128_xor(mid, Lib_IntVector_Intrinsics_vec128_xor(lo, hi));
+  Lib_IntVector_Intrinsics_vec128
+  l = Lib_IntVector_Intrinsics_vec128_xor(lo, Lib_IntVector_Intrinsics_vec128_shift_left(m, (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  h = Lib_IntVector_Intrinsics_vec128_xor(hi, Lib_IntVector_Intrinsics_vec128_shift_right(m, (uint32_t)64U));
+  return reduce(l, h);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+karatsuba_key(Lib_IntVector_Intrinsics_vec128 h)
+{
+  return Lib_IntVector_Intrinsics_vec128_xor(h, Lib_IntVector_Intrinsics_vec128_shift_right(h, (uint32_t)64U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+fmul(Lib_IntVector_Intrinsics_vec128 x, Lib_IntVector_Intrinsics_vec128 y)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_acc(&lo, &mid, &hi, x, y, karatsuba_key(y));
+  return fold(lo, mid, hi);
+}
+
+void Hacl_AES_GCM_NI_gcm_precomp(uint8_t *table, uint32_t nr, uint8_t *keys)
+{
+  uint8_t h[16U] = { 0U };
+  Hacl_AES_GCM_NI_aes_encrypt_block(h, nr, keys, h);
+  Lib_IntVector_Intrinsics_vec128 h1 = Lib_IntVector_Intrinsics_vec128_load_be(h);
+  Lib_IntVector_Intrinsics_vec128 hi = h1;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    if (i > (uint32_t)0U)
+    {
+      hi = fmul(hi, h1);
+    }
+    uint8_t *t = table + i / (uint32_t)8U * (uint32_t)256U + i % (uint32_t)8U * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec128_store64_le(t, hi);
+    Lib_IntVector_Intrinsics_vec128_store64_le(t + (uint32_t)128U, karatsuba_key(hi));
+  }
+}
+
+void Hacl_AES_GCM_NI_gcm_init(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *table)
+{
+  ctx[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    ctx[i + (uint32_t)1U] = Lib_IntVector_Intrinsics_vec128_load64_le(table + i * (uint32_t)16U);
+  }
+}
+
+/*
+  Folds eight blocks into the accumulator with a single reduction:
+  acc = (acc + x0) * H^8 + x1 * H^7 + ... + x7 * H.
+*/
+static inline void gcm_update8(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *b)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load_be(b + j * (uint32_t)16U);
+    if (j == (uint32_t)0U)
+    {
+      x = Lib_IntVector_Intrinsics_vec128_xor(x, ctx[0U]);
+    }
+    clmul_acc(&lo, &mid, &hi, x, ctx[(uint32_t)8U - j], ctx[(uint32_t)16U - j]);
+  }
+  ctx[0U] = fold(lo, mid, hi);
+}
+
+/*
+  Same with sixteen blocks and H^16 ... H: on its own, GHASH waits on the
+  reduction feeding the next group, so fewer reductions go faster.
+*/
+static inline void gcm_update16(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *b)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load_be(b + j * (uint32_t)16U);
+    if (j == (uint32_t)0U)
+    {
+      x = Lib_IntVector_Intrinsics_vec128_xor(x, ctx[0U]);
+    }
+    clmul_acc(&lo, &mid, &hi, x, ctx[(uint32_t)24U - j], ctx[(uint32_t)32U - j]);
+    Lib_IntVector_Intrinsics_vec128
+    y = Lib_IntVector_Intrinsics_vec128_load_be(b + (j + (uint32_t)8U) * (uint32_t)16U);
+    clmul_acc(&lo, &mid, &hi, y, ctx[(uint32_t)8U - j], ctx[(uint32_t)16U - j]);
+  }
+  ctx[0U] = fold(lo, mid, hi);
+}
+
+void
+Hacl_AES_GCM_NI_gcm_update_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  uint32_t nb = len / (uint32_t)16U;
+  uint32_t nb16 = nb / (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb16; i++)
+  {
+    gcm_update16(ctx, text + i * (uint32_t)256U);
+  }
+  if (nb - nb16 * (uint32_t)16U >= (uint32_t)8U)
+  {
+    gcm_update8(ctx, text + nb16 * (uint32_t)256U);
+  }
+  uint32_t nb8 = nb / (uint32_t)8U;
+  /* The remaining rem < 8 blocks are also aggregated, with H^rem ... H. */
+  uint32_t rem = nb - nb8 * (uint32_t)8U;
+  if (rem == (uint32_t)0U)
+  {
+    return;
+  }
+  uint8_t *b = text + nb8 * (uint32_t)128U;
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t j = (uint32_t)0U; j < rem; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    x = Lib_IntVector_Intrinsics_vec128_load_be(b + j * (uint32_t)16U);
+    if (j == (uint32_t)0U)
+    {
+      x = Lib_IntVector_Intrinsics_vec128_xor(x, ctx[0U]);
+    }
+    clmul_acc(&lo, &mid, &hi, x, ctx[rem - j], ctx[(uint32_t)8U + rem - j]);
+  }
+  ctx[0U] = fold(lo, mid, hi);
+}
+
+/*
+  The ciphertext of each group of eight blocks is hashed while the next group
+  goes through the AES rounds, one block per round, so that the AES and the
+  carry-less multiplication units are busy at the same time.
+*/
+static inline void
+gcm_encrypt_blocks_(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+)
+{
+  uint32_t nb8 = len / (uint32_t)128U;
+  Lib_IntVector_Intrinsics_vec128 rk[15U];
+  for (uint32_t _i = 0U; _i < (uint32_t)15U; ++_i)
+    rk[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  load_round_keys(rk, nr, keys);
+  Lib_IntVector_Intrinsics_vec128 base = Lib_IntVector_Intrinsics_vec128_load64_le(ctr_block);
+  uint32_t ctr0 = load32_be(ctr_block + (uint32_t)12U) + c;
+  aes_ctr32_(nr, (uint32_t)128U, out, in, keys, ctr_block, c);
+  Lib_IntVector_Intrinsics_vec128 acc = ctx[0U];
+  for (uint32_t i = (uint32_t)1U; i < nb8; i++)
+  {
+    uint8_t *ib = in + i * (uint32_t)128U;
+    uint8_t *ob = out + i * (uint32_t)128U;
+    uint8_t *prev = ob - (uint32_t)128U;
+    uint32_t ctr = ctr0 + i * (uint32_t)8U;
+    Lib_IntVector_Intrinsics_vec128 st[8U];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      st[j] = Lib_IntVector_Intrinsics_vec128_xor(ctr_block_at(base, ctr + j), rk[0U]);
+    }
+    Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_zero;
+    Lib_IntVector_Intrinsics_vec128 mid = Lib_IntVector_Intrinsics_vec128_zero;
+    Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_vec128_zero;
+    for (uint32_t r = (uint32_t)1U; r < nr; r++)
+    {
+      Lib_IntVector_Intrinsics_vec128 k = rk[r];
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        st[j] = Lib_IntVector_Intrinsics_ni_aes_enc(st[j], k);
+      }
+      if (r <= (uint32_t)8U)
+      {
+        uint32_t j = r - (uint32_t)1U;
+        Lib_IntVector_Intrinsics_vec128
+        x = Lib_IntVector_Intrinsics_vec128_load_be(prev + j * (uint32_t)16U);
+        if (j == (uint32_t)0U)
+        {
+          x = Lib_IntVector_Intrinsics_vec128_xor(x, acc);
+        }
+        clmul_acc(&lo, &mid, &hi, x, ctx[(uint32_t)8U - j], ctx[(uint32_t)16U - j]);
+      }
+    }
+    acc = fold(lo, mid, hi);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      Lib_IntVector_Intrinsics_vec128 ks = Lib_IntVector_Intrinsics_ni_aes_enc_last(st[j], rk[nr]);
+      Lib_IntVector_Intrinsics_vec128
+      x = Lib_IntVector_Intrinsics_vec128_load64_le(ib + j * (uint32_t)16U);
+      Lib_IntVector_Intrinsics_vec128_store64_le(ob + j * (uint32_t)16U,
+        Lib_IntVector_Intrinsics_vec128_xor(x, ks));
+    }
+  }
+  ctx[0U] = acc;
+  gcm_update8(ctx, out + (nb8 - (uint32_t)1U) * (uint32_t)128U);
+  uint32_t done = nb8 * (uint32_t)128U;
+  aes_ctr32_(nr, len - done, out + done, in + done, keys, ctr_block, c + nb8 * (uint32_t)8U);
+  Hacl_AES_GCM_NI_gcm_update_blocks(ctx, len - done, out + done);
+}
+
+void
+Hacl_AES_GCM_NI_gcm_encrypt_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+)
+{
+  if (len < (uint32_t)128U)
+  {
+    Hacl_AES_GCM_NI_aes_ctr32(len, out, in, nr, keys, ctr_block, c);
+    Hacl_AES_GCM_NI_gcm_update_blocks(ctx, len, out);
+    return;
+  }
+  if (nr == (uint32_t)10U)
+  {
+    gcm_encrypt_blocks_((uint32_t)10U, ctx, len, out, in, keys, ctr_block, c);
+  }
+  else
+  {
+    gcm_encrypt_blocks_((uint32_t)14U, ctx, len, out, in, keys, ctr_block, c);
+  }
+}
+
+void Hacl_AES_GCM_NI_gcm_emit(uint8_t *tag, Lib_IntVector_Intrinsics_vec128 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec128_store_be(tag, ctx[0U]);
+}
@@ -0,0 +1,116 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AES_GCM_NI_H
+#define __Hacl_AES_GCM_NI_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+/*
+  AES-NI / PCLMULQDQ building blocks for streaming AES-GCM.
+
+  `keys` is an AES key schedule as laid out by Vale's aes128_key_expansion and
+  aes256_key_expansion, i.e. nr + 1 round keys of 16 bytes each, with nr = 10
+  or nr = 14.
+
+  The GHASH table holds H, H^2, ..., H^8, followed by the XOR of the two 64-bit
+  halves of each of these powers, then the same for H^9, ..., H^16 (512 bytes),
+  where H is the encryption of the all-zero block; it only depends on the key.
+  The GHASH context is 33 vectors: the accumulator, followed by the table.
+*/
+void
+Hacl_AES_GCM_NI_aes_encrypt_block(uint8_t *out, uint32_t nr, uint8_t *keys, uint8_t *in);
+
+/*
+  Counter-mode encryption of len bytes, len a multiple of 16. Block i is XORed
+  with the encryption of ctr_block whose last four bytes, read as a big-endian
+  integer, have been incremented by c + i (modulo 2^32).
+*/
+void
+Hacl_AES_GCM_NI_aes_ctr32(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+);
+
+/*
+  Encrypts the len / 16 blocks of in independently (ECB), eight at a time so
+  that the AES rounds of different blocks overlap in the pipeline.
+*/
+void
+Hacl_AES_GCM_NI_aes_ecb(uint32_t len, uint8_t *out, uint8_t *in, uint32_t nr, uint8_t *keys);
+
+void Hacl_AES_GCM_NI_gcm_precomp(uint8_t *table, uint32_t nr, uint8_t *keys);
+
+void Hacl_AES_GCM_NI_gcm_init(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *table);
+
+/*
+  Absorbs len bytes into the GHASH accumulator, len a multiple of 16.
+*/
+void
+Hacl_AES_GCM_NI_gcm_update_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *text
+);
+
+/*
+  aes_ctr32 followed by gcm_update_blocks on the output, interleaved.
+*/
+void
+Hacl_AES_GCM_NI_gcm_encrypt_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+);
+
+void Hacl_AES_GCM_NI_gcm_emit(uint8_t *tag, Lib_IntVector_Intrinsics_vec128 *ctx);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_GCM_NI_H_DEFINED
+#endif
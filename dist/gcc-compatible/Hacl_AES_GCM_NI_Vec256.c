@@ -0,0 +1,488 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_GCM_NI_Vec256.h"
+
+#include "Hacl_AES_GCM_NI.h"
+
+/*
+  VAES / VPCLMULQDQ versions of the Hacl_AES_GCM_NI bulk functions: each
+  vec256 holds two consecutive blocks, so that a group of eight blocks takes
+  four vectors. Key schedules, GHASH tables and contexts are shared with
+  Hacl_AES_GCM_NI, and the results are identical. Inputs shorter than a group
+  go to the 128-bit functions, which have less to set up.
+*/
+
+static inline void
+load_round_keys(Lib_IntVector_Intrinsics_vec256 *rk, uint32_t nr, uint8_t *keys)
+{
+  for (uint32_t i = (uint32_t)0U; i < nr + (uint32_t)1U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    k = Lib_IntVector_Intrinsics_vec128_load64_le(keys + i * (uint32_t)16U);
+    rk[i] = Lib_IntVector_Intrinsics_vec256_load128s(k, k);
+  }
+}
+
+/*
+  Counter blocks are kept byte-reversed, so that the 32-bit counter is the
+  first 32-bit word of each lane and can be incremented with add32, modulo
+  2^32 as in SP 800-38D. The two lanes of the result hold counters c and c + 1.
+*/
+static inline Lib_IntVector_Intrinsics_vec256 ctr_init(uint8_t *ctr_block, uint32_t c)
+{
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_load_be(ctr_block);
+  uint32_t ctr = Lib_IntVector_Intrinsics_vec128_extract32(b, (uint32_t)0U) + c;
+  b = Lib_IntVector_Intrinsics_vec128_insert32(b, ctr, (uint32_t)0U);
+  return
+    Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_load128s(b, b),
+      Lib_IntVector_Intrinsics_vec256_load32s((uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)1U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec256 ctr_step(uint32_t n)
+{
+  return
+    Lib_IntVector_Intrinsics_vec256_load32s(n,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      n,
+      (uint32_t)0U,
+      (uint32_t)0U,
+      (uint32_t)0U);
+}
+
+/* Encrypts the counter blocks cnt, cnt + 2, ..., i.e. 2 * n consecutive blocks. */
+static inline void
+aes_encrypt_ctr(
+  uint32_t nr,
+  Lib_IntVector_Intrinsics_vec256 *rk,
+  Lib_IntVector_Intrinsics_vec256 cnt,
+  uint32_t n,
+  Lib_IntVector_Intrinsics_vec256 *st
+)
+{
+  Lib_IntVector_Intrinsics_vec256 two = ctr_step((uint32_t)2U);
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    st[j] =
+      Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_byteswap128(cnt),
+        rk[0U]);
+    cnt = Lib_IntVector_Intrinsics_vec256_add32(cnt, two);
+  }
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    Lib_IntVector_Intrinsics_vec256 k = rk[r];
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      st[j] = Lib_IntVector_Intrinsics_ni_aes_enc256(st[j], k);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    st[j] = Lib_IntVector_Intrinsics_ni_aes_enc_last256(st[j], rk[nr]);
+  }
+}
+
+/* XORs nb < 8 blocks of keystream st into in. */
+static inline void
+xor_tail(uint32_t nb, uint8_t *out, uint8_t *in, Lib_IntVector_Intrinsics_vec256 *st)
+{
+  uint32_t n2 = nb / (uint32_t)2U;
+  for (uint32_t j = (uint32_t)0U; j < n2; j++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x = Lib_IntVector_Intrinsics_vec256_load64_le(in + j * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256_store64_le(out + j * (uint32_t)32U,
+      Lib_IntVector_Intrinsics_vec256_xor(x, st[j]));
+  }
+  if (nb % (uint32_t)2U == (uint32_t)1U)
+  {
+    uint8_t *ib = in + n2 * (uint32_t)32U;
+    uint8_t *ob = out + n2 * (uint32_t)32U;
+    Lib_IntVector_Intrinsics_vec128 x = Lib_IntVector_Intrinsics_vec128_load64_le(ib);
+    Lib_IntVector_Intrinsics_vec128
+    ks = Lib_IntVector_Intrinsics_vec256_extract128(st[n2], (uint32_t)0U);
+    Lib_IntVector_Intrinsics_vec128_store64_le(ob, Lib_IntVector_Intrinsics_vec128_xor(x, ks));
+  }
+}
+
+static inline void
+aes_ctr32_(
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+)
+{
+  Lib_IntVector_Intrinsics_vec256 rk[15U];
+  for (uint32_t _i = 0U; _i < (uint32_t)15U; ++_i)
+    rk[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  load_round_keys(rk, nr, keys);
+  Lib_IntVector_Intrinsics_vec256 cnt = ctr_init(ctr_block, c);
+  Lib_IntVector_Intrinsics_vec256 eight = ctr_step((uint32_t)8U);
+  uint32_t nb = len / (uint32_t)16U;
+  uint32_t nb8 = nb / (uint32_t)8U;
+  for (uint32_t i = (uint32_t)0U; i < nb8; i++)
+  {
+    uint8_t *ib = in + i * (uint32_t)128U;
+    uint8_t *ob = out + i * (uint32_t)128U;
+    Lib_IntVector_Intrinsics_vec256 st[4U];
+    aes_encrypt_ctr(nr, rk, cnt, (uint32_t)4U, st);
+    cnt = Lib_IntVector_Intrinsics_vec256_add32(cnt, eight);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      x = Lib_IntVector_Intrinsics_vec256_load64_le(ib + j * (uint32_t)32U);
+      Lib_IntVector_Intrinsics_vec256_store64_le(ob + j * (uint32_t)32U,
+        Lib_IntVector_Intrinsics_vec256_xor(x, st[j]));
+    }
+  }
+  uint32_t rem = nb - nb8 * (uint32_t)8U;
+  if (rem > (uint32_t)0U)
+  {
+    Lib_IntVector_Intrinsics_vec256 st[4U];
+    aes_encrypt_ctr(nr, rk, cnt, (rem + (uint32_t)1U) / (uint32_t)2U, st);
+    xor_tail(rem, out + nb8 * (uint32_t)128U, in + nb8 * (uint32_t)128U, st);
+  }
+}
+
+void
+Hacl_AES_GCM_NI_Vec256_aes_ctr32(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+)
+{
+  if (len < (uint32_t)128U)
+  {
+    Hacl_AES_GCM_NI_aes_ctr32(len, out, in, nr, keys, ctr_block, c);
+    return;
+  }
+  if (nr == (uint32_t)10U)
+  {
+    aes_ctr32_((uint32_t)10U, len, out, in, keys, ctr_block, c);
+  }
+  else
+  {
+    aes_ctr32_((uint32_t)14U, len, out, in, keys, ctr_block, c);
+  }
+}
+
+/*
+  GF(2^128) arithmetic, as in Hacl_AES_GCM_NI: Karatsuba products are
+  accumulated unreduced in (lo, mid, hi), now two per vector, and the two
+  lanes are added together before the single reduction.
+*/
+static inline void
+clmul_acc(
+  Lib_IntVector_Intrinsics_vec256 *lo,
+  Lib_IntVector_Intrinsics_vec256 *mid,
+  Lib_IntVector_Intrinsics_vec256 *hi,
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 h,
+  Lib_IntVector_Intrinsics_vec256 hk
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  xk = Lib_IntVector_Intrinsics_vec256_xor(x, Lib_IntVector_Intrinsics_vec256_shift_right(x, (uint32_t)64U));
+  lo[0U] = Lib_IntVector_Intrinsics_vec256_xor(lo[0U], Lib_IntVector_Intrinsics_ni_clmul256(x, h, (uint8_t)0x00U));
+  hi[0U] = Lib_IntVector_Intrinsics_vec256_xor(hi[0U], Lib_IntVector_Intrinsics_ni_clmul256(x, h, (uint8_t)0x11U));
+  mid[0U] = Lib_IntVector_Intrinsics_vec256_xor(mid[0U], Lib_IntVector_Intrinsics_ni_clmul256(xk, hk, (uint8_t)0x00U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+reduce(Lib_IntVector_Intrinsics_vec128 lo, Lib_IntVector_Intrinsics_vec128 hi)
+{
+  Lib_IntVector_Intrinsics_vec128 c0 = Lib_IntVector_Intrinsics_vec128_shift_right32(lo, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 c1 = Lib_IntVector_Intrinsics_vec128_shift_right32(hi, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 l = Lib_IntVector_Intrinsics_vec128_shift_left32(lo, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 h = Lib_IntVector_Intrinsics_vec128_shift_left32(hi, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 c2 = Lib_IntVector_Intrinsics_vec128_shift_right(c0, (uint32_t)96U);
+  l = Lib_IntVector_Intrinsics_vec128_or(l, Lib_IntVector_Intrinsics_vec128_shift_left(c0, (uint32_t)32U));
+  h = Lib_IntVector_Intrinsics_vec128_or(h, Lib_IntVector_Intrinsics_vec128_shift_left(c1, (uint32_t)32U));
+  h = Lib_IntVector_Intrinsics_vec128_or(h, c2);
+  Lib_IntVector_Intrinsics_vec128 a = Lib_IntVector_Intrinsics_vec128_shift_left32(l, (uint32_t)31U);
+  Lib_IntVector_Intrinsics_vec128 b = Lib_IntVector_Intrinsics_vec128_shift_left32(l, (uint32_t)30U);
+  Lib_IntVector_Intrinsics_vec128 d = Lib_IntVector_Intrinsics_vec128_shift_left32(l, (uint32_t)25U);
+  a = Lib_IntVector_Intrinsics_vec128_xor(a, Lib_IntVector_Intrinsics_vec128_xor(b, d));
+  Lib_IntVector_Intrinsics_vec128 e = Lib_IntVector_Intrinsics_vec128_shift_right(a, (uint32_t)32U);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_vec128_shift_left(a, (uint32_t)96U));
+  Lib_IntVector_Intrinsics_vec128 f = Lib_IntVector_Intrinsics_vec128_shift_right32(l, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128 g = Lib_IntVector_Intrinsics_vec128_shift_right32(l, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec128 k = Lib_IntVector_Intrinsics_vec128_shift_right32(l, (uint32_t)7U);
+  f = Lib_IntVector_Intrinsics_vec128_xor(f, Lib_IntVector_Intrinsics_vec128_xor(g, k));
+  f = Lib_IntVector_Intrinsics_vec128_xor(f, e);
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, f);
+  return Lib_IntVector_Intrinsics_vec128_xor(h, l);
+}
+
+static inline Lib_IntVector_Intrinsics_vec128 sum_lanes(Lib_IntVector_Intrinsics_vec256 x)
+{
+  return
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec256_extract128(x, (uint32_t)0U),
+      Lib_IntVector_Intrinsics_vec256_extract128(x, (uint32_t)1U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+fold(
+  Lib_IntVector_Intrinsics_vec256 lo,
+  Lib_IntVector_Intrinsics_vec256 mid,
+  Lib_IntVector_Intrinsics_vec256 hi
+)
+{
+  Lib_IntVector_Intrinsics_vec128 l = sum_lanes(lo);
+  Lib_IntVector_Intrinsics_vec128 h = sum_lanes(hi);
+  Lib_IntVector_Intrinsics_vec128
+  m = Lib_IntVector_Intrinsics_vec128_xor(sum_lanes(mid), Lib_IntVector_Intrinsics_vec128_xor(l, h));
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_vec128_shift_left(m, (uint32_t)64U));
+  h = Lib_IntVector_Intrinsics_vec128_xor(h, Lib_IntVector_Intrinsics_vec128_shift_right(m, (uint32_t)64U));
+  return reduce(l, h);
+}
+
+/*
+  Two consecutive blocks x_j, x_(j+1) of a run of n blocks are multiplied by
+  H^(n-j) and H^(n-j-1) respectively; the accumulator is added to the first
+  block of the run. When n - j = 1, the second lane is empty.
+*/
+static inline void
+ghash_pair(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  uint32_t j,
+  uint8_t *b,
+  Lib_IntVector_Intrinsics_vec256 *lo,
+  Lib_IntVector_Intrinsics_vec256 *mid,
+  Lib_IntVector_Intrinsics_vec256 *hi
+)
+{
+  uint32_t p = n - j;
+  Lib_IntVector_Intrinsics_vec256 x;
+  Lib_IntVector_Intrinsics_vec256 h;
+  Lib_IntVector_Intrinsics_vec256 hk;
+  if (p == (uint32_t)1U)
+  {
+    x =
+      Lib_IntVector_Intrinsics_vec256_load128s(Lib_IntVector_Intrinsics_vec128_load_be(b),
+        Lib_IntVector_Intrinsics_vec128_zero);
+    h = Lib_IntVector_Intrinsics_vec256_load128s(ctx[1U], ctx[1U]);
+    hk = Lib_IntVector_Intrinsics_vec256_load128s(ctx[9U], ctx[9U]);
+  }
+  else
+  {
+    x =
+      Lib_IntVector_Intrinsics_vec256_byteswap128(Lib_IntVector_Intrinsics_vec256_load64_le(b));
+    h = Lib_IntVector_Intrinsics_vec256_load128s(ctx[p], ctx[p - (uint32_t)1U]);
+    hk =
+      Lib_IntVector_Intrinsics_vec256_load128s(ctx[(uint32_t)8U + p],
+        ctx[(uint32_t)7U + p]);
+  }
+  if (j == (uint32_t)0U)
+  {
+    x =
+      Lib_IntVector_Intrinsics_vec256_xor(x,
+        Lib_IntVector_Intrinsics_vec256_load128s(acc, Lib_IntVector_Intrinsics_vec128_zero));
+  }
+  clmul_acc(lo, mid, hi, x, h, hk);
+}
+
+/* acc = (acc + x_0) * H^n + x_1 * H^(n-1) + ... + x_(n-1) * H, for 1 <= n <= 8. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_run(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint32_t n,
+  uint8_t *b
+)
+{
+  Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 mid = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 hi = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t j = (uint32_t)0U; j < n; j = j + (uint32_t)2U)
+  {
+    ghash_pair(ctx, acc, n, j, b + j * (uint32_t)16U, &lo, &mid, &hi);
+  }
+  return fold(lo, mid, hi);
+}
+
+/*
+  Without AES rounds to hide behind, GHASH is bound by the latency of the
+  reduction feeding the next group, so blocks are folded sixteen at a time,
+  with H^16 ... H^9 from the second half of the table. The accumulator is
+  multiplied by H^16 on its own, after the fifteen products that do not
+  depend on it.
+*/
+static inline void
+load_powers16(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  Lib_IntVector_Intrinsics_vec256 *h,
+  Lib_IntVector_Intrinsics_vec256 *hk
+)
+{
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    h[j] =
+      Lib_IntVector_Intrinsics_vec256_load128s(ctx[(uint32_t)24U - (uint32_t)2U * j],
+        ctx[(uint32_t)23U - (uint32_t)2U * j]);
+    hk[j] =
+      Lib_IntVector_Intrinsics_vec256_load128s(ctx[(uint32_t)32U - (uint32_t)2U * j],
+        ctx[(uint32_t)31U - (uint32_t)2U * j]);
+    h[j + (uint32_t)4U] =
+      Lib_IntVector_Intrinsics_vec256_load128s(ctx[(uint32_t)8U - (uint32_t)2U * j],
+        ctx[(uint32_t)7U - (uint32_t)2U * j]);
+    hk[j + (uint32_t)4U] =
+      Lib_IntVector_Intrinsics_vec256_load128s(ctx[(uint32_t)16U - (uint32_t)2U * j],
+        ctx[(uint32_t)15U - (uint32_t)2U * j]);
+  }
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+ghash16(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  Lib_IntVector_Intrinsics_vec256 *h,
+  Lib_IntVector_Intrinsics_vec256 *hk,
+  Lib_IntVector_Intrinsics_vec128 acc,
+  uint8_t *b
+)
+{
+  Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 mid = Lib_IntVector_Intrinsics_vec256_zero;
+  Lib_IntVector_Intrinsics_vec256 hi = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x =
+      Lib_IntVector_Intrinsics_vec256_byteswap128(Lib_IntVector_Intrinsics_vec256_load64_le(b
+          + j * (uint32_t)32U));
+    clmul_acc(&lo, &mid, &hi, x, h[j], hk[j]);
+  }
+  Lib_IntVector_Intrinsics_vec128 h16 = ctx[24U];
+  Lib_IntVector_Intrinsics_vec128 l = sum_lanes(lo);
+  Lib_IntVector_Intrinsics_vec128 u = sum_lanes(hi);
+  Lib_IntVector_Intrinsics_vec128
+  m = Lib_IntVector_Intrinsics_vec128_xor(sum_lanes(mid), Lib_IntVector_Intrinsics_vec128_xor(l, u));
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_ni_clmul(acc, h16, (uint8_t)0x00U));
+  u = Lib_IntVector_Intrinsics_vec128_xor(u, Lib_IntVector_Intrinsics_ni_clmul(acc, h16, (uint8_t)0x11U));
+  m =
+    Lib_IntVector_Intrinsics_vec128_xor(m,
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_ni_clmul(acc,
+          h16,
+          (uint8_t)0x01U),
+        Lib_IntVector_Intrinsics_ni_clmul(acc, h16, (uint8_t)0x10U)));
+  l = Lib_IntVector_Intrinsics_vec128_xor(l, Lib_IntVector_Intrinsics_vec128_shift_left(m, (uint32_t)64U));
+  u = Lib_IntVector_Intrinsics_vec128_xor(u, Lib_IntVector_Intrinsics_vec128_shift_right(m, (uint32_t)64U));
+  return reduce(l, u);
+}
+
+/* Fewer than sixteen blocks, eight at a time. */
+static inline Lib_IntVector_Intrinsics_vec128
+ghash_tail(Lib_IntVector_Intrinsics_vec128 *ctx, Lib_IntVector_Intrinsics_vec128 acc, uint32_t nb, uint8_t *b)
+{
+  if (nb > (uint32_t)8U)
+  {
+    acc = ghash_run(ctx, acc, (uint32_t)8U, b);
+    nb = nb - (uint32_t)8U;
+    b = b + (uint32_t)128U;
+  }
+  if (nb > (uint32_t)0U)
+  {
+    acc = ghash_run(ctx, acc, nb, b);
+  }
+  return acc;
+}
+
+void
+Hacl_AES_GCM_NI_Vec256_gcm_update_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *text
+)
+{
+  if (len < (uint32_t)128U)
+  {
+    Hacl_AES_GCM_NI_gcm_update_blocks(ctx, len, text);
+    return;
+  }
+  Lib_IntVector_Intrinsics_vec256 h[8U];
+  Lib_IntVector_Intrinsics_vec256 hk[8U];
+  load_powers16(ctx, h, hk);
+  uint32_t nb = len / (uint32_t)16U;
+  uint32_t nb16 = nb / (uint32_t)16U;
+  Lib_IntVector_Intrinsics_vec128 acc = ctx[0U];
+  for (uint32_t i = (uint32_t)0U; i < nb16; i++)
+  {
+    acc = ghash16(ctx, h, hk, acc, text + i * (uint32_t)256U);
+  }
+  ctx[0U] = ghash_tail(ctx, acc, nb - nb16 * (uint32_t)16U, text + nb16 * (uint32_t)256U);
+}
+
+/*
+  Unlike Hacl_AES_GCM_NI_gcm_encrypt_blocks, the AES and GHASH passes are not
+  interleaved: with two blocks per instruction, a fused loop measured slower
+  than the two passes. The input goes in chunks that stay in the L1 cache
+  between the passes.
+*/
+void
+Hacl_AES_GCM_NI_Vec256_gcm_encrypt_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+)
+{
+  if (len < (uint32_t)128U)
+  {
+    Hacl_AES_GCM_NI_gcm_encrypt_blocks(ctx, len, out, in, nr, keys, ctr_block, c);
+    return;
+  }
+  for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)4096U)
+  {
+    uint32_t n = len - i;
+    if (n > (uint32_t)4096U)
+    {
+      n = (uint32_t)4096U;
+    }
+    Hacl_AES_GCM_NI_Vec256_aes_ctr32(n, out + i, in + i, nr, keys, ctr_block, c + i / (uint32_t)16U);
+    Hacl_AES_GCM_NI_Vec256_gcm_update_blocks(ctx, n, out + i);
+  }
+}
@@ -0,0 +1,83 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AES_GCM_NI_Vec256_H
+#define __Hacl_AES_GCM_NI_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+/*
+  VAES / VPCLMULQDQ versions of Hacl_AES_GCM_NI_aes_ctr32,
+  Hacl_AES_GCM_NI_gcm_update_blocks and Hacl_AES_GCM_NI_gcm_encrypt_blocks,
+  with the same arguments and results. The caller must check
+  EverCrypt_AutoConfig2_has_vaes().
+*/
+void
+Hacl_AES_GCM_NI_Vec256_aes_ctr32(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+);
+
+void
+Hacl_AES_GCM_NI_Vec256_gcm_update_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *text
+);
+
+void
+Hacl_AES_GCM_NI_Vec256_gcm_encrypt_blocks(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint32_t nr,
+  uint8_t *keys,
+  uint8_t *ctr_block,
+  uint32_t c
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_GCM_NI_Vec256_H_DEFINED
+#endif
@@ -0,0 +1,260 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#include "Hacl_Blake2_Vec256.h"
+
+static inline void
+blake2b_g4(
+  Lib_IntVector_Intrinsics_vec256 *v,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y
+)
+{
+  v[a] = Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(v[a], v[b]), x);
+  v[d] = Lib_IntVector_Intrinsics_vec256_rotate_right64_32(Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]));
+  v[c] = Lib_IntVector_Intrinsics_vec256_add64(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec256_rotate_right64_24(Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]));
+  v[a] = Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(v[a], v[b]), y);
+  v[d] = Lib_IntVector_Intrinsics_vec256_rotate_right64_16(Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]));
+  v[c] = Lib_IntVector_Intrinsics_vec256_add64(v[c], v[d]);
+  v[b] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right64(Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]),
+      (uint32_t)63U);
+}
+
+static inline void
+blake2s_g8(
+  Lib_IntVector_Intrinsics_vec256 *v,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec256 x,
+  Lib_IntVector_Intrinsics_vec256 y
+)
+{
+  v[a] = Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(v[a], v[b]), x);
+  v[d] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]),
+      (uint32_t)16U);
+  v[c] = Lib_IntVector_Intrinsics_vec256_add32(v[c], v[d]);
+  v[b] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]),
+      (uint32_t)12U);
+  v[a] = Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(v[a], v[b]), y);
+  v[d] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[d], v[a]),
+      (uint32_t)8U);
+  v[c] = Lib_IntVector_Intrinsics_vec256_add32(v[c], v[d]);
+  v[b] =
+    Lib_IntVector_Intrinsics_vec256_rotate_right32(Lib_IntVector_Intrinsics_vec256_xor(v[b], v[c]),
+      (uint32_t)7U);
+}
+
+/* Column then diagonal step of one round, with message schedule row r. */
+#define BLAKE2_ROUND(g, v, m, r)                                                \
+  {                                                                             \
+    const uint32_t *s = Hacl_Impl_Blake2_Constants_sigmaTable + (r) % (uint32_t)10U * (uint32_t)16U; \
+    g(v, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, m[s[0U]], m[s[1U]]);    \
+    g(v, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, m[s[2U]], m[s[3U]]);    \
+    g(v, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, m[s[4U]], m[s[5U]]);   \
+    g(v, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, m[s[6U]], m[s[7U]]);   \
+    g(v, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, m[s[8U]], m[s[9U]]);   \
+    g(v, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, m[s[10U]], m[s[11U]]); \
+    g(v, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, m[s[12U]], m[s[13U]]);  \
+    g(v, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, m[s[14U]], m[s[15U]]);  \
+  }
+
+/* v[i] becomes the vector of the i-th 64-bit words of the four inputs. */
+static inline void transpose4(Lib_IntVector_Intrinsics_vec256 *v)
+{
+  Lib_IntVector_Intrinsics_vec256
+  a = Lib_IntVector_Intrinsics_vec256_interleave_low64(v[0U], v[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  b = Lib_IntVector_Intrinsics_vec256_interleave_high64(v[0U], v[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  c = Lib_IntVector_Intrinsics_vec256_interleave_low64(v[2U], v[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  d = Lib_IntVector_Intrinsics_vec256_interleave_high64(v[2U], v[3U]);
+  v[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(a, c);
+  v[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(b, d);
+  v[2U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(a, c);
+  v[3U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(b, d);
+}
+
+/* v[i] becomes the vector of the i-th 32-bit words of the eight inputs. */
+static inline void transpose8(Lib_IntVector_Intrinsics_vec256 *v)
+{
+  Lib_IntVector_Intrinsics_vec256 a[8U];
+  Lib_IntVector_Intrinsics_vec256 b[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    a[2U * i] = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[2U * i], v[2U * i + (uint32_t)1U]);
+    a[2U * i + (uint32_t)1U] =
+      Lib_IntVector_Intrinsics_vec256_interleave_high32(v[2U * i], v[2U * i + (uint32_t)1U]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)2U; i++)
+  {
+    uint32_t j = (uint32_t)4U * i;
+    b[j] = Lib_IntVector_Intrinsics_vec256_interleave_low64(a[j], a[j + (uint32_t)2U]);
+    b[j + (uint32_t)1U] = Lib_IntVector_Intrinsics_vec256_interleave_high64(a[j], a[j + (uint32_t)2U]);
+    b[j + (uint32_t)2U] =
+      Lib_IntVector_Intrinsics_vec256_interleave_low64(a[j + (uint32_t)1U], a[j + (uint32_t)3U]);
+    b[j + (uint32_t)3U] =
+      Lib_IntVector_Intrinsics_vec256_interleave_high64(a[j + (uint32_t)1U], a[j + (uint32_t)3U]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    v[i] = Lib_IntVector_Intrinsics_vec256_interleave_low128(b[i], b[i + (uint32_t)4U]);
+    v[i + (uint32_t)4U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(b[i], b[i + (uint32_t)4U]);
+  }
+}
+
+void
+Hacl_Blake2_Vec256_blake2b_update_4x(
+  uint64_t *leaves,
+  uint64_t prev,
+  uint8_t *stripes,
+  uint32_t n
+)
+{
+  /* h[0..7] are the chaining values, h[8..15] the IV rows of the four leaves */
+  Lib_IntVector_Intrinsics_vec256 h[16U];
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)16U; k++)
+  {
+    h[k] =
+      Lib_IntVector_Intrinsics_vec256_load64s(leaves[k],
+        leaves[(uint32_t)16U + k],
+        leaves[(uint32_t)32U + k],
+        leaves[(uint32_t)48U + k]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t *b = stripes + i * (uint32_t)512U;
+    Lib_IntVector_Intrinsics_vec256 m[16U];
+    for (uint32_t q = (uint32_t)0U; q < (uint32_t)4U; q++)
+    {
+      Lib_IntVector_Intrinsics_vec256 *mq = m + (uint32_t)4U * q;
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+      {
+        mq[j] = Lib_IntVector_Intrinsics_vec256_load64_le(b + j * (uint32_t)128U + q * (uint32_t)32U);
+      }
+      transpose4(mq);
+    }
+    Lib_IntVector_Intrinsics_vec256 v[16U];
+    memcpy(v, h, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    uint64_t totlen = prev + (uint64_t)((i + (uint32_t)1U) * (uint32_t)128U);
+    v[12U] = Lib_IntVector_Intrinsics_vec256_xor(v[12U], Lib_IntVector_Intrinsics_vec256_load64(totlen));
+    for (uint32_t r = (uint32_t)0U; r < (uint32_t)12U; r++)
+    {
+      BLAKE2_ROUND(blake2b_g4, v, m, r);
+    }
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+    {
+      h[k] =
+        Lib_IntVector_Intrinsics_vec256_xor(h[k],
+          Lib_IntVector_Intrinsics_vec256_xor(v[k], v[k + (uint32_t)8U]));
+    }
+  }
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+  {
+    leaves[k] = Lib_IntVector_Intrinsics_vec256_extract64(h[k], 0);
+    leaves[(uint32_t)16U + k] = Lib_IntVector_Intrinsics_vec256_extract64(h[k], 1);
+    leaves[(uint32_t)32U + k] = Lib_IntVector_Intrinsics_vec256_extract64(h[k], 2);
+    leaves[(uint32_t)48U + k] = Lib_IntVector_Intrinsics_vec256_extract64(h[k], 3);
+  }
+}
+
+void
+Hacl_Blake2_Vec256_blake2s_update_8x(
+  uint32_t *leaves,
+  uint64_t prev,
+  uint8_t *stripes,
+  uint32_t n
+)
+{
+  Lib_IntVector_Intrinsics_vec256 h[16U];
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)16U; k++)
+  {
+    h[k] =
+      Lib_IntVector_Intrinsics_vec256_load32s(leaves[k],
+        leaves[(uint32_t)16U + k],
+        leaves[(uint32_t)32U + k],
+        leaves[(uint32_t)48U + k],
+        leaves[(uint32_t)64U + k],
+        leaves[(uint32_t)80U + k],
+        leaves[(uint32_t)96U + k],
+        leaves[(uint32_t)112U + k]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t *b = stripes + i * (uint32_t)512U;
+    Lib_IntVector_Intrinsics_vec256 m[16U];
+    for (uint32_t q = (uint32_t)0U; q < (uint32_t)2U; q++)
+    {
+      Lib_IntVector_Intrinsics_vec256 *mq = m + (uint32_t)8U * q;
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        mq[j] = Lib_IntVector_Intrinsics_vec256_load32_le(b + j * (uint32_t)64U + q * (uint32_t)32U);
+      }
+      transpose8(mq);
+    }
+    Lib_IntVector_Intrinsics_vec256 v[16U];
+    memcpy(v, h, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    uint64_t totlen = prev + (uint64_t)((i + (uint32_t)1U) * (uint32_t)64U);
+    v[12U] =
+      Lib_IntVector_Intrinsics_vec256_xor(v[12U],
+        Lib_IntVector_Intrinsics_vec256_load32((uint32_t)totlen));
+    v[13U] =
+      Lib_IntVector_Intrinsics_vec256_xor(v[13U],
+        Lib_IntVector_Intrinsics_vec256_load32((uint32_t)(totlen >> (uint32_t)32U)));
+    for (uint32_t r = (uint32_t)0U; r < (uint32_t)10U; r++)
+    {
+      BLAKE2_ROUND(blake2s_g8, v, m, r);
+    }
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+    {
+      h[k] =
+        Lib_IntVector_Intrinsics_vec256_xor(h[k],
+          Lib_IntVector_Intrinsics_vec256_xor(v[k], v[k + (uint32_t)8U]));
+    }
+  }
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+  {
+    leaves[k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 0);
+    leaves[(uint32_t)16U + k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 1);
+    leaves[(uint32_t)32U + k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 2);
+    leaves[(uint32_t)48U + k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 3);
+    leaves[(uint32_t)64U + k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 4);
+    leaves[(uint32_t)80U + k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 5);
+    leaves[(uint32_t)96U + k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 6);
+    leaves[(uint32_t)112U + k] = (uint32_t)Lib_IntVector_Intrinsics_vec256_extract32(h[k], 7);
+  }
+}
@@ -0,0 +1,76 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Blake2_Vec256_H
+#define __Hacl_Blake2_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Impl_Blake2_Constants.h"
+
+/*
+  Multi-leaf BLAKE2 compression for the BLAKE2bp and BLAKE2sp modes of
+  Hacl_Streaming_Blake2, which dispatches to these functions. The leaves are
+  consecutive Hacl_Blake2b_32 (resp. Hacl_Blake2s_32) states of 16 words; each
+  leaf runs in one 64-bit (resp. 32-bit) lane of a vec256.
+
+  A stripe is 512 bytes: block i of the stripe goes to leaf i. All n stripes are
+  compressed as non-final blocks, and every leaf is assumed to have already
+  absorbed prev bytes.
+*/
+
+void
+Hacl_Blake2_Vec256_blake2b_update_4x(
+  uint64_t *leaves,
+  uint64_t prev,
+  uint8_t *stripes,
+  uint32_t n
+);
+
+void
+Hacl_Blake2_Vec256_blake2s_update_8x(
+  uint32_t *leaves,
+  uint64_t prev,
+  uint8_t *stripes,
+  uint32_t n
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Blake2_Vec256_H_DEFINED
+#endif
@@ -0,0 +1,120 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Chacha20Poly1305_512.h"
+
+static inline void
+poly1305_padded_512(Lib_IntVector_Intrinsics_vec512 *ctx, uint32_t len, uint8_t *text)
+{
+  uint32_t n = len / (uint32_t)16U;
+  uint32_t r = len % (uint32_t)16U;
+  uint8_t *blocks = text;
+  uint8_t *rem = text + n * (uint32_t)16U;
+  Hacl_Poly1305_512_poly1305_update(ctx, n * (uint32_t)16U, blocks);
+  uint8_t tmp[16U] = { 0U };
+  memcpy(tmp, rem, r * sizeof (uint8_t));
+  if (r > (uint32_t)0U)
+  {
+    Hacl_Poly1305_512_poly1305_update1(ctx, tmp);
+    return;
+  }
+}
+
+static inline void
+poly1305_do_512(
+  uint8_t *k,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *out
+)
+{
+  Lib_IntVector_Intrinsics_vec512 ctx[30U];
+  for (uint32_t _i = 0U; _i < (uint32_t)30U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  uint8_t block[16U] = { 0U };
+  Hacl_Poly1305_512_poly1305_init(ctx, k);
+  if (aadlen != (uint32_t)0U)
+  {
+    poly1305_padded_512(ctx, aadlen, aad);
+  }
+  poly1305_padded_512(ctx, mlen, m);
+  store64_le(block, (uint64_t)aadlen);
+  store64_le(block + (uint32_t)8U, (uint64_t)mlen);
+  Hacl_Poly1305_512_poly1305_update1(ctx, block);
+  Hacl_Poly1305_512_poly1305_finish(out, k, ctx);
+}
+
+void
+Hacl_Chacha20Poly1305_512_aead_encrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+)
+{
+  Hacl_Chacha20_Vec512_chacha20_encrypt_512(mlen, cipher, m, k, n, (uint32_t)1U);
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec512_chacha20_encrypt_512((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_512(key, aadlen, aad, mlen, cipher, mac);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_512_aead_decrypt(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+)
+{
+  uint8_t computed_mac[16U] = { 0U };
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec512_chacha20_encrypt_512((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  poly1305_do_512(key, aadlen, aad, mlen, cipher, computed_mac);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_mac[i], mac[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(mlen, m, cipher, k, n, (uint32_t)1U);
+    return (uint32_t)0U;
+  }
+  return (uint32_t)1U;
+}
+
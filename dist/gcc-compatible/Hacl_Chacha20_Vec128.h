@@ -60,6 +60,14 @@ Hacl_Chacha20_Vec128_chacha20_decrypt_128(
   uint32_t ctr
 );
 
+/*
+  Computes 4 independent keystream blocks under key: block i (written to
+  out + 64 * i) starts from state words 12..15 loaded from the 16 bytes at
+  ivs + 16 * i, i.e. a 32-bit little-endian counter followed by the 96-bit
+  nonce, as in a QUIC header-protection sample.
+*/
+void Hacl_Chacha20_Vec128_chacha20_lanes_128(uint8_t *out, uint8_t *key, uint8_t *ivs);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -891,3 +891,51 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   }
 }
 
+void Hacl_Chacha20_Vec256_chacha20_lanes_256(uint8_t *out, uint8_t *key, uint8_t *ivs)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint8_t n[12U] = { 0U };
+  chacha20_init_256(ctx, key, n, (uint32_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *w = ivs + i * (uint32_t)4U;
+    ctx[(uint32_t)12U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(w),
+        load32_le(w + (uint32_t)16U),
+        load32_le(w + (uint32_t)32U),
+        load32_le(w + (uint32_t)48U),
+        load32_le(w + (uint32_t)64U),
+        load32_le(w + (uint32_t)80U),
+        load32_le(w + (uint32_t)96U),
+        load32_le(w + (uint32_t)112U));
+  }
+  Lib_IntVector_Intrinsics_vec256 k[16U];
+  memcpy(k, ctx, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  uint8_t tmp[512U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add32(k[i], ctx[i]);
+    Lib_IntVector_Intrinsics_vec256_store32_le(tmp + i * (uint32_t)32U, x);
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      memcpy(out + j * (uint32_t)64U + i * (uint32_t)4U,
+        tmp + i * (uint32_t)32U + j * (uint32_t)4U,
+        (uint32_t)4U * sizeof (uint8_t));
+    }
+  }
+}
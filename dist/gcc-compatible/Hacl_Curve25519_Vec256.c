@@ -0,0 +1,659 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Curve25519_Vec256.h"
+
+/*
+  Four independent X25519 ladders, one per 64-bit lane of a vec256. A field
+  element is ten vectors of limbs in radix 2^25.5 (26, 25, 26, ... bits), so
+  every limb product fits the 32x32->64 lane multiplier.
+
+  Reduced limbs are below 2^26 (even positions) and 2^25 (odd positions), up to
+  a small carry in limbs 1 and 5. fadd4 and fsub4 take reduced inputs and give
+  limbs below 2^27 and 3 * 2^26 respectively. fmul4 and fsqr4 accept either
+  as their first operand; the second operand of fmul4 must be reduced or a sum,
+  so that 19 times a limb still fits in 32 bits. Every 64-bit column sum then
+  stays below 2^63. fmul4, fsqr4 and fmul_a24 return reduced limbs.
+*/
+
+static inline Lib_IntVector_Intrinsics_vec256 times19(Lib_IntVector_Intrinsics_vec256 x)
+{
+  Lib_IntVector_Intrinsics_vec256
+  x16 = Lib_IntVector_Intrinsics_vec256_shift_left64(x, (uint32_t)4U);
+  Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_shift_left64(x, (uint32_t)1U);
+  return
+    Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(x16, x2),
+      x);
+}
+
+static inline void
+carry_step(Lib_IntVector_Intrinsics_vec256 *h, uint32_t i, uint32_t bits)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_load64(((uint64_t)1U << bits) - (uint64_t)1U);
+  Lib_IntVector_Intrinsics_vec256 c = Lib_IntVector_Intrinsics_vec256_shift_right64(h[i], bits);
+  h[i] = Lib_IntVector_Intrinsics_vec256_and(h[i], mask);
+  if (i == (uint32_t)9U)
+  {
+    h[0U] = Lib_IntVector_Intrinsics_vec256_add64(h[0U], times19(c));
+  }
+  else
+  {
+    h[i + (uint32_t)1U] = Lib_IntVector_Intrinsics_vec256_add64(h[i + (uint32_t)1U], c);
+  }
+}
+
+/* Two interleaved carry chains (0..4 and 4..9), then the wrap from limb 9. */
+static inline void
+carry_wide(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *h)
+{
+  carry_step(h, (uint32_t)0U, (uint32_t)26U);
+  carry_step(h, (uint32_t)4U, (uint32_t)26U);
+  carry_step(h, (uint32_t)1U, (uint32_t)25U);
+  carry_step(h, (uint32_t)5U, (uint32_t)25U);
+  carry_step(h, (uint32_t)2U, (uint32_t)26U);
+  carry_step(h, (uint32_t)6U, (uint32_t)26U);
+  carry_step(h, (uint32_t)3U, (uint32_t)25U);
+  carry_step(h, (uint32_t)7U, (uint32_t)25U);
+  carry_step(h, (uint32_t)4U, (uint32_t)26U);
+  carry_step(h, (uint32_t)8U, (uint32_t)26U);
+  carry_step(h, (uint32_t)9U, (uint32_t)25U);
+  carry_step(h, (uint32_t)0U, (uint32_t)26U);
+  memcpy(out, h, (uint32_t)10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+static inline void
+fadd4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    out[i] = Lib_IntVector_Intrinsics_vec256_add64(a[i], b[i]);
+  }
+}
+
+/* a + 2p - b */
+static inline void
+fsub4(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  p0 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7ffffdaU);
+  Lib_IntVector_Intrinsics_vec256
+  p_even = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7fffffeU);
+  Lib_IntVector_Intrinsics_vec256
+  p_odd = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffeU);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 p;
+    if (i == (uint32_t)0U)
+    {
+      p = p0;
+    }
+    else if (i % (uint32_t)2U == (uint32_t)0U)
+    {
+      p = p_even;
+    }
+    else
+    {
+      p = p_odd;
+    }
+    out[i] =
+      Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(a[i], p),
+        b[i]);
+  }
+}
+
+static inline void
+fmul4(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f, Lib_IntVector_Intrinsics_vec256 *g)
+{
+  Lib_IntVector_Intrinsics_vec256 f0 = f[0U];
+  Lib_IntVector_Intrinsics_vec256 f1 = f[1U];
+  Lib_IntVector_Intrinsics_vec256 f2 = f[2U];
+  Lib_IntVector_Intrinsics_vec256 f3 = f[3U];
+  Lib_IntVector_Intrinsics_vec256 f4 = f[4U];
+  Lib_IntVector_Intrinsics_vec256 f5 = f[5U];
+  Lib_IntVector_Intrinsics_vec256 f6 = f[6U];
+  Lib_IntVector_Intrinsics_vec256 f7 = f[7U];
+  Lib_IntVector_Intrinsics_vec256 f8 = f[8U];
+  Lib_IntVector_Intrinsics_vec256 f9 = f[9U];
+  Lib_IntVector_Intrinsics_vec256 g0 = g[0U];
+  Lib_IntVector_Intrinsics_vec256 g1 = g[1U];
+  Lib_IntVector_Intrinsics_vec256 g2 = g[2U];
+  Lib_IntVector_Intrinsics_vec256 g3 = g[3U];
+  Lib_IntVector_Intrinsics_vec256 g4 = g[4U];
+  Lib_IntVector_Intrinsics_vec256 g5 = g[5U];
+  Lib_IntVector_Intrinsics_vec256 g6 = g[6U];
+  Lib_IntVector_Intrinsics_vec256 g7 = g[7U];
+  Lib_IntVector_Intrinsics_vec256 g8 = g[8U];
+  Lib_IntVector_Intrinsics_vec256 g9 = g[9U];
+  Lib_IntVector_Intrinsics_vec256 f12 = Lib_IntVector_Intrinsics_vec256_shift_left64(f1, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 f32 = Lib_IntVector_Intrinsics_vec256_shift_left64(f3, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 f52 = Lib_IntVector_Intrinsics_vec256_shift_left64(f5, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 f72 = Lib_IntVector_Intrinsics_vec256_shift_left64(f7, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 f92 = Lib_IntVector_Intrinsics_vec256_shift_left64(f9, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 g119 = Lib_IntVector_Intrinsics_vec256_smul64(g1, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g219 = Lib_IntVector_Intrinsics_vec256_smul64(g2, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g319 = Lib_IntVector_Intrinsics_vec256_smul64(g3, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g419 = Lib_IntVector_Intrinsics_vec256_smul64(g4, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g519 = Lib_IntVector_Intrinsics_vec256_smul64(g5, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g619 = Lib_IntVector_Intrinsics_vec256_smul64(g6, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g719 = Lib_IntVector_Intrinsics_vec256_smul64(g7, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g819 = Lib_IntVector_Intrinsics_vec256_smul64(g8, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 g919 = Lib_IntVector_Intrinsics_vec256_smul64(g9, (uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 h[10U];
+  Lib_IntVector_Intrinsics_vec256 h0 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g0);
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f12, g919));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f2, g819));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f32, g719));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f4, g619));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f52, g519));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f6, g419));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f72, g319));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f8, g219));
+  h0 = Lib_IntVector_Intrinsics_vec256_add64(h0, Lib_IntVector_Intrinsics_vec256_mul64(f92, g119));
+  h[0U] = h0;
+  Lib_IntVector_Intrinsics_vec256 h1 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g1);
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f1, g0));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f2, g919));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f3, g819));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f4, g719));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f5, g619));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f6, g519));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f7, g419));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f8, g319));
+  h1 = Lib_IntVector_Intrinsics_vec256_add64(h1, Lib_IntVector_Intrinsics_vec256_mul64(f9, g219));
+  h[1U] = h1;
+  Lib_IntVector_Intrinsics_vec256 h2 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g2);
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f12, g1));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f2, g0));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f32, g919));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f4, g819));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f52, g719));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f6, g619));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f72, g519));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f8, g419));
+  h2 = Lib_IntVector_Intrinsics_vec256_add64(h2, Lib_IntVector_Intrinsics_vec256_mul64(f92, g319));
+  h[2U] = h2;
+  Lib_IntVector_Intrinsics_vec256 h3 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g3);
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f1, g2));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f2, g1));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f3, g0));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f4, g919));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f5, g819));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f6, g719));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f7, g619));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f8, g519));
+  h3 = Lib_IntVector_Intrinsics_vec256_add64(h3, Lib_IntVector_Intrinsics_vec256_mul64(f9, g419));
+  h[3U] = h3;
+  Lib_IntVector_Intrinsics_vec256 h4 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g4);
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f12, g3));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f2, g2));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f32, g1));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f4, g0));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f52, g919));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f6, g819));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f72, g719));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f8, g619));
+  h4 = Lib_IntVector_Intrinsics_vec256_add64(h4, Lib_IntVector_Intrinsics_vec256_mul64(f92, g519));
+  h[4U] = h4;
+  Lib_IntVector_Intrinsics_vec256 h5 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g5);
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f1, g4));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f2, g3));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f3, g2));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f4, g1));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f5, g0));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f6, g919));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f7, g819));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f8, g719));
+  h5 = Lib_IntVector_Intrinsics_vec256_add64(h5, Lib_IntVector_Intrinsics_vec256_mul64(f9, g619));
+  h[5U] = h5;
+  Lib_IntVector_Intrinsics_vec256 h6 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g6);
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f12, g5));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f2, g4));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f32, g3));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f4, g2));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f52, g1));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f6, g0));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f72, g919));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f8, g819));
+  h6 = Lib_IntVector_Intrinsics_vec256_add64(h6, Lib_IntVector_Intrinsics_vec256_mul64(f92, g719));
+  h[6U] = h6;
+  Lib_IntVector_Intrinsics_vec256 h7 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g7);
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f1, g6));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f2, g5));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f3, g4));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f4, g3));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f5, g2));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f6, g1));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f7, g0));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f8, g919));
+  h7 = Lib_IntVector_Intrinsics_vec256_add64(h7, Lib_IntVector_Intrinsics_vec256_mul64(f9, g819));
+  h[7U] = h7;
+  Lib_IntVector_Intrinsics_vec256 h8 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g8);
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f12, g7));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f2, g6));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f32, g5));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f4, g4));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f52, g3));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f6, g2));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f72, g1));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f8, g0));
+  h8 = Lib_IntVector_Intrinsics_vec256_add64(h8, Lib_IntVector_Intrinsics_vec256_mul64(f92, g919));
+  h[8U] = h8;
+  Lib_IntVector_Intrinsics_vec256 h9 = Lib_IntVector_Intrinsics_vec256_mul64(f0, g9);
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f1, g8));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f2, g7));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f3, g6));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f4, g5));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f5, g4));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f6, g3));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f7, g2));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f8, g1));
+  h9 = Lib_IntVector_Intrinsics_vec256_add64(h9, Lib_IntVector_Intrinsics_vec256_mul64(f9, g0));
+  h[9U] = h9;
+  carry_wide(out, h);
+}
+
+static inline void
+fsqr4(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 f0 = f[0U];
+  Lib_IntVector_Intrinsics_vec256 f1 = f[1U];
+  Lib_IntVector_Intrinsics_vec256 f2 = f[2U];
+  Lib_IntVector_Intrinsics_vec256 f3 = f[3U];
+  Lib_IntVector_Intrinsics_vec256 f4 = f[4U];
+  Lib_IntVector_Intrinsics_vec256 f5 = f[5U];
+  Lib_IntVector_Intrinsics_vec256 f6 = f[6U];
+  Lib_IntVector_Intrinsics_vec256 f7 = f[7U];
+  Lib_IntVector_Intrinsics_vec256 f8 = f[8U];
+  Lib_IntVector_Intrinsics_vec256 f9 = f[9U];
+  Lib_IntVector_Intrinsics_vec256 d0 = Lib_IntVector_Intrinsics_vec256_shift_left64(f0, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d1 = Lib_IntVector_Intrinsics_vec256_shift_left64(f1, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f2, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d3 = Lib_IntVector_Intrinsics_vec256_shift_left64(f3, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f4, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d5 = Lib_IntVector_Intrinsics_vec256_shift_left64(f5, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d6 = Lib_IntVector_Intrinsics_vec256_shift_left64(f6, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d7 = Lib_IntVector_Intrinsics_vec256_shift_left64(f7, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d8 = Lib_IntVector_Intrinsics_vec256_shift_left64(f8, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 d9 = Lib_IntVector_Intrinsics_vec256_shift_left64(f9, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 lo0 = Lib_IntVector_Intrinsics_vec256_mul64(f0, f0);
+  Lib_IntVector_Intrinsics_vec256 hi0 = Lib_IntVector_Intrinsics_vec256_mul64(d1, d9);
+  hi0 = Lib_IntVector_Intrinsics_vec256_add64(hi0, Lib_IntVector_Intrinsics_vec256_mul64(d2, f8));
+  hi0 = Lib_IntVector_Intrinsics_vec256_add64(hi0, Lib_IntVector_Intrinsics_vec256_mul64(d3, d7));
+  hi0 = Lib_IntVector_Intrinsics_vec256_add64(hi0, Lib_IntVector_Intrinsics_vec256_mul64(d4, f6));
+  hi0 = Lib_IntVector_Intrinsics_vec256_add64(hi0, Lib_IntVector_Intrinsics_vec256_mul64(f5, d5));
+  Lib_IntVector_Intrinsics_vec256 lo1 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f1);
+  Lib_IntVector_Intrinsics_vec256 hi1 = Lib_IntVector_Intrinsics_vec256_mul64(d2, f9);
+  hi1 = Lib_IntVector_Intrinsics_vec256_add64(hi1, Lib_IntVector_Intrinsics_vec256_mul64(d3, f8));
+  hi1 = Lib_IntVector_Intrinsics_vec256_add64(hi1, Lib_IntVector_Intrinsics_vec256_mul64(d4, f7));
+  hi1 = Lib_IntVector_Intrinsics_vec256_add64(hi1, Lib_IntVector_Intrinsics_vec256_mul64(d5, f6));
+  Lib_IntVector_Intrinsics_vec256 lo2 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f2);
+  lo2 = Lib_IntVector_Intrinsics_vec256_add64(lo2, Lib_IntVector_Intrinsics_vec256_mul64(f1, d1));
+  Lib_IntVector_Intrinsics_vec256 hi2 = Lib_IntVector_Intrinsics_vec256_mul64(d3, d9);
+  hi2 = Lib_IntVector_Intrinsics_vec256_add64(hi2, Lib_IntVector_Intrinsics_vec256_mul64(d4, f8));
+  hi2 = Lib_IntVector_Intrinsics_vec256_add64(hi2, Lib_IntVector_Intrinsics_vec256_mul64(d5, d7));
+  hi2 = Lib_IntVector_Intrinsics_vec256_add64(hi2, Lib_IntVector_Intrinsics_vec256_mul64(f6, f6));
+  Lib_IntVector_Intrinsics_vec256 lo3 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f3);
+  lo3 = Lib_IntVector_Intrinsics_vec256_add64(lo3, Lib_IntVector_Intrinsics_vec256_mul64(d1, f2));
+  Lib_IntVector_Intrinsics_vec256 hi3 = Lib_IntVector_Intrinsics_vec256_mul64(d4, f9);
+  hi3 = Lib_IntVector_Intrinsics_vec256_add64(hi3, Lib_IntVector_Intrinsics_vec256_mul64(d5, f8));
+  hi3 = Lib_IntVector_Intrinsics_vec256_add64(hi3, Lib_IntVector_Intrinsics_vec256_mul64(d6, f7));
+  Lib_IntVector_Intrinsics_vec256 lo4 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f4);
+  lo4 = Lib_IntVector_Intrinsics_vec256_add64(lo4, Lib_IntVector_Intrinsics_vec256_mul64(d1, d3));
+  lo4 = Lib_IntVector_Intrinsics_vec256_add64(lo4, Lib_IntVector_Intrinsics_vec256_mul64(f2, f2));
+  Lib_IntVector_Intrinsics_vec256 hi4 = Lib_IntVector_Intrinsics_vec256_mul64(d5, d9);
+  hi4 = Lib_IntVector_Intrinsics_vec256_add64(hi4, Lib_IntVector_Intrinsics_vec256_mul64(d6, f8));
+  hi4 = Lib_IntVector_Intrinsics_vec256_add64(hi4, Lib_IntVector_Intrinsics_vec256_mul64(f7, d7));
+  Lib_IntVector_Intrinsics_vec256 lo5 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f5);
+  lo5 = Lib_IntVector_Intrinsics_vec256_add64(lo5, Lib_IntVector_Intrinsics_vec256_mul64(d1, f4));
+  lo5 = Lib_IntVector_Intrinsics_vec256_add64(lo5, Lib_IntVector_Intrinsics_vec256_mul64(d2, f3));
+  Lib_IntVector_Intrinsics_vec256 hi5 = Lib_IntVector_Intrinsics_vec256_mul64(d6, f9);
+  hi5 = Lib_IntVector_Intrinsics_vec256_add64(hi5, Lib_IntVector_Intrinsics_vec256_mul64(d7, f8));
+  Lib_IntVector_Intrinsics_vec256 lo6 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f6);
+  lo6 = Lib_IntVector_Intrinsics_vec256_add64(lo6, Lib_IntVector_Intrinsics_vec256_mul64(d1, d5));
+  lo6 = Lib_IntVector_Intrinsics_vec256_add64(lo6, Lib_IntVector_Intrinsics_vec256_mul64(d2, f4));
+  lo6 = Lib_IntVector_Intrinsics_vec256_add64(lo6, Lib_IntVector_Intrinsics_vec256_mul64(f3, d3));
+  Lib_IntVector_Intrinsics_vec256 hi6 = Lib_IntVector_Intrinsics_vec256_mul64(d7, d9);
+  hi6 = Lib_IntVector_Intrinsics_vec256_add64(hi6, Lib_IntVector_Intrinsics_vec256_mul64(f8, f8));
+  Lib_IntVector_Intrinsics_vec256 lo7 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f7);
+  lo7 = Lib_IntVector_Intrinsics_vec256_add64(lo7, Lib_IntVector_Intrinsics_vec256_mul64(d1, f6));
+  lo7 = Lib_IntVector_Intrinsics_vec256_add64(lo7, Lib_IntVector_Intrinsics_vec256_mul64(d2, f5));
+  lo7 = Lib_IntVector_Intrinsics_vec256_add64(lo7, Lib_IntVector_Intrinsics_vec256_mul64(d3, f4));
+  Lib_IntVector_Intrinsics_vec256 hi7 = Lib_IntVector_Intrinsics_vec256_mul64(d8, f9);
+  Lib_IntVector_Intrinsics_vec256 lo8 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f8);
+  lo8 = Lib_IntVector_Intrinsics_vec256_add64(lo8, Lib_IntVector_Intrinsics_vec256_mul64(d1, d7));
+  lo8 = Lib_IntVector_Intrinsics_vec256_add64(lo8, Lib_IntVector_Intrinsics_vec256_mul64(d2, f6));
+  lo8 = Lib_IntVector_Intrinsics_vec256_add64(lo8, Lib_IntVector_Intrinsics_vec256_mul64(d3, d5));
+  lo8 = Lib_IntVector_Intrinsics_vec256_add64(lo8, Lib_IntVector_Intrinsics_vec256_mul64(f4, f4));
+  Lib_IntVector_Intrinsics_vec256 hi8 = Lib_IntVector_Intrinsics_vec256_mul64(f9, d9);
+  Lib_IntVector_Intrinsics_vec256 lo9 = Lib_IntVector_Intrinsics_vec256_mul64(d0, f9);
+  lo9 = Lib_IntVector_Intrinsics_vec256_add64(lo9, Lib_IntVector_Intrinsics_vec256_mul64(d1, f8));
+  lo9 = Lib_IntVector_Intrinsics_vec256_add64(lo9, Lib_IntVector_Intrinsics_vec256_mul64(d2, f7));
+  lo9 = Lib_IntVector_Intrinsics_vec256_add64(lo9, Lib_IntVector_Intrinsics_vec256_mul64(d3, f6));
+  lo9 = Lib_IntVector_Intrinsics_vec256_add64(lo9, Lib_IntVector_Intrinsics_vec256_mul64(d4, f5));
+  Lib_IntVector_Intrinsics_vec256 h[10U];
+  h[0U] = Lib_IntVector_Intrinsics_vec256_add64(lo0, times19(hi0));
+  h[1U] = Lib_IntVector_Intrinsics_vec256_add64(lo1, times19(hi1));
+  h[2U] = Lib_IntVector_Intrinsics_vec256_add64(lo2, times19(hi2));
+  h[3U] = Lib_IntVector_Intrinsics_vec256_add64(lo3, times19(hi3));
+  h[4U] = Lib_IntVector_Intrinsics_vec256_add64(lo4, times19(hi4));
+  h[5U] = Lib_IntVector_Intrinsics_vec256_add64(lo5, times19(hi5));
+  h[6U] = Lib_IntVector_Intrinsics_vec256_add64(lo6, times19(hi6));
+  h[7U] = Lib_IntVector_Intrinsics_vec256_add64(lo7, times19(hi7));
+  h[8U] = Lib_IntVector_Intrinsics_vec256_add64(lo8, times19(hi8));
+  h[9U] = lo9;
+  carry_wide(out, h);
+}
+
+static inline void
+fsqr4_n(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f, uint32_t n)
+{
+  fsqr4(out, f);
+  for (uint32_t i = (uint32_t)1U; i < n; i++)
+  {
+    fsqr4(out, out);
+  }
+}
+
+/* 121665 * f */
+static inline void fmul_a24(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 h[10U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec256_smul64(f[i], (uint64_t)121665U);
+  }
+  carry_wide(out, h);
+}
+
+/* f^(p - 2), with the usual 254 squarings and 11 multiplications. */
+static inline void finv4(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *z)
+{
+  Lib_IntVector_Intrinsics_vec256 z2[10U];
+  Lib_IntVector_Intrinsics_vec256 z9[10U];
+  Lib_IntVector_Intrinsics_vec256 z11[10U];
+  Lib_IntVector_Intrinsics_vec256 z2_5_0[10U];
+  Lib_IntVector_Intrinsics_vec256 z2_10_0[10U];
+  Lib_IntVector_Intrinsics_vec256 z2_20_0[10U];
+  Lib_IntVector_Intrinsics_vec256 z2_50_0[10U];
+  Lib_IntVector_Intrinsics_vec256 z2_100_0[10U];
+  Lib_IntVector_Intrinsics_vec256 t[10U];
+  fsqr4(z2, z);
+  fsqr4_n(t, z2, (uint32_t)2U);
+  fmul4(z9, t, z);
+  fmul4(z11, z9, z2);
+  fsqr4(t, z11);
+  fmul4(z2_5_0, t, z9);
+  fsqr4_n(t, z2_5_0, (uint32_t)5U);
+  fmul4(z2_10_0, t, z2_5_0);
+  fsqr4_n(t, z2_10_0, (uint32_t)10U);
+  fmul4(z2_20_0, t, z2_10_0);
+  fsqr4_n(t, z2_20_0, (uint32_t)20U);
+  fmul4(t, t, z2_20_0);
+  fsqr4_n(t, t, (uint32_t)10U);
+  fmul4(z2_50_0, t, z2_10_0);
+  fsqr4_n(t, z2_50_0, (uint32_t)50U);
+  fmul4(z2_100_0, t, z2_50_0);
+  fsqr4_n(t, z2_100_0, (uint32_t)100U);
+  fmul4(t, t, z2_100_0);
+  fsqr4_n(t, t, (uint32_t)50U);
+  fmul4(t, t, z2_50_0);
+  fsqr4_n(t, t, (uint32_t)5U);
+  fmul4(out, t, z11);
+}
+
+static inline void
+cswap4(
+  Lib_IntVector_Intrinsics_vec256 mask,
+  Lib_IntVector_Intrinsics_vec256 *a,
+  Lib_IntVector_Intrinsics_vec256 *b
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    t =
+      Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_xor(a[i], b[i]),
+        mask);
+    a[i] = Lib_IntVector_Intrinsics_vec256_xor(a[i], t);
+    b[i] = Lib_IntVector_Intrinsics_vec256_xor(b[i], t);
+  }
+}
+
+static inline void decode_point(uint64_t *f, uint8_t *s)
+{
+  f[0U] = (uint64_t)load32_le(s) & (uint64_t)0x3ffffffU;
+  f[1U] = (uint64_t)(load32_le(s + (uint32_t)3U) >> (uint32_t)2U) & (uint64_t)0x1ffffffU;
+  f[2U] = (uint64_t)(load32_le(s + (uint32_t)6U) >> (uint32_t)3U) & (uint64_t)0x3ffffffU;
+  f[3U] = (uint64_t)(load32_le(s + (uint32_t)9U) >> (uint32_t)5U) & (uint64_t)0x1ffffffU;
+  f[4U] = (uint64_t)(load32_le(s + (uint32_t)12U) >> (uint32_t)6U) & (uint64_t)0x3ffffffU;
+  f[5U] = (uint64_t)load32_le(s + (uint32_t)16U) & (uint64_t)0x1ffffffU;
+  f[6U] = (uint64_t)(load32_le(s + (uint32_t)19U) >> (uint32_t)1U) & (uint64_t)0x3ffffffU;
+  f[7U] = (uint64_t)(load32_le(s + (uint32_t)22U) >> (uint32_t)3U) & (uint64_t)0x1ffffffU;
+  f[8U] = (uint64_t)(load32_le(s + (uint32_t)25U) >> (uint32_t)4U) & (uint64_t)0x3ffffffU;
+  f[9U] = (uint64_t)(load32_le(s + (uint32_t)28U) >> (uint32_t)6U) & (uint64_t)0x1ffffffU;
+}
+
+/* Fully reduces one lane of a reduced element mod p and writes 32 bytes. */
+static inline void encode_point(uint8_t *s, uint64_t *h)
+{
+  uint64_t f[10U];
+  memcpy(f, h, (uint32_t)10U * sizeof (uint64_t));
+  for (uint32_t r = (uint32_t)0U; r < (uint32_t)2U; r++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)9U; i++)
+    {
+      uint32_t bits = (uint32_t)26U - i % (uint32_t)2U;
+      f[i + (uint32_t)1U] = f[i + (uint32_t)1U] + (f[i] >> bits);
+      f[i] = f[i] & (((uint64_t)1U << bits) - (uint64_t)1U);
+    }
+    f[0U] = f[0U] + (uint64_t)19U * (f[9U] >> (uint32_t)25U);
+    f[9U] = f[9U] & (uint64_t)0x1ffffffU;
+  }
+  /* q = 1 iff f >= p, i.e. f + 19 >= 2^255 */
+  uint64_t q = (f[0U] + (uint64_t)19U) >> (uint32_t)26U;
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)10U; i++)
+  {
+    q = (f[i] + q) >> ((uint32_t)26U - i % (uint32_t)2U);
+  }
+  f[0U] = f[0U] + (uint64_t)19U * q;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)9U; i++)
+  {
+    uint32_t bits = (uint32_t)26U - i % (uint32_t)2U;
+    f[i + (uint32_t)1U] = f[i + (uint32_t)1U] + (f[i] >> bits);
+    f[i] = f[i] & (((uint64_t)1U << bits) - (uint64_t)1U);
+  }
+  f[9U] = f[9U] & (uint64_t)0x1ffffffU;
+  uint64_t w0 = f[0U] | f[1U] << (uint32_t)26U | f[2U] << (uint32_t)51U;
+  uint64_t w1 = f[2U] >> (uint32_t)13U | f[3U] << (uint32_t)13U | f[4U] << (uint32_t)38U;
+  uint64_t w2 = f[5U] | f[6U] << (uint32_t)25U | f[7U] << (uint32_t)51U;
+  uint64_t w3 = f[7U] >> (uint32_t)13U | f[8U] << (uint32_t)12U | f[9U] << (uint32_t)38U;
+  store64_le(s, w0);
+  store64_le(s + (uint32_t)8U, w1);
+  store64_le(s + (uint32_t)16U, w2);
+  store64_le(s + (uint32_t)24U, w3);
+}
+
+static inline void
+load_lanes(Lib_IntVector_Intrinsics_vec256 *out, uint64_t *f0, uint64_t *f1, uint64_t *f2, uint64_t *f3)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    out[i] = Lib_IntVector_Intrinsics_vec256_load64s(f0[i], f1[i], f2[i], f3[i]);
+  }
+}
+
+static void
+scalarmult4(uint8_t **out, uint8_t **priv, uint8_t **pub)
+{
+  uint8_t k[4U][32U];
+  uint64_t u[4U][10U];
+  for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+  {
+    memcpy(k[l], priv[l], (uint32_t)32U * sizeof (uint8_t));
+    k[l][0U] = k[l][0U] & (uint8_t)248U;
+    k[l][31U] = (k[l][31U] & (uint8_t)127U) | (uint8_t)64U;
+    decode_point(u[l], pub[l]);
+  }
+  Lib_IntVector_Intrinsics_vec256 x1[10U];
+  Lib_IntVector_Intrinsics_vec256 x2[10U];
+  Lib_IntVector_Intrinsics_vec256 z2[10U];
+  Lib_IntVector_Intrinsics_vec256 x3[10U];
+  Lib_IntVector_Intrinsics_vec256 z3[10U];
+  load_lanes(x1, u[0U], u[1U], u[2U], u[3U]);
+  memcpy(x3, x1, (uint32_t)10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    x2[i] = Lib_IntVector_Intrinsics_vec256_zero;
+    z2[i] = Lib_IntVector_Intrinsics_vec256_zero;
+    z3[i] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  x2[0U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  z3[0U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  Lib_IntVector_Intrinsics_vec256 a[10U];
+  Lib_IntVector_Intrinsics_vec256 aa[10U];
+  Lib_IntVector_Intrinsics_vec256 b[10U];
+  Lib_IntVector_Intrinsics_vec256 bb[10U];
+  Lib_IntVector_Intrinsics_vec256 c[10U];
+  Lib_IntVector_Intrinsics_vec256 d[10U];
+  Lib_IntVector_Intrinsics_vec256 e[10U];
+  Lib_IntVector_Intrinsics_vec256 swap = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)255U; i++)
+  {
+    uint32_t t = (uint32_t)254U - i;
+    uint32_t byte = t / (uint32_t)8U;
+    uint32_t bit = t % (uint32_t)8U;
+    Lib_IntVector_Intrinsics_vec256
+    kt =
+      Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_zero,
+        Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)(k[0U][byte] >> bit & (uint8_t)1U),
+          (uint64_t)(k[1U][byte] >> bit & (uint8_t)1U),
+          (uint64_t)(k[2U][byte] >> bit & (uint8_t)1U),
+          (uint64_t)(k[3U][byte] >> bit & (uint8_t)1U)));
+    swap = Lib_IntVector_Intrinsics_vec256_xor(swap, kt);
+    cswap4(swap, x2, x3);
+    cswap4(swap, z2, z3);
+    swap = kt;
+    fadd4(a, x2, z2);
+    fsub4(b, x2, z2);
+    fadd4(c, x3, z3);
+    fsub4(d, x3, z3);
+    fmul4(d, d, a);
+    fmul4(c, b, c);
+    fsqr4(aa, a);
+    fsqr4(bb, b);
+    fadd4(x3, d, c);
+    fsqr4(x3, x3);
+    fsub4(z3, d, c);
+    fsqr4(z3, z3);
+    fmul4(z3, z3, x1);
+    fmul4(x2, aa, bb);
+    fsub4(e, aa, bb);
+    fmul_a24(z2, e);
+    fadd4(z2, z2, aa);
+    fmul4(z2, e, z2);
+  }
+  cswap4(swap, x2, x3);
+  cswap4(swap, z2, z3);
+  finv4(z2, z2);
+  fmul4(x2, x2, z2);
+  uint64_t r[10U][4U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256_store64_le((uint8_t *)r[i], x2[i]);
+  }
+  for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+  {
+    uint64_t f[10U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)10U; i++)
+    {
+      f[i] = r[i][l];
+    }
+    encode_point(out[l], f);
+  }
+  Lib_Memzero0_memzero((uint8_t *)k, (uint32_t)128U * sizeof (uint8_t));
+}
+
+void
+Hacl_Curve25519_Vec256_scalarmult_batch(uint8_t *out, uint8_t *priv, uint8_t *pub, uint32_t n)
+{
+  uint32_t full = n / (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < full; i++)
+  {
+    uint32_t off = i * (uint32_t)128U;
+    uint8_t *o[4U] =
+      { out + off, out + off + (uint32_t)32U, out + off + (uint32_t)64U, out + off + (uint32_t)96U };
+    uint8_t *k[4U] =
+      {
+        priv + off, priv + off + (uint32_t)32U, priv + off + (uint32_t)64U,
+        priv + off + (uint32_t)96U
+      };
+    uint8_t *u[4U] =
+      { pub + off, pub + off + (uint32_t)32U, pub + off + (uint32_t)64U, pub + off + (uint32_t)96U };
+    scalarmult4(o, k, u);
+  }
+  uint32_t rem = n % (uint32_t)4U;
+  if (rem > (uint32_t)0U)
+  {
+    /* Unused lanes repeat the last operation; their results are discarded. */
+    uint8_t scratch[3U][32U];
+    uint32_t off = full * (uint32_t)128U;
+    uint8_t *o[4U];
+    uint8_t *k[4U];
+    uint8_t *u[4U];
+    for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+    {
+      uint32_t j;
+      if (l < rem)
+      {
+        j = l;
+      }
+      else
+      {
+        j = rem - (uint32_t)1U;
+      }
+      if (l < rem)
+      {
+        o[l] = out + off + l * (uint32_t)32U;
+      }
+      else
+      {
+        o[l] = scratch[l - (uint32_t)1U];
+      }
+      k[l] = priv + off + j * (uint32_t)32U;
+      u[l] = pub + off + j * (uint32_t)32U;
+    }
+    scalarmult4(o, k, u);
+    Lib_Memzero0_memzero((uint8_t *)scratch, (uint32_t)96U * sizeof (uint8_t));
+  }
+}
@@ -24,6 +24,8 @@
 
 #include "Hacl_Ed25519.h"
 
+#include "Hacl_Ed25519_PrecompTable.h"
+
 static inline void fsum(uint64_t *a, uint64_t *b)
 {
   Hacl_Impl_Curve25519_Field51_fadd(a, a, b);
@@ -455,34 +457,140 @@ void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *result, uint8_t *scalar, uint6
   memcpy(result, nq, (uint32_t)20U * sizeof (uint64_t));
 }
 
+static inline void make_point_inf(uint64_t *b)
+{
+  uint64_t *x = b;
+  uint64_t *y = b + (uint32_t)5U;
+  uint64_t *z = b + (uint32_t)10U;
+  uint64_t *t = b + (uint32_t)15U;
+  memset(x, 0U, (uint32_t)5U * sizeof (uint64_t));
+  memset(y, 0U, (uint32_t)5U * sizeof (uint64_t));
+  memset(z, 0U, (uint32_t)5U * sizeof (uint64_t));
+  memset(t, 0U, (uint32_t)5U * sizeof (uint64_t));
+  y[0U] = (uint64_t)1U;
+  z[0U] = (uint64_t)1U;
+}
+
+/* out = p + q, where q = (y + x, y - x, 2 * d * x * y) is an affine point in
+   precomputed form (see Hacl_Ed25519_PrecompTable.h). */
+static inline void point_add_precomp(uint64_t *out, uint64_t *p, uint64_t *q)
+{
+  uint64_t tmp[30U] = { 0U };
+  uint64_t *a = tmp;
+  uint64_t *b = tmp + (uint32_t)5U;
+  uint64_t *c = tmp + (uint32_t)10U;
+  uint64_t *d = tmp + (uint32_t)15U;
+  uint64_t *e = tmp + (uint32_t)20U;
+  uint64_t *h = tmp + (uint32_t)25U;
+  uint64_t *x1 = p;
+  uint64_t *y1 = p + (uint32_t)5U;
+  uint64_t *z1 = p + (uint32_t)10U;
+  uint64_t *t1 = p + (uint32_t)15U;
+  uint64_t *ypx2 = q;
+  uint64_t *ymx2 = q + (uint32_t)5U;
+  uint64_t *t2d2 = q + (uint32_t)10U;
+  memcpy(e, x1, (uint32_t)5U * sizeof (uint64_t));
+  fdifference(e, y1);
+  fmul0(a, e, ymx2);
+  memcpy(e, y1, (uint32_t)5U * sizeof (uint64_t));
+  fsum(e, x1);
+  fmul0(b, e, ypx2);
+  fmul0(c, t1, t2d2);
+  times_2(d, z1);
+  Hacl_Bignum25519_reduce_513(d);
+  memcpy(e, a, (uint32_t)5U * sizeof (uint64_t));
+  fdifference(e, b);
+  memcpy(h, b, (uint32_t)5U * sizeof (uint64_t));
+  fsum(h, a);
+  memcpy(a, c, (uint32_t)5U * sizeof (uint64_t));
+  fdifference(a, d);
+  fsum(d, c);
+  uint64_t *f = a;
+  uint64_t *g = d;
+  uint64_t *x3 = out;
+  uint64_t *y3 = out + (uint32_t)5U;
+  uint64_t *z3 = out + (uint32_t)10U;
+  uint64_t *t3 = out + (uint32_t)15U;
+  fmul0(x3, e, f);
+  fmul0(y3, g, h);
+  fmul0(t3, e, h);
+  fmul0(z3, f, g);
+}
+
+/* Constant-time lookup of b * 256^i * B, for -8 <= b <= 8, in precomputed
+   form. Every entry of row i is read regardless of b. */
+static inline void precomp_table_select(uint64_t *out, uint32_t i, int8_t b)
+{
+  uint8_t bu = (uint8_t)b;
+  uint8_t bneg = bu >> (uint32_t)7U;
+  uint8_t babs = (uint8_t)(bu - ((((uint8_t)0U - bneg) & bu) << (uint32_t)1U));
+  const
+  uint64_t
+  *row = Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4 + i * (uint32_t)120U;
+  memset(out, 0U, (uint32_t)15U * sizeof (uint64_t));
+  out[0U] = (uint64_t)1U;
+  out[5U] = (uint64_t)1U;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    uint64_t c = ((uint64_t)babs ^ ((uint64_t)j + (uint64_t)1U)) - (uint64_t)1U;
+    uint64_t mask = (uint64_t)0U - (c >> (uint32_t)63U);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)15U; k++)
+    {
+      uint64_t x = out[k];
+      out[k] = x ^ (mask & (x ^ row[j * (uint32_t)15U + k]));
+    }
+  }
+  uint64_t zero[5U] = { 0U };
+  uint64_t neg_t2d[5U] = { 0U };
+  uint64_t *t2d = out + (uint32_t)10U;
+  uint64_t mask = (uint64_t)0U - (uint64_t)bneg;
+  memcpy(neg_t2d, t2d, (uint32_t)5U * sizeof (uint64_t));
+  fdifference(neg_t2d, zero);
+  Hacl_Bignum25519_reduce_513(neg_t2d);
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k++)
+  {
+    uint64_t x = (out[k] ^ out[k + (uint32_t)5U]) & mask;
+    out[k] = out[k] ^ x;
+    out[k + (uint32_t)5U] = out[k + (uint32_t)5U] ^ x;
+    t2d[k] = t2d[k] ^ (mask & (t2d[k] ^ neg_t2d[k]));
+  }
+}
+
+/* Constant-time fixed-base scalar multiplication with signed radix-16 digits
+   (64 table lookups and additions, 4 doublings). The scalar is expected to be
+   below 2^255, which holds for clamped secrets and anything reduced mod q. */
 static inline void point_mul_g(uint64_t *result, uint8_t *scalar)
 {
-  uint64_t g[20U] = { 0U };
-  uint64_t *gx = g;
-  uint64_t *gy = g + (uint32_t)5U;
-  uint64_t *gz = g + (uint32_t)10U;
-  uint64_t *gt = g + (uint32_t)15U;
-  gx[0U] = (uint64_t)0x00062d608f25d51aU;
-  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
-  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
-  gx[3U] = (uint64_t)0x0001ff60527118feU;
-  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
-  gy[0U] = (uint64_t)0x0006666666666658U;
-  gy[1U] = (uint64_t)0x0004ccccccccccccU;
-  gy[2U] = (uint64_t)0x0001999999999999U;
-  gy[3U] = (uint64_t)0x0003333333333333U;
-  gy[4U] = (uint64_t)0x0006666666666666U;
-  gz[0U] = (uint64_t)1U;
-  gz[1U] = (uint64_t)0U;
-  gz[2U] = (uint64_t)0U;
-  gz[3U] = (uint64_t)0U;
-  gz[4U] = (uint64_t)0U;
-  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
-  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
-  gt[2U] = (uint64_t)0x0002af8df483c27eU;
-  gt[3U] = (uint64_t)0x000332b375274732U;
-  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
-  Hacl_Impl_Ed25519_Ladder_point_mul(result, scalar, g);
+  int8_t e[64U] = { 0U };
+  uint64_t t[15U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    e[(uint32_t)2U * i] = (int8_t)(scalar[i] & (uint8_t)15U);
+    e[(uint32_t)2U * i + (uint32_t)1U] = (int8_t)(scalar[i] >> (uint32_t)4U & (uint8_t)15U);
+  }
+  int8_t carry = (int8_t)0;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)63U; i++)
+  {
+    e[i] = e[i] + carry;
+    carry = (int8_t)(e[i] + (int8_t)8) >> (uint32_t)4U;
+    e[i] = e[i] - (int8_t)(carry * (int8_t)16);
+  }
+  e[63U] = e[63U] + carry;
+  make_point_inf(result);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_table_select(t, i, e[(uint32_t)2U * i + (uint32_t)1U]);
+    point_add_precomp(result, result, t);
+  }
+  point_double(result, result);
+  point_double(result, result);
+  point_double(result, result);
+  point_double(result, result);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_table_select(t, i, e[(uint32_t)2U * i]);
+    point_add_precomp(result, result, t);
+  }
 }
 
 void Hacl_Impl_Ed25519_PointCompress_point_compress(uint8_t *z, uint64_t *p)
@@ -1651,6 +1759,179 @@ void Hacl_Impl_Ed25519_PointNegate_point_negate(uint64_t *p, uint64_t *out)
   Hacl_Bignum25519_reduce_513(t1);
 }
 
+/* Signed sliding-window (width-5 NAF) recoding of a 256-bit little-endian
+   scalar whose top bit is clear. Every non-zero digit is odd and lies in
+   [-15, 15]. Variable time: only ever used on public scalars. */
+static void scalar_wnaf(int8_t *r, uint8_t *a)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    r[i] = (int8_t)(a[i >> (uint32_t)3U] >> (i & (uint32_t)7U) & (uint8_t)1U);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    if (r[i] == (int8_t)0)
+    {
+      continue;
+    }
+    for (uint32_t b = (uint32_t)1U; b <= (uint32_t)6U && i + b < (uint32_t)256U; b++)
+    {
+      if (r[i + b] == (int8_t)0)
+      {
+        continue;
+      }
+      int32_t d = (int32_t)r[i + b] << b;
+      if ((int32_t)r[i] + d <= (int32_t)15)
+      {
+        r[i] = (int8_t)((int32_t)r[i] + d);
+        r[i + b] = (int8_t)0;
+      }
+      else if ((int32_t)r[i] - d >= (int32_t)-15)
+      {
+        r[i] = (int8_t)((int32_t)r[i] - d);
+        for (uint32_t k = i + b; k < (uint32_t)256U; k++)
+        {
+          if (r[k] == (int8_t)0)
+          {
+            r[k] = (int8_t)1;
+            break;
+          }
+          r[k] = (int8_t)0;
+        }
+      }
+      else
+      {
+        break;
+      }
+    }
+  }
+}
+
+/* table[i] = (2i+1)P for i = 0..7 */
+static void precomp_odd_multiples(uint64_t *table, uint64_t *p)
+{
+  uint64_t p2[20U] = { 0U };
+  point_double(p2, p);
+  memcpy(table, p, (uint32_t)20U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(table + i * (uint32_t)20U,
+      table + (i - (uint32_t)1U) * (uint32_t)20U,
+      p2);
+  }
+}
+
+static inline void point_add_wnaf_digit(uint64_t *acc, uint64_t *table, int8_t d)
+{
+  if (d > (int8_t)0)
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(acc, acc, table + (uint32_t)(d / (int8_t)2) * (uint32_t)20U);
+  }
+  else if (d < (int8_t)0)
+  {
+    uint64_t neg[20U] = { 0U };
+    Hacl_Impl_Ed25519_PointNegate_point_negate(table + (uint32_t)(-d / (int8_t)2) * (uint32_t)20U,
+      neg);
+    Hacl_Impl_Ed25519_PointAdd_point_add(acc, acc, neg);
+  }
+}
+
+static inline void point_add_precomp_wnaf_digit(uint64_t *acc, const uint64_t *table, int8_t d)
+{
+  uint64_t q[15U] = { 0U };
+  if (d > (int8_t)0)
+  {
+    memcpy(q, table + (uint32_t)(d / (int8_t)2) * (uint32_t)15U, (uint32_t)15U * sizeof (uint64_t));
+    point_add_precomp(acc, acc, q);
+  }
+  else if (d < (int8_t)0)
+  {
+    uint64_t zero[5U] = { 0U };
+    const uint64_t *e = table + (uint32_t)(-d / (int8_t)2) * (uint32_t)15U;
+    memcpy(q, e + (uint32_t)5U, (uint32_t)5U * sizeof (uint64_t));
+    memcpy(q + (uint32_t)5U, e, (uint32_t)5U * sizeof (uint64_t));
+    memcpy(q + (uint32_t)10U, e + (uint32_t)10U, (uint32_t)5U * sizeof (uint64_t));
+    fdifference(q + (uint32_t)10U, zero);
+    Hacl_Bignum25519_reduce_513(q + (uint32_t)10U);
+    point_add_precomp(acc, acc, q);
+  }
+}
+
+/* Variable-time out = [s]B + [k]P (Straus-Shamir): both width-5 NAFs share a
+   single chain of doublings; the odd multiples of B come from a static table,
+   those of P are computed on the fly. Only ever used on public inputs. */
+static void point_mul_double_g_vartime(uint64_t *out, uint8_t *s, uint8_t *k, uint64_t *p)
+{
+  int8_t naf_s[256U] = { 0 };
+  int8_t naf_k[256U] = { 0 };
+  uint64_t table[160U] = { 0U };
+  scalar_wnaf(naf_s, s);
+  scalar_wnaf(naf_k, k);
+  precomp_odd_multiples(table, p);
+  uint32_t top = (uint32_t)256U;
+  while
+  (
+    top
+    > (uint32_t)0U
+    && naf_s[top - (uint32_t)1U] == (int8_t)0
+    && naf_k[top - (uint32_t)1U] == (int8_t)0
+  )
+  {
+    top--;
+  }
+  make_point_inf(out);
+  for (uint32_t j = top; j > (uint32_t)0U; j--)
+  {
+    point_double(out, out);
+    point_add_precomp_wnaf_digit(out,
+      Hacl_Ed25519_PrecompTable_precomp_basepoint_odd_multiples_w5,
+      naf_s[j - (uint32_t)1U]);
+    point_add_wnaf_digit(out, table, naf_k[j - (uint32_t)1U]);
+  }
+}
+
+/* Variable-time multi-scalar multiplication out = sum_i [scalars_i]points_i
+   (Straus' interleaving with width-5 NAFs), sharing one chain of doublings
+   between all len terms. naf (256 * len bytes) and table (160 * len limbs) are
+   caller-provided scratch. */
+static void
+point_mul_multi_vartime(
+  uint64_t *out,
+  uint32_t len,
+  uint8_t *scalars,
+  uint64_t *points,
+  int8_t *naf,
+  uint64_t *table
+)
+{
+  uint32_t top = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    int8_t *naf_i = naf + i * (uint32_t)256U;
+    scalar_wnaf(naf_i, scalars + i * (uint32_t)32U);
+    precomp_odd_multiples(table + i * (uint32_t)160U, points + i * (uint32_t)20U);
+    for (uint32_t j = (uint32_t)256U; j > top; j--)
+    {
+      if (naf_i[j - (uint32_t)1U] != (int8_t)0)
+      {
+        top = j;
+        break;
+      }
+    }
+  }
+  make_point_inf(out);
+  for (uint32_t j = top; j > (uint32_t)0U; j--)
+  {
+    point_double(out, out);
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      point_add_wnaf_digit(out,
+        table + i * (uint32_t)160U,
+        naf[i * (uint32_t)256U + j - (uint32_t)1U]);
+    }
+  }
+}
+
 void Hacl_Ed25519_sign(uint8_t *signature, uint8_t *priv, uint32_t len, uint8_t *msg)
 {
   uint8_t ks[96U] = { 0U };
@@ -1689,14 +1970,12 @@ bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *sign
         sha512_modq_pre_pre2(r_2, rs1, pub, len, msg);
         store_56(tmp_, r_2);
         uint8_t *uu____0 = signature + (uint32_t)32U;
-        uint64_t tmp1[60U] = { 0U };
-        uint64_t *hA = tmp1;
-        uint64_t *rhA = tmp1 + (uint32_t)20U;
-        uint64_t *sB = tmp1 + (uint32_t)40U;
-        point_mul_g(sB, uu____0);
-        Hacl_Impl_Ed25519_Ladder_point_mul(hA, tmp_, a_1);
-        Hacl_Impl_Ed25519_PointAdd_point_add(rhA, r_1, hA);
-        bool b1 = Hacl_Impl_Ed25519_PointEqual_point_equal(sB, rhA);
+        uint64_t tmp1[40U] = { 0U };
+        uint64_t *neg_a = tmp1;
+        uint64_t *sBmhA = tmp1 + (uint32_t)20U;
+        Hacl_Impl_Ed25519_PointNegate_point_negate(a_1, neg_a);
+        point_mul_double_g_vartime(sBmhA, uu____0, tmp_, neg_a);
+        bool b1 = Hacl_Impl_Ed25519_PointEqual_point_equal(sBmhA, r_1);
         bool b10 = b1;
         res = b10;
       }
@@ -1714,11 +1993,246 @@ bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *sign
   return res0;
 }
 
+/* Single-signature counterpart of the batch equation: checks
+     [8]([S]B - [k]A - R) == 0
+   so that an entry gets the same verdict whether the combined check of its
+   chunk succeeds or not. Unlike Hacl_Ed25519_verify, this ignores any
+   small-order component of A and R. */
+static bool verify_cofactored(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *signature)
+{
+  uint64_t tmp[100U] = { 0U };
+  uint64_t s[5U] = { 0U };
+  uint64_t *a_ = tmp;
+  uint64_t *r_ = tmp + (uint32_t)20U;
+  uint64_t *neg = tmp + (uint32_t)40U;
+  uint64_t *q = tmp + (uint32_t)60U;
+  uint64_t *inf = tmp + (uint32_t)80U;
+  bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, pub);
+  b = b && Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, signature);
+  if (b)
+  {
+    load_32_bytes(s, signature + (uint32_t)32U);
+    b = !gte_q(s);
+  }
+  if (!b)
+  {
+    return false;
+  }
+  uint8_t k_[32U] = { 0U };
+  uint64_t k[5U] = { 0U };
+  sha512_modq_pre_pre2(k, signature, pub, len, msg);
+  store_56(k_, k);
+  Hacl_Impl_Ed25519_PointNegate_point_negate(a_, neg);
+  point_mul_double_g_vartime(q, signature + (uint32_t)32U, k_, neg);
+  Hacl_Impl_Ed25519_PointNegate_point_negate(r_, neg);
+  Hacl_Impl_Ed25519_PointAdd_point_add(q, q, neg);
+  point_double(q, q);
+  point_double(q, q);
+  point_double(q, q);
+  make_point_inf(inf);
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(q, inf);
+}
+
+#define HACL_ED25519_BATCH_CHUNK ((uint32_t)64U)
+
+/* Checks up to HACL_ED25519_BATCH_CHUNK signatures with a single random linear
+   combination
+     [8]([sum z_i S_i]B - sum [z_i]R_i - sum [z_i k_i]A_i) == 0
+   where the 128-bit coefficients z_i are derived by hashing the whole chunk
+   (so they cannot be predicted before the signatures are fixed). Entries that
+   do not even decode are rejected upfront; if the combined check fails, every
+   remaining entry is re-checked with verify_cofactored to pinpoint the
+   culprits. */
+static bool
+verify_batch_chunk(
+  uint32_t len,
+  uint8_t **pubs,
+  uint32_t *msg_lens,
+  uint8_t **msgs,
+  uint8_t **signatures,
+  bool *results,
+  uint8_t *scratch
+)
+{
+  uint32_t *idx = (uint32_t *)scratch;
+  uint64_t *points = (uint64_t *)(scratch + HACL_ED25519_BATCH_CHUNK * (uint32_t)4U);
+  uint64_t *table = points + (uint32_t)2U * HACL_ED25519_BATCH_CHUNK * (uint32_t)20U;
+  uint8_t *scalars = (uint8_t *)(table + (uint32_t)2U * HACL_ED25519_BATCH_CHUNK * (uint32_t)160U);
+  uint8_t *transcript = scalars + (uint32_t)2U * HACL_ED25519_BATCH_CHUNK * (uint32_t)32U;
+  int8_t *naf = (int8_t *)(transcript + HACL_ED25519_BATCH_CHUNK * (uint32_t)128U);
+  bool ok = true;
+  uint32_t cnt = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t *a_ = points + ((uint32_t)2U * cnt + (uint32_t)1U) * (uint32_t)20U;
+    uint64_t *r_ = points + (uint32_t)2U * cnt * (uint32_t)20U;
+    uint64_t s[5U] = { 0U };
+    bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, pubs[i]);
+    b = b && Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, signatures[i]);
+    if (b)
+    {
+      load_32_bytes(s, signatures[i] + (uint32_t)32U);
+      b = !gte_q(s);
+    }
+    if (!b)
+    {
+      results[i] = false;
+      ok = false;
+    }
+    else
+    {
+      uint8_t *tr = transcript + cnt * (uint32_t)128U;
+      uint64_t k[5U] = { 0U };
+      sha512_modq_pre_pre2(k, signatures[i], pubs[i], msg_lens[i], msgs[i]);
+      memcpy(tr, signatures[i], (uint32_t)64U * sizeof (uint8_t));
+      memcpy(tr + (uint32_t)64U, pubs[i], (uint32_t)32U * sizeof (uint8_t));
+      store_56(tr + (uint32_t)96U, k);
+      idx[cnt] = i;
+      cnt++;
+    }
+  }
+  if (cnt == (uint32_t)0U)
+  {
+    return ok;
+  }
+  uint8_t seed[68U] = { 0U };
+  uint64_t sum[5U] = { 0U };
+  Hacl_Hash_SHA2_hash_512(transcript, cnt * (uint32_t)128U, seed);
+  for (uint32_t j = (uint32_t)0U; j < cnt; j++)
+  {
+    uint8_t *tr = transcript + j * (uint32_t)128U;
+    uint8_t *zr = scalars + (uint32_t)2U * j * (uint32_t)32U;
+    uint8_t *za = scalars + ((uint32_t)2U * j + (uint32_t)1U) * (uint32_t)32U;
+    uint8_t h[64U] = { 0U };
+    uint64_t z[5U] = { 0U };
+    uint64_t s[5U] = { 0U };
+    uint64_t k[5U] = { 0U };
+    uint64_t t[5U] = { 0U };
+    store32_le(seed + (uint32_t)64U, j);
+    Hacl_Hash_SHA2_hash_512(seed, (uint32_t)68U, h);
+    memset(zr, 0U, (uint32_t)32U * sizeof (uint8_t));
+    memcpy(zr, h, (uint32_t)16U * sizeof (uint8_t));
+    load_32_bytes(z, zr);
+    load_32_bytes(s, tr + (uint32_t)32U);
+    load_32_bytes(k, tr + (uint32_t)96U);
+    mul_modq(t, z, k);
+    store_56(za, t);
+    mul_modq(t, z, s);
+    add_modq(sum, sum, t);
+  }
+  uint8_t sum_[32U] = { 0U };
+  uint64_t tmp[80U] = { 0U };
+  uint64_t *sB = tmp;
+  uint64_t *q = tmp + (uint32_t)20U;
+  uint64_t *nq = tmp + (uint32_t)40U;
+  uint64_t *inf = tmp + (uint32_t)60U;
+  store_56(sum_, sum);
+  point_mul_g(sB, sum_);
+  point_mul_multi_vartime(q, (uint32_t)2U * cnt, scalars, points, naf, table);
+  Hacl_Impl_Ed25519_PointNegate_point_negate(q, nq);
+  Hacl_Impl_Ed25519_PointAdd_point_add(q, sB, nq);
+  point_double(q, q);
+  point_double(q, q);
+  point_double(q, q);
+  make_point_inf(inf);
+  if (Hacl_Impl_Ed25519_PointEqual_point_equal(q, inf))
+  {
+    for (uint32_t j = (uint32_t)0U; j < cnt; j++)
+    {
+      results[idx[j]] = true;
+    }
+    return ok;
+  }
+  for (uint32_t j = (uint32_t)0U; j < cnt; j++)
+  {
+    uint32_t i = idx[j];
+    bool b = verify_cofactored(pubs[i], msg_lens[i], msgs[i], signatures[i]);
+    results[i] = b;
+    ok = ok && b;
+  }
+  return ok;
+}
+
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t len,
+  uint8_t **pubs,
+  uint32_t *msg_lens,
+  uint8_t **msgs,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  uint32_t
+  scratch_len =
+    HACL_ED25519_BATCH_CHUNK
+    * ((uint32_t)4U + (uint32_t)2U * (uint32_t)20U * (uint32_t)8U
+    + (uint32_t)2U * (uint32_t)160U * (uint32_t)8U
+    + (uint32_t)2U * (uint32_t)32U
+    + (uint32_t)128U
+    + (uint32_t)2U * (uint32_t)256U);
+  uint8_t *scratch = KRML_HOST_MALLOC(scratch_len);
+  bool ok = true;
+  if (scratch == NULL)
+  {
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      results[i] = verify_cofactored(pubs[i], msg_lens[i], msgs[i], signatures[i]);
+      ok = ok && results[i];
+    }
+    return ok;
+  }
+  for (uint32_t i = (uint32_t)0U; i < len; i = i + HACL_ED25519_BATCH_CHUNK)
+  {
+    uint32_t n = len - i;
+    if (n > HACL_ED25519_BATCH_CHUNK)
+    {
+      n = HACL_ED25519_BATCH_CHUNK;
+    }
+    bool b =
+      verify_batch_chunk(n,
+        pubs + i,
+        msg_lens + i,
+        msgs + i,
+        signatures + i,
+        results + i,
+        scratch);
+    ok = ok && b;
+  }
+  KRML_HOST_FREE(scratch);
+  return ok;
+}
+
 void Hacl_Ed25519_secret_to_public(uint8_t *pub, uint8_t *priv)
 {
   secret_to_public(pub, priv);
 }
 
+void Hacl_Ed25519_x25519_secret_to_public(uint8_t *pub, uint8_t *priv)
+{
+  uint8_t k[32U] = { 0U };
+  uint64_t p[20U] = { 0U };
+  uint64_t tmp[15U] = { 0U };
+  memcpy(k, priv, (uint32_t)32U * sizeof (uint8_t));
+  k[0U] = k[0U] & (uint8_t)248U;
+  k[31U] = (k[31U] & (uint8_t)127U) | (uint8_t)64U;
+  point_mul_g(p, k);
+  uint64_t *num = tmp;
+  uint64_t *den = tmp + (uint32_t)5U;
+  uint64_t *u = tmp + (uint32_t)10U;
+  uint64_t *py = p + (uint32_t)5U;
+  uint64_t *pz = p + (uint32_t)10U;
+  /* u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y); the identity maps to u = 0, as
+     in the ladder. */
+  memcpy(num, pz, (uint32_t)5U * sizeof (uint64_t));
+  fsum(num, py);
+  memcpy(den, py, (uint32_t)5U * sizeof (uint64_t));
+  fdifference(den, pz);
+  Hacl_Bignum25519_inverse(u, den);
+  fmul0(u, u, num);
+  Hacl_Bignum25519_store_51(pub, u);
+}
+
 void Hacl_Ed25519_expand_keys(uint8_t *ks, uint8_t *priv)
 {
   secret_expand(ks + (uint32_t)32U, priv);
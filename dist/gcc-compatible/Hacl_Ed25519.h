@@ -66,8 +66,41 @@ void Hacl_Ed25519_sign(uint8_t *signature, uint8_t *priv, uint32_t len, uint8_t
 
 bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *signature);
 
+/*
+Verify `len` signatures at once: entry i is the signature `signatures[i]` of the
+  `msg_lens[i]`-byte message `msgs[i]` under the public key `pubs[i]`.
+
+  The outparam results is meant to be `len` booleans; results[i] is set to the
+  verdict for entry i. The function returns true iff every entry verifies.
+
+  All entries are folded into one multi-scalar multiplication and, when that
+  check fails, re-checked one by one; both steps use the cofactored equation
+  [8][S]B = [8]R + [8][k]A, so each verdict depends only on its own entry. This
+  is NOT the cofactorless equation of Hacl_Ed25519_verify: the two agree on
+  honestly generated signatures, but a signature whose R or public key carries
+  a small-order component may be accepted here and rejected by
+  Hacl_Ed25519_verify. Callers that need the cofactorless verdict must use
+  Hacl_Ed25519_verify.
+*/
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t len,
+  uint8_t **pubs,
+  uint32_t *msg_lens,
+  uint8_t **msgs,
+  uint8_t **signatures,
+  bool *results
+);
+
 void Hacl_Ed25519_secret_to_public(uint8_t *pub, uint8_t *priv);
 
+/*
+Compute the X25519 public key of priv, i.e. X25519(priv, 9), using the fixed-base
+  table of Ed25519 and the birational map to Curve25519 instead of a Montgomery
+  ladder. The result is byte-for-byte that of Hacl_Curve25519_51_secret_to_public.
+*/
+void Hacl_Ed25519_x25519_secret_to_public(uint8_t *pub, uint8_t *priv);
+
 void Hacl_Ed25519_expand_keys(uint8_t *ks, uint8_t *priv);
 
 void Hacl_Ed25519_sign_expanded(uint8_t *signature, uint8_t *ks, uint32_t len, uint8_t *msg);
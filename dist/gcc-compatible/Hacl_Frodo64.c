@@ -62,15 +62,10 @@ uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
     r + (uint32_t)1024U,
     e_matrix);
   uint16_t b_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
-    (uint32_t)64U,
-    seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul_s((uint32_t)64U,
+  Hacl_Impl_Frodo_Params_frodo_gen_matrix_mul_s(Spec_Frodo_Params_SHAKE128,
     (uint32_t)64U,
     (uint32_t)8U,
-    a_matrix,
+    seed_a,
     s_matrix,
     b_matrix);
   Hacl_Impl_Matrix_matrix_add((uint32_t)64U, (uint32_t)8U, b_matrix, e_matrix);
@@ -121,16 +116,11 @@ uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + (uint32_t)960U;
   uint16_t bp_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_gen_matrix(Spec_Frodo_Params_SHAKE128,
     (uint32_t)64U,
+    (uint32_t)8U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)64U,
-    (uint32_t)64U,
     sp_matrix,
-    a_matrix,
     bp_matrix);
   Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)64U, bp_matrix, ep_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack((uint32_t)8U, (uint32_t)64U, (uint32_t)15U, bp_matrix, c1);
@@ -232,16 +222,11 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *pk = sk + (uint32_t)16U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + (uint32_t)16U;
-  uint16_t a_matrix[4096U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_gen_matrix(Spec_Frodo_Params_SHAKE128,
     (uint32_t)64U,
+    (uint32_t)8U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)64U,
-    (uint32_t)64U,
     sp_matrix,
-    a_matrix,
     bpp_matrix);
   Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)64U, bpp_matrix, ep_matrix);
   uint16_t b_matrix[512U] = { 0U };
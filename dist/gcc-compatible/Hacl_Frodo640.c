@@ -57,15 +57,10 @@ uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
     r + (uint32_t)10240U,
     e_matrix);
   uint16_t b_matrix[5120U] = { 0U };
-  uint16_t a_matrix[409600U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
-    (uint32_t)640U,
-    seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul_s((uint32_t)640U,
+  Hacl_Impl_Frodo_Params_frodo_gen_matrix_mul_s(Spec_Frodo_Params_SHAKE128,
     (uint32_t)640U,
     (uint32_t)8U,
-    a_matrix,
+    seed_a,
     s_matrix,
     b_matrix);
   Hacl_Impl_Matrix_matrix_add((uint32_t)640U, (uint32_t)8U, b_matrix, e_matrix);
@@ -120,16 +115,11 @@ uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + (uint32_t)9600U;
   uint16_t bp_matrix[5120U] = { 0U };
-  uint16_t a_matrix[409600U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_gen_matrix(Spec_Frodo_Params_SHAKE128,
     (uint32_t)640U,
+    (uint32_t)8U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)640U,
-    (uint32_t)640U,
     sp_matrix,
-    a_matrix,
     bp_matrix);
   Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)640U, bp_matrix, ep_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack((uint32_t)8U, (uint32_t)640U, (uint32_t)15U, bp_matrix, c1);
@@ -231,16 +221,11 @@ uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *pk = sk + (uint32_t)16U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + (uint32_t)16U;
-  uint16_t a_matrix[409600U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_gen_matrix(Spec_Frodo_Params_SHAKE128,
     (uint32_t)640U,
+    (uint32_t)8U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)640U,
-    (uint32_t)640U,
     sp_matrix,
-    a_matrix,
     bpp_matrix);
   Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)640U, bpp_matrix, ep_matrix);
   uint16_t b_matrix[5120U] = { 0U };
@@ -41,6 +41,9 @@ extern "C" {
 #include "Lib_RandomBuffer_System.h"
 #include "Hacl_Spec.h"
 #include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Frodo_Vec256.h"
 
 static inline void
 Hacl_Keccak_shake128_4x(
@@ -56,6 +59,22 @@ Hacl_Keccak_shake128_4x(
   uint8_t *output3
 )
 {
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256())
+  {
+    Hacl_SHA3_Vec256_shake128_4x(input_len,
+      input0,
+      input1,
+      input2,
+      input3,
+      output_len,
+      output0,
+      output1,
+      output2,
+      output3);
+    return;
+  }
+  #endif
   Hacl_SHA3_shake128_hacl(input_len, input0, output_len, output0);
   Hacl_SHA3_shake128_hacl(input_len, input1, output_len, output1);
   Hacl_SHA3_shake128_hacl(input_len, input2, output_len, output2);
@@ -112,6 +131,19 @@ Hacl_Impl_Matrix_matrix_mul(
   uint16_t *c
 )
 {
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if
+  (
+    EverCrypt_AutoConfig2_has_vec256()
+    && n3 == (uint32_t)8U
+    && n1 % (uint32_t)2U == (uint32_t)0U
+    && n2 % (uint32_t)2U == (uint32_t)0U
+  )
+  {
+    Hacl_Frodo_Vec256_matrix_mul_x8(n1, n2, a, b, c);
+    return;
+  }
+  #endif
   for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
   {
     for (uint32_t i1 = (uint32_t)0U; i1 < n3; i1++)
@@ -139,6 +171,19 @@ Hacl_Impl_Matrix_matrix_mul_s(
   uint16_t *c
 )
 {
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if
+  (
+    EverCrypt_AutoConfig2_has_vec256()
+    && n3 == (uint32_t)8U
+    && n1 % (uint32_t)2U == (uint32_t)0U
+    && n2 % (uint32_t)16U == (uint32_t)0U
+  )
+  {
+    Hacl_Frodo_Vec256_matrix_mul_s_x8(n1, n2, a, b, c);
+    return;
+  }
+  #endif
   for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
   {
     for (uint32_t i1 = (uint32_t)0U; i1 < n3; i1++)
@@ -156,6 +201,35 @@ Hacl_Impl_Matrix_matrix_mul_s(
   }
 }
 
+/*
+  c (n1 x n) = c + a * b, for b of size 4 x n and a of size n1 x 4 with its rows
+  n entries apart: four consecutive columns of an n1 x n matrix.
+*/
+static inline void
+Hacl_Impl_Matrix_matrix_mul_add_x4(uint32_t n1, uint32_t n, uint16_t *a, uint16_t *b, uint16_t *c)
+{
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256() && n % (uint32_t)16U == (uint32_t)0U)
+  {
+    Hacl_Frodo_Vec256_matrix_mul_add_x4(n1, n, a, b, c);
+    return;
+  }
+  #endif
+  for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
+  {
+    uint16_t *c_row = c + i0 * n;
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      uint16_t aik = a[i0 * n + k];
+      uint16_t *b_row = b + k * n;
+      for (uint32_t j = (uint32_t)0U; j < n; j++)
+      {
+        c_row[j] = c_row[j] + aik * b_row[j];
+      }
+    }
+  }
+}
+
 static inline uint16_t
 Hacl_Impl_Matrix_matrix_eq(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b)
 {
@@ -267,6 +341,171 @@ Hacl_Impl_Frodo_Params_frodo_gen_matrix(
   }
 }
 
+/*
+  Rows 4 * i .. 4 * i + 3 of the matrix A, into res (4 * n entries). tmp_seed
+  holds the four 18-byte SHAKE inputs with the seed already in place, and r is
+  scratch space for 8 * n bytes.
+*/
+static inline void
+Hacl_Impl_Frodo_Gen_frodo_gen_rows_shake_4x(
+  uint32_t n,
+  uint32_t i,
+  uint8_t *tmp_seed,
+  uint8_t *r,
+  uint16_t *res
+)
+{
+  uint8_t *r0 = r + (uint32_t)0U * n;
+  uint8_t *r1 = r + (uint32_t)2U * n;
+  uint8_t *r2 = r + (uint32_t)4U * n;
+  uint8_t *r3 = r + (uint32_t)6U * n;
+  uint8_t *tmp_seed0 = tmp_seed;
+  uint8_t *tmp_seed1 = tmp_seed + (uint32_t)18U;
+  uint8_t *tmp_seed2 = tmp_seed + (uint32_t)36U;
+  uint8_t *tmp_seed3 = tmp_seed + (uint32_t)54U;
+  store16_le(tmp_seed0, (uint16_t)((uint32_t)4U * i + (uint32_t)0U));
+  store16_le(tmp_seed1, (uint16_t)((uint32_t)4U * i + (uint32_t)1U));
+  store16_le(tmp_seed2, (uint16_t)((uint32_t)4U * i + (uint32_t)2U));
+  store16_le(tmp_seed3, (uint16_t)((uint32_t)4U * i + (uint32_t)3U));
+  Hacl_Keccak_shake128_4x((uint32_t)18U,
+    tmp_seed0,
+    tmp_seed1,
+    tmp_seed2,
+    tmp_seed3,
+    (uint32_t)2U * n,
+    r0,
+    r1,
+    r2,
+    r3);
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0++)
+  {
+    res[(uint32_t)0U * n + i0] = load16_le(r0 + i0 * (uint32_t)2U);
+    res[(uint32_t)1U * n + i0] = load16_le(r1 + i0 * (uint32_t)2U);
+    res[(uint32_t)2U * n + i0] = load16_le(r2 + i0 * (uint32_t)2U);
+    res[(uint32_t)3U * n + i0] = load16_le(r3 + i0 * (uint32_t)2U);
+  }
+}
+
+/*
+  b = A * s^T, as Hacl_Impl_Matrix_matrix_mul_s (n, n, nbar) on the matrix A
+  generated from seed, but A is produced four rows at a time and never stored:
+  the working set is 16 * n bytes instead of 2 * n * n.
+*/
+static inline void
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_mul_s_shake_4x(
+  uint32_t n,
+  uint32_t nbar,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *b
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * n);
+  uint8_t r[(uint32_t)8U * n];
+  memset(r, 0U, (uint32_t)8U * n * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)4U * n);
+  uint16_t a_rows[(uint32_t)4U * n];
+  memset(a_rows, 0U, (uint32_t)4U * n * sizeof (uint16_t));
+  uint8_t tmp_seed[72U] = { 0U };
+  memcpy(tmp_seed + (uint32_t)2U, seed, (uint32_t)16U * sizeof (uint8_t));
+  memcpy(tmp_seed + (uint32_t)20U, seed, (uint32_t)16U * sizeof (uint8_t));
+  memcpy(tmp_seed + (uint32_t)38U, seed, (uint32_t)16U * sizeof (uint8_t));
+  memcpy(tmp_seed + (uint32_t)56U, seed, (uint32_t)16U * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < n / (uint32_t)4U; i++)
+  {
+    Hacl_Impl_Frodo_Gen_frodo_gen_rows_shake_4x(n, i, tmp_seed, r, a_rows);
+    Hacl_Impl_Matrix_matrix_mul_s((uint32_t)4U,
+      n,
+      nbar,
+      a_rows,
+      s,
+      b + (uint32_t)4U * i * nbar);
+  }
+}
+
+/*
+  b = s * A, as Hacl_Impl_Matrix_matrix_mul (nbar, n, n) on the matrix A
+  generated from seed. Each block of four rows of A is folded into b as soon as
+  it is produced, with the same 16 * n byte working set.
+*/
+static inline void
+Hacl_Impl_Frodo_Gen_frodo_mul_gen_matrix_shake_4x(
+  uint32_t n,
+  uint32_t nbar,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *b
+)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * n);
+  uint8_t r[(uint32_t)8U * n];
+  memset(r, 0U, (uint32_t)8U * n * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)4U * n);
+  uint16_t a_rows[(uint32_t)4U * n];
+  memset(a_rows, 0U, (uint32_t)4U * n * sizeof (uint16_t));
+  uint8_t tmp_seed[72U] = { 0U };
+  memcpy(tmp_seed + (uint32_t)2U, seed, (uint32_t)16U * sizeof (uint8_t));
+  memcpy(tmp_seed + (uint32_t)20U, seed, (uint32_t)16U * sizeof (uint8_t));
+  memcpy(tmp_seed + (uint32_t)38U, seed, (uint32_t)16U * sizeof (uint8_t));
+  memcpy(tmp_seed + (uint32_t)56U, seed, (uint32_t)16U * sizeof (uint8_t));
+  memset(b, 0U, nbar * n * sizeof (uint16_t));
+  for (uint32_t i = (uint32_t)0U; i < n / (uint32_t)4U; i++)
+  {
+    Hacl_Impl_Frodo_Gen_frodo_gen_rows_shake_4x(n, i, tmp_seed, r, a_rows);
+    Hacl_Impl_Matrix_matrix_mul_add_x4(nbar, n, s + (uint32_t)4U * i, a_rows, b);
+  }
+}
+
+static inline void
+Hacl_Impl_Frodo_Params_frodo_gen_matrix_mul_s(
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint32_t nbar,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *b
+)
+{
+  switch (a)
+  {
+    case Spec_Frodo_Params_SHAKE128:
+      {
+        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_mul_s_shake_4x(n, nbar, seed, s, b);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static inline void
+Hacl_Impl_Frodo_Params_frodo_mul_gen_matrix(
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint32_t nbar,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *b
+)
+{
+  switch (a)
+  {
+    case Spec_Frodo_Params_SHAKE128:
+      {
+        Hacl_Impl_Frodo_Gen_frodo_mul_gen_matrix_shake_4x(n, nbar, seed, s, b);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
 static const
 uint16_t
 Hacl_Impl_Frodo_Params_cdf_table640[13U] =
@@ -0,0 +1,161 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Frodo_Vec256.h"
+
+/*
+  The matrices are uint16_t, row major, and all arithmetic is modulo 2^16, so
+  sixteen entries fit a vec256 and the lane-wise wrapping multiply and add are
+  exact: no reduction is needed until the caller masks the result to log q bits.
+*/
+
+/*
+  Row i of a times the eight rows of b (8 x n2), reduced to the eight dot
+  products. Each 128-bit half of the result holds one partial sum per row of b.
+*/
+static inline Lib_IntVector_Intrinsics_vec256 dot_x8(uint32_t n2, uint16_t *a, uint16_t *b)
+{
+  Lib_IntVector_Intrinsics_vec256 acc[8U];
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+  {
+    acc[k] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  for (uint32_t i = (uint32_t)0U; i < n2 / (uint32_t)16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    ai = Lib_IntVector_Intrinsics_vec256_load16_le(a + i * (uint32_t)16U);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      bk = Lib_IntVector_Intrinsics_vec256_load16_le(b + k * n2 + i * (uint32_t)16U);
+      acc[k] =
+        Lib_IntVector_Intrinsics_vec256_add16(acc[k],
+          Lib_IntVector_Intrinsics_vec256_mul16(ai, bk));
+    }
+  }
+  Lib_IntVector_Intrinsics_vec256 h0 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[0U], acc[1U]);
+  Lib_IntVector_Intrinsics_vec256 h1 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[2U], acc[3U]);
+  Lib_IntVector_Intrinsics_vec256 h2 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[4U], acc[5U]);
+  Lib_IntVector_Intrinsics_vec256 h3 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[6U], acc[7U]);
+  return
+    Lib_IntVector_Intrinsics_vec256_hadd16(Lib_IntVector_Intrinsics_vec256_hadd16(h0, h1),
+      Lib_IntVector_Intrinsics_vec256_hadd16(h2, h3));
+}
+
+/*
+  Row i of a times b (n2 x 8), two rows of b per vector: the low half of the
+  result sums the even rows of b, the high half the odd ones.
+*/
+static inline Lib_IntVector_Intrinsics_vec256 row_x8(uint32_t n2, uint16_t *a, uint16_t *b)
+{
+  Lib_IntVector_Intrinsics_vec256 acc = Lib_IntVector_Intrinsics_vec256_zero;
+  for (uint32_t i = (uint32_t)0U; i < n2 / (uint32_t)2U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    ai =
+      Lib_IntVector_Intrinsics_vec256_interleave_low128(Lib_IntVector_Intrinsics_vec256_load16(a[(uint32_t)2U
+          * i]),
+        Lib_IntVector_Intrinsics_vec256_load16(a[(uint32_t)2U * i + (uint32_t)1U]));
+    Lib_IntVector_Intrinsics_vec256
+    bi = Lib_IntVector_Intrinsics_vec256_load16_le(b + i * (uint32_t)16U);
+    acc = Lib_IntVector_Intrinsics_vec256_add16(acc, Lib_IntVector_Intrinsics_vec256_mul16(ai, bi));
+  }
+  return acc;
+}
+
+/*
+  Adds the two halves of r0 and of r1 and stores them as two consecutive rows
+  of eight entries.
+*/
+static inline void
+store_rows_x8(uint16_t *c, Lib_IntVector_Intrinsics_vec256 r0, Lib_IntVector_Intrinsics_vec256 r1)
+{
+  Lib_IntVector_Intrinsics_vec256
+  lo = Lib_IntVector_Intrinsics_vec256_interleave_low128(r0, r1);
+  Lib_IntVector_Intrinsics_vec256
+  hi = Lib_IntVector_Intrinsics_vec256_interleave_high128(r0, r1);
+  Lib_IntVector_Intrinsics_vec256_store16_le(c, Lib_IntVector_Intrinsics_vec256_add16(lo, hi));
+}
+
+void
+Hacl_Frodo_Vec256_matrix_mul_x8(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b, uint16_t *c)
+{
+  for (uint32_t i0 = (uint32_t)0U; i0 < n1 / (uint32_t)2U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    r0 = row_x8(n2, a + (uint32_t)2U * i0 * n2, b);
+    Lib_IntVector_Intrinsics_vec256
+    r1 = row_x8(n2, a + ((uint32_t)2U * i0 + (uint32_t)1U) * n2, b);
+    store_rows_x8(c + i0 * (uint32_t)16U, r0, r1);
+  }
+}
+
+void
+Hacl_Frodo_Vec256_matrix_mul_s_x8(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b, uint16_t *c)
+{
+  for (uint32_t i0 = (uint32_t)0U; i0 < n1 / (uint32_t)2U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    r0 = dot_x8(n2, a + (uint32_t)2U * i0 * n2, b);
+    Lib_IntVector_Intrinsics_vec256
+    r1 = dot_x8(n2, a + ((uint32_t)2U * i0 + (uint32_t)1U) * n2, b);
+    store_rows_x8(c + i0 * (uint32_t)16U, r0, r1);
+  }
+}
+
+void
+Hacl_Frodo_Vec256_matrix_mul_add_x4(uint32_t n1, uint32_t n, uint16_t *a, uint16_t *b, uint16_t *c)
+{
+  for (uint32_t j = (uint32_t)0U; j < n / (uint32_t)16U; j++)
+  {
+    uint16_t *bj = b + j * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec256 b0 = Lib_IntVector_Intrinsics_vec256_load16_le(bj);
+    Lib_IntVector_Intrinsics_vec256 b1 = Lib_IntVector_Intrinsics_vec256_load16_le(bj + n);
+    Lib_IntVector_Intrinsics_vec256
+    b2 = Lib_IntVector_Intrinsics_vec256_load16_le(bj + (uint32_t)2U * n);
+    Lib_IntVector_Intrinsics_vec256
+    b3 = Lib_IntVector_Intrinsics_vec256_load16_le(bj + (uint32_t)3U * n);
+    for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
+    {
+      uint16_t *ai = a + i0 * n;
+      uint16_t *ci = c + i0 * n + j * (uint32_t)16U;
+      Lib_IntVector_Intrinsics_vec256
+      p01 =
+        Lib_IntVector_Intrinsics_vec256_add16(Lib_IntVector_Intrinsics_vec256_mul16(Lib_IntVector_Intrinsics_vec256_load16(ai[0U]),
+            b0),
+          Lib_IntVector_Intrinsics_vec256_mul16(Lib_IntVector_Intrinsics_vec256_load16(ai[1U]), b1));
+      Lib_IntVector_Intrinsics_vec256
+      p23 =
+        Lib_IntVector_Intrinsics_vec256_add16(Lib_IntVector_Intrinsics_vec256_mul16(Lib_IntVector_Intrinsics_vec256_load16(ai[2U]),
+            b2),
+          Lib_IntVector_Intrinsics_vec256_mul16(Lib_IntVector_Intrinsics_vec256_load16(ai[3U]), b3));
+      Lib_IntVector_Intrinsics_vec256
+      cij =
+        Lib_IntVector_Intrinsics_vec256_add16(Lib_IntVector_Intrinsics_vec256_load16_le(ci),
+          Lib_IntVector_Intrinsics_vec256_add16(p01, p23));
+      Lib_IntVector_Intrinsics_vec256_store16_le(ci, cij);
+    }
+  }
+}
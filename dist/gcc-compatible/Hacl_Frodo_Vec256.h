@@ -0,0 +1,74 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Frodo_Vec256_H
+#define __Hacl_Frodo_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+
+/*
+  AVX2 kernels for the matrix products of FrodoKEM, over uint16_t matrices in
+  row major order. They compute the same results as the corresponding
+  Hacl_Impl_Matrix functions in Hacl_Frodo_KEM.h, which dispatch to them.
+*/
+
+/*
+  c (n1 x 8) = a (n1 x n2) * b (n2 x 8). n1 and n2 must be even.
+*/
+void
+Hacl_Frodo_Vec256_matrix_mul_x8(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b, uint16_t *c);
+
+/*
+  c (n1 x 8) = a (n1 x n2) * b^T, for b of size 8 x n2. n1 must be even and n2
+  a multiple of 16.
+*/
+void
+Hacl_Frodo_Vec256_matrix_mul_s_x8(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b, uint16_t *c);
+
+/*
+  c (n1 x n) = c + a * b, for b of size 4 x n and a of size n1 x 4 with its rows
+  n entries apart, i.e. four consecutive columns of an n1 x n matrix. n must be
+  a multiple of 16.
+*/
+void
+Hacl_Frodo_Vec256_matrix_mul_add_x4(uint32_t n1, uint32_t n, uint16_t *a, uint16_t *b, uint16_t *c);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Frodo_Vec256_H_DEFINED
+#endif
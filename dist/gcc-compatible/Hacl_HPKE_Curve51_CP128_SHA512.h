@@ -42,6 +42,7 @@ extern "C" {
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_HKDF.h"
 #include "Hacl_Curve25519_51.h"
+#include "Hacl_Ed25519.h"
 
 uint32_t
 Hacl_HPKE_Curve51_CP128_SHA512_setupBaseI(
@@ -38,7 +38,7 @@ Hacl_HPKE_Curve51_CP256_SHA512_setupBaseI(
   uint8_t zz[32U] = { 0U };
   uint8_t *o_pkE_ = o_pkE;
   uint8_t *o_zz_ = zz;
-  Hacl_Curve25519_51_secret_to_public(o_pkE_, skE);
+  Hacl_Ed25519_x25519_secret_to_public(o_pkE_, skE);
   uint32_t res1 = (uint32_t)0U;
   uint8_t *uu____0 = pkR;
   uint8_t zeros[32U] = { 0U };
@@ -145,7 +145,7 @@ Hacl_HPKE_Curve51_CP256_SHA512_setupBaseR(
   uint8_t pkR[32U] = { 0U };
   uint8_t *pkR_ = pkR;
   uint8_t zz[32U] = { 0U };
-  Hacl_Curve25519_51_secret_to_public(pkR_, skR);
+  Hacl_Ed25519_x25519_secret_to_public(pkR_, skR);
   uint32_t res1 = (uint32_t)0U;
   uint8_t *o_pkR_ = zz;
   uint8_t *uu____0 = pkE;
@@ -24,6 +24,8 @@
 
 #include "Hacl_P256.h"
 
+#include "Hacl_P256_PrecompTable.h"
+
 static uint64_t isZero_uint64_CT(uint64_t *f)
 {
   uint64_t a0 = f[0U];
@@ -402,6 +404,16 @@ prime256_buffer[4U] =
     (uint64_t)0xffffffff00000001U
   };
 
+static const
+uint64_t
+prime256order_buffer[4U] =
+  {
+    (uint64_t)17562291160714782033U,
+    (uint64_t)13611842547513532036U,
+    (uint64_t)18446744073709551615U,
+    (uint64_t)18446744069414584320U
+  };
+
 static void reduction_prime_2prime_impl(uint64_t *x, uint64_t *result)
 {
   uint64_t tempBuffer[4U] = { 0U };
@@ -1005,29 +1017,49 @@ static void fsquarePowNminusOne(uint32_t n, uint64_t *a, uint64_t *b)
   }
 }
 
+/* result = a^(p - 2), i.e. the inverse of a, with a fixed addition chain of 255
+   squarings and 12 multiplications. xk holds a^(2^k - 1). */
 static void exponent(uint64_t *a, uint64_t *result, uint64_t *tempBuffer)
 {
-  uint64_t *buffer_norm_1 = tempBuffer;
-  uint64_t *buffer_result1 = tempBuffer + (uint32_t)4U;
-  uint64_t *buffer_result2 = tempBuffer + (uint32_t)8U;
-  uint64_t *buffer_norm_3 = tempBuffer + (uint32_t)12U;
-  uint64_t *buffer_result3 = tempBuffer + (uint32_t)16U;
-  memcpy(buffer_norm_1, a, (uint32_t)4U * sizeof (uint64_t));
-  uint64_t *buffer_a = buffer_norm_1;
-  uint64_t *buffer_b0 = buffer_norm_1 + (uint32_t)4U;
-  fsquarePowNminusOne((uint32_t)32U, buffer_a, buffer_b0);
-  fsquarePowN((uint32_t)224U, buffer_b0);
-  memcpy(buffer_result2, a, (uint32_t)4U * sizeof (uint64_t));
-  fsquarePowN((uint32_t)192U, buffer_result2);
-  memcpy(buffer_norm_3, a, (uint32_t)4U * sizeof (uint64_t));
-  uint64_t *buffer_a0 = buffer_norm_3;
-  uint64_t *buffer_b = buffer_norm_3 + (uint32_t)4U;
-  fsquarePowNminusOne((uint32_t)94U, buffer_a0, buffer_b);
-  fsquarePowN((uint32_t)2U, buffer_b);
-  montgomery_multiplication_buffer(buffer_result1, buffer_result2, buffer_result1);
-  montgomery_multiplication_buffer(buffer_result1, buffer_result3, buffer_result1);
-  montgomery_multiplication_buffer(buffer_result1, a, buffer_result1);
-  memcpy(result, buffer_result1, (uint32_t)4U * sizeof (uint64_t));
+  uint64_t x2[4U] = { 0U };
+  uint64_t x3[4U] = { 0U };
+  uint64_t x6[4U] = { 0U };
+  uint64_t x12[4U] = { 0U };
+  uint64_t x15[4U] = { 0U };
+  uint64_t x30[4U] = { 0U };
+  uint64_t x32[4U] = { 0U };
+  uint64_t r[4U] = { 0U };
+  montgomery_square_buffer(a, x2);
+  montgomery_multiplication_buffer(x2, a, x2);
+  montgomery_square_buffer(x2, x3);
+  montgomery_multiplication_buffer(x3, a, x3);
+  memcpy(x6, x3, (uint32_t)4U * sizeof (uint64_t));
+  fsquarePowN((uint32_t)3U, x6);
+  montgomery_multiplication_buffer(x6, x3, x6);
+  memcpy(x12, x6, (uint32_t)4U * sizeof (uint64_t));
+  fsquarePowN((uint32_t)6U, x12);
+  montgomery_multiplication_buffer(x12, x6, x12);
+  memcpy(x15, x12, (uint32_t)4U * sizeof (uint64_t));
+  fsquarePowN((uint32_t)3U, x15);
+  montgomery_multiplication_buffer(x15, x3, x15);
+  memcpy(x30, x15, (uint32_t)4U * sizeof (uint64_t));
+  fsquarePowN((uint32_t)15U, x30);
+  montgomery_multiplication_buffer(x30, x15, x30);
+  memcpy(x32, x30, (uint32_t)4U * sizeof (uint64_t));
+  fsquarePowN((uint32_t)2U, x32);
+  montgomery_multiplication_buffer(x32, x2, x32);
+  memcpy(r, x32, (uint32_t)4U * sizeof (uint64_t));
+  fsquarePowN((uint32_t)32U, r);
+  montgomery_multiplication_buffer(r, a, r);
+  fsquarePowN((uint32_t)128U, r);
+  montgomery_multiplication_buffer(r, x32, r);
+  fsquarePowN((uint32_t)32U, r);
+  montgomery_multiplication_buffer(r, x32, r);
+  fsquarePowN((uint32_t)30U, r);
+  montgomery_multiplication_buffer(r, x30, r);
+  fsquarePowN((uint32_t)2U, r);
+  montgomery_multiplication_buffer(r, a, r);
+  memcpy(result, r, (uint32_t)4U * sizeof (uint64_t));
 }
 
 static void cube(uint64_t *a, uint64_t *result)
@@ -1433,10 +1465,9 @@ static void norm(uint64_t *p, uint64_t *resultPoint, uint64_t *tempBuffer)
   uint64_t *z2f = tempBuffer + (uint32_t)4U;
   uint64_t *z3f = tempBuffer + (uint32_t)8U;
   uint64_t *tempBuffer20 = tempBuffer + (uint32_t)12U;
-  montgomery_square_buffer(zf, z2f);
-  montgomery_multiplication_buffer(z2f, zf, z3f);
-  exponent(z2f, z2f, tempBuffer20);
-  exponent(z3f, z3f, tempBuffer20);
+  exponent(zf, z3f, tempBuffer20);
+  montgomery_square_buffer(z3f, z2f);
+  montgomery_multiplication_buffer(z2f, z3f, z3f);
   montgomery_multiplication_buffer(xf, z2f, z2f);
   montgomery_multiplication_buffer(yf, z3f, z3f);
   uint64_t zeroBuffer[4U] = { 0U };
@@ -1525,22 +1556,6 @@ scalarMultiplicationC(
   norm(q, result, buff);
 }
 
-static void uploadBasePoint(uint64_t *p)
-{
-  p[0U] = (uint64_t)8784043285714375740U;
-  p[1U] = (uint64_t)8483257759279461889U;
-  p[2U] = (uint64_t)8789745728267363600U;
-  p[3U] = (uint64_t)1770019616739251654U;
-  p[4U] = (uint64_t)15992936863339206154U;
-  p[5U] = (uint64_t)10037038012062884956U;
-  p[6U] = (uint64_t)15197544864945402661U;
-  p[7U] = (uint64_t)9615747158586711429U;
-  p[8U] = (uint64_t)1U;
-  p[9U] = (uint64_t)18446744069414584320U;
-  p[10U] = (uint64_t)18446744073709551615U;
-  p[11U] = (uint64_t)4294967294U;
-}
-
 static void
 scalarMultiplicationWithoutNorm(
   uint64_t *p,
@@ -1567,59 +1582,138 @@ scalarMultiplicationWithoutNorm(
   copy_point(q, result);
 }
 
+/* out = p + q, where q is an affine point (Z = 1) from the fixed-base table.
+   If d is zero, out = p; if p is the point at infinity, out = q. The comb
+   never adds a point to itself or to its negation, so no doubling case is
+   needed (see point_mul_g). */
+static void point_add_mixed(uint64_t *p, uint64_t *q, uint64_t d, uint64_t *result)
+{
+  uint64_t tmp[44U] = { 0U };
+  uint64_t *z1z1 = tmp;
+  uint64_t *z1cube = tmp + (uint32_t)4U;
+  uint64_t *u2 = tmp + (uint32_t)8U;
+  uint64_t *s2 = tmp + (uint32_t)12U;
+  uint64_t *h = tmp + (uint32_t)16U;
+  uint64_t *r = tmp + (uint32_t)20U;
+  uint64_t *hh = tmp + (uint32_t)24U;
+  uint64_t *hhh = tmp + (uint32_t)28U;
+  uint64_t *uh = tmp + (uint32_t)32U;
+  uint64_t *t0 = tmp + (uint32_t)36U;
+  uint64_t *t1 = tmp + (uint32_t)40U;
+  uint64_t out[12U] = { 0U };
+  uint64_t *x3 = out;
+  uint64_t *y3 = out + (uint32_t)4U;
+  uint64_t *z3 = out + (uint32_t)8U;
+  uint64_t *pX = p;
+  uint64_t *pY = p + (uint32_t)4U;
+  uint64_t *pZ = p + (uint32_t)8U;
+  uint64_t *qX = q;
+  uint64_t *qY = q + (uint32_t)4U;
+  montgomery_square_buffer(pZ, z1z1);
+  montgomery_multiplication_buffer(z1z1, pZ, z1cube);
+  montgomery_multiplication_buffer(qX, z1z1, u2);
+  montgomery_multiplication_buffer(qY, z1cube, s2);
+  p256_sub(u2, pX, h);
+  p256_sub(s2, pY, r);
+  montgomery_square_buffer(h, hh);
+  montgomery_multiplication_buffer(hh, h, hhh);
+  montgomery_multiplication_buffer(pX, hh, uh);
+  montgomery_square_buffer(r, x3);
+  p256_sub(x3, hhh, x3);
+  multByTwo(uh, t0);
+  p256_sub(x3, t0, x3);
+  p256_sub(uh, x3, t0);
+  montgomery_multiplication_buffer(r, t0, y3);
+  montgomery_multiplication_buffer(pY, hhh, t1);
+  p256_sub(y3, t1, y3);
+  montgomery_multiplication_buffer(pZ, h, z3);
+  uint64_t one[4U] =
+    {
+      (uint64_t)1U, (uint64_t)18446744069414584320U, (uint64_t)18446744073709551615U,
+      (uint64_t)4294967294U
+    };
+  uint64_t pInf = Hacl_Impl_P256_Core_isPointAtInfinityPrivate(p);
+  copy_conditional(x3, qX, pInf);
+  copy_conditional(y3, qY, pInf);
+  copy_conditional(z3, one, pInf);
+  uint64_t dZero = FStar_UInt64_eq_mask(d, (uint64_t)0U);
+  copy_conditional(x3, pX, dZero);
+  copy_conditional(y3, pY, dZero);
+  copy_conditional(z3, pZ, dZero);
+  memcpy(result, out, (uint32_t)12U * sizeof (uint64_t));
+}
+
+/* Constant-time lookup of d * 256^i * G, for 1 <= d <= 15. Every entry of row i
+   is read regardless of d; out is left as zero for d = 0. */
+static void precomp_table_select(uint64_t *out, uint32_t i, uint64_t d)
+{
+  const
+  uint64_t
+  *row = Hacl_P256_PrecompTable_precomp_basepoint_table_w4 + i * (uint32_t)120U;
+  memset(out, 0U, (uint32_t)8U * sizeof (uint64_t));
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)15U; j++)
+  {
+    uint64_t mask = FStar_UInt64_eq_mask(d, (uint64_t)j + (uint64_t)1U);
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+    {
+      uint64_t x = out[k];
+      out[k] = x ^ (mask & (x ^ row[j * (uint32_t)8U + k]));
+    }
+  }
+}
+
+/* Constant-time fixed-base scalar multiplication with a radix-16 comb: the odd
+   nibbles of the scalar are added from the table, the sum is doubled four
+   times, then the even nibbles are added (64 lookups and mixed additions, 4
+   doublings). The scalar is first reduced once modulo the group order. Then the
+   accumulator and each table point added to it are multiples of G by distinct
+   integers below the order whose sum is also below it (their base-16 digits sit
+   at different positions), so the addition never meets its doubling case. The
+   result is in Jacobian coordinates in the Montgomery domain, with Z = 0 for the
+   point at infinity. */
+static void point_mul_g(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
+{
+  uint64_t s[4U] = { 0U };
+  uint64_t sn[4U] = { 0U };
+  uint64_t q[12U] = { 0U };
+  uint64_t t[8U] = { 0U };
+  Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(scalar, s);
+  uint64_t borrow = sub4_il(s, prime256order_buffer, sn);
+  copy_conditional(s, sn, borrow - (uint64_t)1U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    uint64_t d = s[i / (uint32_t)8U] >> (i % (uint32_t)8U * (uint32_t)8U + (uint32_t)4U) & (uint64_t)15U;
+    precomp_table_select(t, i, d);
+    point_add_mixed(q, t, d, q);
+  }
+  point_double(q, q, tempBuffer);
+  point_double(q, q, tempBuffer);
+  point_double(q, q, tempBuffer);
+  point_double(q, q, tempBuffer);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    uint64_t d = s[i / (uint32_t)8U] >> i % (uint32_t)8U * (uint32_t)8U & (uint64_t)15U;
+    precomp_table_select(t, i, d);
+    point_add_mixed(q, t, d, q);
+  }
+  copy_point(q, result);
+}
+
 void
 Hacl_Impl_P256_Core_secretToPublic(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g(q, scalar, buff);
   norm(q, result, buff);
 }
 
 static void secretToPublicWithoutNorm(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
-  uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
-  copy_point(q, result);
+  point_mul_g(result, scalar, buff);
 }
 
-static const
-uint64_t
-prime256order_buffer[4U] =
-  {
-    (uint64_t)17562291160714782033U,
-    (uint64_t)13611842547513532036U,
-    (uint64_t)18446744073709551615U,
-    (uint64_t)18446744069414584320U
-  };
-
 static const
 uint8_t
 order_inverse_buffer[32U] =
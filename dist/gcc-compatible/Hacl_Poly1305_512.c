@@ -0,0 +1,442 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Poly1305_512.h"
+
+/*
+  The context is laid out as follows, each entry being five 26-bit limbs:
+    acc  (ctx + 0)  the accumulator, meaningful in lane 0 between calls
+    r    (ctx + 5)  r, broadcast
+    r5   (ctx + 10) 5 * r, broadcast
+    rn   (ctx + 15) r^8, broadcast
+    rn5  (ctx + 20) 5 * r^8, broadcast
+    rv   (ctx + 25) the powers of r that each lane is multiplied by when the
+                    eight lanes are folded back together
+*/
+
+static inline void
+fmul_r_512(Lib_IntVector_Intrinsics_vec512 *out, Lib_IntVector_Intrinsics_vec512 *f, Lib_IntVector_Intrinsics_vec512 *r, Lib_IntVector_Intrinsics_vec512 *r5)
+{
+  Lib_IntVector_Intrinsics_vec512 r0 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 r1 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 r2 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 r3 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 r4 = r[4U];
+  Lib_IntVector_Intrinsics_vec512 r51 = r5[1U];
+  Lib_IntVector_Intrinsics_vec512 r52 = r5[2U];
+  Lib_IntVector_Intrinsics_vec512 r53 = r5[3U];
+  Lib_IntVector_Intrinsics_vec512 r54 = r5[4U];
+  Lib_IntVector_Intrinsics_vec512 f0 = f[0U];
+  Lib_IntVector_Intrinsics_vec512 f1 = f[1U];
+  Lib_IntVector_Intrinsics_vec512 f2 = f[2U];
+  Lib_IntVector_Intrinsics_vec512 f3 = f[3U];
+  Lib_IntVector_Intrinsics_vec512 f4 = f[4U];
+  Lib_IntVector_Intrinsics_vec512 a0 = Lib_IntVector_Intrinsics_vec512_mul64(r0, f0);
+  Lib_IntVector_Intrinsics_vec512 a1 = Lib_IntVector_Intrinsics_vec512_mul64(r1, f0);
+  Lib_IntVector_Intrinsics_vec512 a2 = Lib_IntVector_Intrinsics_vec512_mul64(r2, f0);
+  Lib_IntVector_Intrinsics_vec512 a3 = Lib_IntVector_Intrinsics_vec512_mul64(r3, f0);
+  Lib_IntVector_Intrinsics_vec512 a4 = Lib_IntVector_Intrinsics_vec512_mul64(r4, f0);
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r54, f1));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r0, f1));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r1, f1));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r2, f1));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r3, f1));
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r53, f2));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r54, f2));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r0, f2));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r1, f2));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r2, f2));
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r52, f3));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r53, f3));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r54, f3));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r0, f3));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r1, f3));
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r51, f4));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r52, f4));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r53, f4));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r54, f4));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r0, f4));
+  out[0U] = a0;
+  out[1U] = a1;
+  out[2U] = a2;
+  out[3U] = a3;
+  out[4U] = a4;
+}
+
+static inline void carry_wide_512(Lib_IntVector_Intrinsics_vec512 *f)
+{
+  Lib_IntVector_Intrinsics_vec512 t0 = f[0U];
+  Lib_IntVector_Intrinsics_vec512 t1 = f[1U];
+  Lib_IntVector_Intrinsics_vec512 t2 = f[2U];
+  Lib_IntVector_Intrinsics_vec512 t3 = f[3U];
+  Lib_IntVector_Intrinsics_vec512 t4 = f[4U];
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512 z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t3, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t0, mask26);
+  Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t1, z0);
+  Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec512 z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 t = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec512 z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec512 z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+  f[0U] = x02;
+  f[1U] = x12;
+  f[2U] = x21;
+  f[3U] = x32;
+  f[4U] = x42;
+}
+
+/*
+  Splits eight consecutive 16-byte blocks into limbs. The unpacking puts the
+  blocks in lanes 0, 2, 4, 6, 1, 3, 5, 7, i.e. lane l holds block
+  (l / 2) + 4 * (l % 2); the powers in rv follow the same order.
+*/
+static inline void load_blocks8_512(Lib_IntVector_Intrinsics_vec512 *e, uint8_t *b)
+{
+  Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_load64_le(b);
+  Lib_IntVector_Intrinsics_vec512 hi = Lib_IntVector_Intrinsics_vec512_load64_le(b + (uint32_t)64U);
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512 m0 = Lib_IntVector_Intrinsics_vec512_interleave_low64(lo, hi);
+  Lib_IntVector_Intrinsics_vec512 m1 = Lib_IntVector_Intrinsics_vec512_interleave_high64(lo, hi);
+  e[0U] = Lib_IntVector_Intrinsics_vec512_and(m0, mask26);
+  e[1U] = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(m0, (uint32_t)26U), mask26);
+  e[2U] =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(m0, (uint32_t)52U),
+      Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(m1, Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffU)), (uint32_t)12U));
+  e[3U] = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(m1, (uint32_t)14U), mask26);
+  e[4U] = Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(m1, (uint32_t)40U), Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x1000000U));
+}
+
+/*
+  Loads a single block of len <= 16 bytes, padded as per the Poly1305 spec,
+  into all lanes.
+*/
+static inline void load_block1_512(Lib_IntVector_Intrinsics_vec512 *e, uint8_t *b, uint32_t len)
+{
+  uint8_t tmp[16U] = { 0U };
+  memcpy(tmp, b, len * sizeof (uint8_t));
+  uint64_t lo = load64_le(tmp);
+  uint64_t hi = load64_le(tmp + (uint32_t)8U);
+  Lib_IntVector_Intrinsics_vec512 f0 = Lib_IntVector_Intrinsics_vec512_load64(lo);
+  Lib_IntVector_Intrinsics_vec512 f1 = Lib_IntVector_Intrinsics_vec512_load64(hi);
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  e[0U] = Lib_IntVector_Intrinsics_vec512_and(f0, mask26);
+  e[1U] = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f0, (uint32_t)26U), mask26);
+  e[2U] =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(f0, (uint32_t)52U),
+      Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(f1, Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffU)), (uint32_t)12U));
+  e[3U] = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(f1, (uint32_t)14U), mask26);
+  e[4U] = Lib_IntVector_Intrinsics_vec512_shift_right64(f1, (uint32_t)40U);
+  uint64_t b1 = (uint64_t)1U << len * (uint32_t)8U % (uint32_t)26U;
+  Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_load64(b1);
+  Lib_IntVector_Intrinsics_vec512 fi = e[len * (uint32_t)8U / (uint32_t)26U];
+  e[len * (uint32_t)8U / (uint32_t)26U] = Lib_IntVector_Intrinsics_vec512_or(fi, mask);
+}
+
+/*
+  acc = (acc + e) * r, in every lane.
+*/
+static inline void fadd_mul_r_512(Lib_IntVector_Intrinsics_vec512 *acc, Lib_IntVector_Intrinsics_vec512 *e, Lib_IntVector_Intrinsics_vec512 *r, Lib_IntVector_Intrinsics_vec512 *r5)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    acc[i] = Lib_IntVector_Intrinsics_vec512_add64(acc[i], e[i]);
+  }
+  fmul_r_512(acc, acc, r, r5);
+  carry_wide_512(acc);
+}
+
+/*
+  Multiplies lane l of acc by its power of r, adds up the eight lanes, and
+  broadcasts the result back to all lanes.
+*/
+static inline void fmul_rv_normalize_512(Lib_IntVector_Intrinsics_vec512 *acc, Lib_IntVector_Intrinsics_vec512 *pre)
+{
+  Lib_IntVector_Intrinsics_vec512 *rv = pre + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec512 rv5[5U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    rv5[i] = Lib_IntVector_Intrinsics_vec512_smul64(rv[i], (uint64_t)5U);
+  }
+  fmul_r_512(acc, acc, rv, rv5);
+  carry_wide_512(acc);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512 x = acc[i];
+    Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(x, Lib_IntVector_Intrinsics_vec512_interleave_high256(x, x));
+    Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(x1, Lib_IntVector_Intrinsics_vec512_interleave_high128(x1, x1));
+    Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_add64(x2, Lib_IntVector_Intrinsics_vec512_interleave_high64(x2, x2));
+    acc[i] = Lib_IntVector_Intrinsics_vec512_load64(Lib_IntVector_Intrinsics_vec512_extract64(x3, (uint32_t)0U));
+  }
+  carry_wide_512(acc);
+}
+
+uint32_t Hacl_Poly1305_512_blocklen = (uint32_t)16U;
+
+void Hacl_Poly1305_512_poly1305_init(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + (uint32_t)5U;
+  uint8_t *kr = key;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    acc[i] = Lib_IntVector_Intrinsics_vec512_zero;
+  }
+  uint64_t u0 = load64_le(kr);
+  uint64_t lo = u0;
+  uint64_t u = load64_le(kr + (uint32_t)8U);
+  uint64_t hi = u;
+  uint64_t mask0 = (uint64_t)0x0ffffffc0fffffffU;
+  uint64_t mask1 = (uint64_t)0x0ffffffc0ffffffcU;
+  uint64_t lo1 = lo & mask0;
+  uint64_t hi1 = hi & mask1;
+  Lib_IntVector_Intrinsics_vec512 *r = pre;
+  Lib_IntVector_Intrinsics_vec512 *r5 = pre + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *rn = pre + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec512 *rn_5 = pre + (uint32_t)15U;
+  Lib_IntVector_Intrinsics_vec512 *rv = pre + (uint32_t)20U;
+  r[0U] = Lib_IntVector_Intrinsics_vec512_load64(lo1 & (uint64_t)0x3ffffffU);
+  r[1U] = Lib_IntVector_Intrinsics_vec512_load64(lo1 >> (uint32_t)26U & (uint64_t)0x3ffffffU);
+  r[2U] = Lib_IntVector_Intrinsics_vec512_load64(lo1 >> (uint32_t)52U | (hi1 & (uint64_t)0x3fffU) << (uint32_t)12U);
+  r[3U] = Lib_IntVector_Intrinsics_vec512_load64(hi1 >> (uint32_t)14U & (uint64_t)0x3ffffffU);
+  r[4U] = Lib_IntVector_Intrinsics_vec512_load64(hi1 >> (uint32_t)40U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    r5[i] = Lib_IntVector_Intrinsics_vec512_smul64(r[i], (uint64_t)5U);
+  }
+  /* pw + 5 * (k - 1) holds r^k, broadcast, for k = 1 .. 8 */
+  Lib_IntVector_Intrinsics_vec512 pw[40U];
+  memcpy(pw, r, (uint32_t)5U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    fmul_r_512(pw + i * (uint32_t)5U, pw + (i - (uint32_t)1U) * (uint32_t)5U, r, r5);
+    carry_wide_512(pw + i * (uint32_t)5U);
+  }
+  memcpy(rn, pw + (uint32_t)35U, (uint32_t)5U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    rn_5[i] = Lib_IntVector_Intrinsics_vec512_smul64(rn[i], (uint64_t)5U);
+  }
+  /* Lane l holds block (l / 2) + 4 * (l % 2) of eight, which is due r^(8 - block). */
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    rv[i] =
+      Lib_IntVector_Intrinsics_vec512_load64s(Lib_IntVector_Intrinsics_vec512_extract64(pw[(uint32_t)35U + i], (uint32_t)0U),
+        Lib_IntVector_Intrinsics_vec512_extract64(pw[(uint32_t)15U + i], (uint32_t)0U),
+        Lib_IntVector_Intrinsics_vec512_extract64(pw[(uint32_t)30U + i], (uint32_t)0U),
+        Lib_IntVector_Intrinsics_vec512_extract64(pw[(uint32_t)10U + i], (uint32_t)0U),
+        Lib_IntVector_Intrinsics_vec512_extract64(pw[(uint32_t)25U + i], (uint32_t)0U),
+        Lib_IntVector_Intrinsics_vec512_extract64(pw[(uint32_t)5U + i], (uint32_t)0U),
+        Lib_IntVector_Intrinsics_vec512_extract64(pw[(uint32_t)20U + i], (uint32_t)0U),
+        Lib_IntVector_Intrinsics_vec512_extract64(pw[i], (uint32_t)0U));
+  }
+}
+
+void Hacl_Poly1305_512_poly1305_update1(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 e[5U];
+  load_block1_512(e, text, (uint32_t)16U);
+  fadd_mul_r_512(acc, e, pre, pre + (uint32_t)5U);
+}
+
+void Hacl_Poly1305_512_poly1305_update(Lib_IntVector_Intrinsics_vec512 *ctx, uint32_t len, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec512 *pre = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  uint32_t sz_block = (uint32_t)128U;
+  uint32_t len0 = len / sz_block * sz_block;
+  uint8_t *t0 = text;
+  if (len0 > (uint32_t)0U)
+  {
+    Lib_IntVector_Intrinsics_vec512 *rn = pre + (uint32_t)10U;
+    Lib_IntVector_Intrinsics_vec512 *rn5 = pre + (uint32_t)15U;
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    load_blocks8_512(e, t0);
+    Lib_IntVector_Intrinsics_vec512 lane0 =
+      Lib_IntVector_Intrinsics_vec512_load64s((uint64_t)0xffffffffffffffffU,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+    {
+      acc[i] = Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_and(acc[i], lane0), e[i]);
+    }
+    uint32_t nb = (len0 - sz_block) / sz_block;
+    for (uint32_t i = (uint32_t)0U; i < nb; i++)
+    {
+      uint8_t *block = t0 + sz_block + i * sz_block;
+      load_blocks8_512(e, block);
+      fmul_r_512(acc, acc, rn, rn5);
+      carry_wide_512(acc);
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)5U; j++)
+      {
+        acc[j] = Lib_IntVector_Intrinsics_vec512_add64(acc[j], e[j]);
+      }
+    }
+    fmul_rv_normalize_512(acc, pre);
+  }
+  uint32_t len1 = len - len0;
+  uint8_t *t1 = text + len0;
+  uint32_t nb = len1 / (uint32_t)16U;
+  uint32_t rem = len1 % (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = t1 + i * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    load_block1_512(e, block, (uint32_t)16U);
+    fadd_mul_r_512(acc, e, pre, pre + (uint32_t)5U);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *last = t1 + nb * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    load_block1_512(e, last, rem);
+    fadd_mul_r_512(acc, e, pre, pre + (uint32_t)5U);
+  }
+}
+
+void Hacl_Poly1305_512_poly1305_finish(uint8_t *tag, uint8_t *key, Lib_IntVector_Intrinsics_vec512 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  uint8_t *ks = key + (uint32_t)16U;
+  uint64_t f0 = Lib_IntVector_Intrinsics_vec512_extract64(acc[0U], (uint32_t)0U);
+  uint64_t f13 = Lib_IntVector_Intrinsics_vec512_extract64(acc[1U], (uint32_t)0U);
+  uint64_t f23 = Lib_IntVector_Intrinsics_vec512_extract64(acc[2U], (uint32_t)0U);
+  uint64_t f33 = Lib_IntVector_Intrinsics_vec512_extract64(acc[3U], (uint32_t)0U);
+  uint64_t f40 = Lib_IntVector_Intrinsics_vec512_extract64(acc[4U], (uint32_t)0U);
+  uint64_t l0 = f0 + (uint64_t)0U;
+  uint64_t tmp00 = l0 & (uint64_t)0x3ffffffU;
+  uint64_t c00 = l0 >> (uint32_t)26U;
+  uint64_t l1 = f13 + c00;
+  uint64_t tmp10 = l1 & (uint64_t)0x3ffffffU;
+  uint64_t c10 = l1 >> (uint32_t)26U;
+  uint64_t l2 = f23 + c10;
+  uint64_t tmp20 = l2 & (uint64_t)0x3ffffffU;
+  uint64_t c20 = l2 >> (uint32_t)26U;
+  uint64_t l3 = f33 + c20;
+  uint64_t tmp30 = l3 & (uint64_t)0x3ffffffU;
+  uint64_t c30 = l3 >> (uint32_t)26U;
+  uint64_t l4 = f40 + c30;
+  uint64_t tmp40 = l4 & (uint64_t)0x3ffffffU;
+  uint64_t c40 = l4 >> (uint32_t)26U;
+  uint64_t f010 = tmp00 + c40 * (uint64_t)5U;
+  uint64_t f110 = tmp10;
+  uint64_t f210 = tmp20;
+  uint64_t f310 = tmp30;
+  uint64_t f410 = tmp40;
+  uint64_t l = f010 + (uint64_t)0U;
+  uint64_t tmp0 = l & (uint64_t)0x3ffffffU;
+  uint64_t c0 = l >> (uint32_t)26U;
+  uint64_t l5 = f110 + c0;
+  uint64_t tmp1 = l5 & (uint64_t)0x3ffffffU;
+  uint64_t c1 = l5 >> (uint32_t)26U;
+  uint64_t l6 = f210 + c1;
+  uint64_t tmp2 = l6 & (uint64_t)0x3ffffffU;
+  uint64_t c2 = l6 >> (uint32_t)26U;
+  uint64_t l7 = f310 + c2;
+  uint64_t tmp3 = l7 & (uint64_t)0x3ffffffU;
+  uint64_t c3 = l7 >> (uint32_t)26U;
+  uint64_t l8 = f410 + c3;
+  uint64_t tmp4 = l8 & (uint64_t)0x3ffffffU;
+  uint64_t c4 = l8 >> (uint32_t)26U;
+  uint64_t f02 = tmp0 + c4 * (uint64_t)5U;
+  uint64_t f12 = tmp1;
+  uint64_t f22 = tmp2;
+  uint64_t f32 = tmp3;
+  uint64_t f42 = tmp4;
+  uint64_t mh = (uint64_t)0x3ffffffU;
+  uint64_t ml = (uint64_t)0x3fffffbU;
+  uint64_t mask = FStar_UInt64_eq_mask(f42, mh);
+  uint64_t mask1 = mask & FStar_UInt64_eq_mask(f32, mh);
+  uint64_t mask2 = mask1 & FStar_UInt64_eq_mask(f22, mh);
+  uint64_t mask3 = mask2 & FStar_UInt64_eq_mask(f12, mh);
+  uint64_t mask4 = mask3 & ~~FStar_UInt64_gte_mask(f02, ml);
+  uint64_t ph = mask4 & mh;
+  uint64_t pl = mask4 & ml;
+  uint64_t o0 = f02 - pl;
+  uint64_t o1 = f12 - ph;
+  uint64_t o2 = f22 - ph;
+  uint64_t o3 = f32 - ph;
+  uint64_t o4 = f42 - ph;
+  uint64_t f011 = o0;
+  uint64_t f111 = o1;
+  uint64_t f211 = o2;
+  uint64_t f311 = o3;
+  uint64_t f411 = o4;
+  uint64_t f01 = f011;
+  uint64_t f112 = f111;
+  uint64_t f212 = f211;
+  uint64_t f312 = f311;
+  uint64_t f41 = f411;
+  uint64_t lo = (f01 | f112 << (uint32_t)26U) | f212 << (uint32_t)52U;
+  uint64_t hi = (f212 >> (uint32_t)12U | f312 << (uint32_t)14U) | f41 << (uint32_t)40U;
+  uint64_t f10 = lo;
+  uint64_t f11 = hi;
+  uint64_t u0 = load64_le(ks);
+  uint64_t lo0 = u0;
+  uint64_t u = load64_le(ks + (uint32_t)8U);
+  uint64_t hi0 = u;
+  uint64_t f20 = lo0;
+  uint64_t f21 = hi0;
+  uint64_t r0 = f10 + f20;
+  uint64_t r1 = f11 + f21;
+  uint64_t c = (r0 ^ ((r0 ^ f20) | ((r0 - f20) ^ f20))) >> (uint32_t)63U;
+  uint64_t r11 = r1 + c;
+  uint64_t f30 = r0;
+  uint64_t f31 = r11;
+  store64_le(tag, f30);
+  store64_le(tag + (uint32_t)8U, f31);
+}
+
+void Hacl_Poly1305_512_poly1305_mac(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec512 ctx[30U];
+  for (uint32_t _i = 0U; _i < (uint32_t)30U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  Hacl_Poly1305_512_poly1305_init(ctx, key);
+  Hacl_Poly1305_512_poly1305_update(ctx, len, text);
+  Hacl_Poly1305_512_poly1305_finish(tag, key, ctx);
+}
+
@@ -740,3 +740,362 @@ Hacl_RSAPSS_rsapss_pkey_verify(
   return false;
 }
 
+
+static inline bool
+load_crt_skey(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dPb,
+  uint8_t *dQb,
+  uint8_t *qInvb,
+  uint64_t *pkey,
+  uint64_t *p,
+  uint64_t *q,
+  uint64_t *dP,
+  uint64_t *dQ,
+  uint64_t *qInv
+)
+{
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pLen = (pBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pbLen = (pBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  bool b = load_pkey(modBits, eBits, nb, eb, pkey);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, pb, p);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, qb, q);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, dPb, dP);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, dQb, dQ);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pbLen, qInvb, qInv);
+  uint64_t m0 = check_modulus_u64(pBits, p);
+  uint64_t m1 = ((uint64_t)0U - (q[0U] & (uint64_t)1U)) & check_num_bits_u64(pBits, q);
+  uint64_t m2 = check_exponent_u64(pBits, dP) & check_exponent_u64(pBits, dQ);
+  uint64_t m3 = check_exponent_u64(pBits, qInv);
+  /* The factors must multiply back to n, or every CRT signature would be
+     rejected by the final check in Hacl_RSAPSS_rsapss_crt_sign. */
+  KRML_CHECK_SIZE(sizeof (uint64_t), pLen + pLen);
+  uint64_t pq[pLen + pLen];
+  memset(pq, 0U, (pLen + pLen) * sizeof (uint64_t));
+  Hacl_Bignum64_mul(pLen, p, q, pq);
+  uint64_t mask = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  for (uint32_t i = (uint32_t)0U; i < pLen + pLen; i++)
+  {
+    uint64_t ni;
+    if (i < nLen)
+    {
+      ni = pkey[i];
+    }
+    else
+    {
+      ni = (uint64_t)0U;
+    }
+    uint64_t uu____0 = FStar_UInt64_eq_mask(pq[i], ni);
+    mask = uu____0 & mask;
+  }
+  uint64_t m = m0 & m1 & m2 & m3 & mask;
+  return b && m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
+
+Hacl_RSAPSS_rsapss_crt_ctx
+*Hacl_RSAPSS_new_rsapss_crt_ctx(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dPb,
+  uint8_t *dQb,
+  uint8_t *qInvb
+)
+{
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pLen = (pBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  if
+  (
+    !((uint32_t)1U
+    < modBits
+    && (uint32_t)0U < eBits
+    && (uint32_t)1U < pBits
+    && pBits < modBits
+    && nLen <= (uint32_t)33554431U
+    && eLen <= (uint32_t)67108863U
+    && nLen + nLen <= (uint32_t)0xffffffffU - eLen
+    && nLen <= pLen + pLen)
+  )
+  {
+    return NULL;
+  }
+  uint32_t pkeyLen = nLen + nLen + eLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), pkeyLen);
+  uint64_t *pkey = KRML_HOST_CALLOC(pkeyLen, sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)5U * pLen);
+  uint64_t *factors = KRML_HOST_CALLOC((uint32_t)5U * pLen, sizeof (uint64_t));
+  if (pkey == NULL || factors == NULL)
+  {
+    KRML_HOST_FREE(pkey);
+    KRML_HOST_FREE(factors);
+    return NULL;
+  }
+  uint64_t *p = factors;
+  uint64_t *q = factors + pLen;
+  uint64_t *dP = factors + (uint32_t)2U * pLen;
+  uint64_t *dQ = factors + (uint32_t)3U * pLen;
+  uint64_t *qInv = factors + (uint32_t)4U * pLen;
+  bool b = load_crt_skey(modBits, eBits, pBits, nb, eb, pb, qb, dPb, dQb, qInvb, pkey, p, q, dP, dQ, qInv);
+  if (!b)
+  {
+    Lib_Memzero0_memzero(factors, (uint32_t)5U * pLen * sizeof (uint64_t));
+    KRML_HOST_FREE(factors);
+    KRML_HOST_FREE(pkey);
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (Hacl_RSAPSS_rsapss_crt_ctx), (uint32_t)1U);
+  Hacl_RSAPSS_rsapss_crt_ctx *ctx = KRML_HOST_MALLOC(sizeof (Hacl_RSAPSS_rsapss_crt_ctx));
+  ctx->modBits = modBits;
+  ctx->eBits = eBits;
+  ctx->pBits = pBits;
+  ctx->pkey = pkey;
+  ctx->ctx_p = Hacl_Bignum64_mont_ctx_init(pLen, p);
+  ctx->ctx_q = Hacl_Bignum64_mont_ctx_init(pLen, q);
+  ctx->factors = factors;
+  return ctx;
+}
+
+void Hacl_RSAPSS_rsapss_crt_ctx_free(Hacl_RSAPSS_rsapss_crt_ctx *ctx)
+{
+  uint32_t pLen = (ctx->pBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  Hacl_Bignum64_mont_ctx_free(ctx->ctx_p);
+  Hacl_Bignum64_mont_ctx_free(ctx->ctx_q);
+  Lib_Memzero0_memzero(ctx->factors, (uint32_t)5U * pLen * sizeof (uint64_t));
+  KRML_HOST_FREE(ctx->factors);
+  KRML_HOST_FREE(ctx->pkey);
+  KRML_HOST_FREE(ctx);
+}
+
+bool
+Hacl_RSAPSS_rsapss_crt_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSAPSS_rsapss_crt_ctx *ctx,
+  uint32_t sLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+)
+{
+  uint32_t modBits = ctx->modBits;
+  uint32_t eBits = ctx->eBits;
+  uint32_t pBits = ctx->pBits;
+  uint32_t hLen = hash_len(a);
+  bool
+  b =
+    sLen
+    <= (uint32_t)0xffffffffU - hLen - (uint32_t)8U
+    &&
+      sLen
+      + hLen
+      + (uint32_t)2U
+      <= (modBits - (uint32_t)1U - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (b)
+  {
+    uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    uint32_t pLen = (pBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+    uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    uint64_t *q = ctx->factors + pLen;
+    uint64_t *dP = ctx->factors + (uint32_t)2U * pLen;
+    uint64_t *dQ = ctx->factors + (uint32_t)3U * pLen;
+    uint64_t *qInv = ctx->factors + (uint32_t)4U * pLen;
+    KRML_CHECK_SIZE(sizeof (uint64_t), pLen + pLen);
+    uint64_t m[pLen + pLen];
+    memset(m, 0U, (pLen + pLen) * sizeof (uint64_t));
+    uint32_t emBits = modBits - (uint32_t)1U;
+    uint32_t emLen = (emBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+    KRML_CHECK_SIZE(sizeof (uint8_t), emLen);
+    uint8_t em[emLen];
+    memset(em, 0U, emLen * sizeof (uint8_t));
+    pss_encode(a, sLen, salt, msgLen, msg, emBits, em);
+    Hacl_Bignum_Convert_bn_from_bytes_be_uint64(emLen, em, m);
+    /* s1 = m^dP mod p, s2 = m^dQ mod q */
+    KRML_CHECK_SIZE(sizeof (uint64_t), pLen);
+    uint64_t mr[pLen];
+    memset(mr, 0U, pLen * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), pLen);
+    uint64_t s1[pLen];
+    memset(s1, 0U, pLen * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), pLen + pLen);
+    uint64_t s2[pLen + pLen];
+    memset(s2, 0U, (pLen + pLen) * sizeof (uint64_t));
+    Hacl_Bignum64_mod_precomp(ctx->ctx_p, m, mr);
+    Hacl_Bignum64_mod_exp_consttime_precomp(ctx->ctx_p, mr, pBits, dP, s1);
+    Hacl_Bignum64_mod_precomp(ctx->ctx_q, m, mr);
+    Hacl_Bignum64_mod_exp_consttime_precomp(ctx->ctx_q, mr, pBits, dQ, s2);
+    /* h = qInv * (s1 - s2) mod p */
+    KRML_CHECK_SIZE(sizeof (uint64_t), pLen);
+    uint64_t h[pLen];
+    memset(h, 0U, pLen * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), pLen + pLen);
+    uint64_t tmp[pLen + pLen];
+    memset(tmp, 0U, (pLen + pLen) * sizeof (uint64_t));
+    Hacl_Bignum64_mod_precomp(ctx->ctx_p, s2, mr);
+    Hacl_GenericField64_sub(ctx->ctx_p, s1, mr, h);
+    Hacl_Bignum64_mul(pLen, h, qInv, tmp);
+    Hacl_Bignum64_mod_precomp(ctx->ctx_p, tmp, h);
+    /* s = s2 + q * h < n */
+    Hacl_Bignum64_mul(pLen, q, h, tmp);
+    uint64_t c = Hacl_Bignum64_add(pLen + pLen, tmp, s2, tmp);
+    uint64_t *s = tmp;
+    /* Check s^e = m mod n before releasing s: a fault in either half-size
+       exponentiation would otherwise leak a factor of n. */
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t m_[nLen];
+    memset(m_, 0U, nLen * sizeof (uint64_t));
+    uint64_t *n = ctx->pkey;
+    uint64_t *r2 = ctx->pkey + nLen;
+    uint64_t *e = ctx->pkey + nLen + nLen;
+    uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(n[0U]);
+    Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(nLen, n, mu, r2, s, eBits, e, m_);
+    uint64_t mask = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+    for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+    {
+      uint64_t uu____0 = FStar_UInt64_eq_mask(m[i], m_[i]);
+      mask = uu____0 & mask;
+    }
+    uint64_t eq_m = mask;
+    for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+    {
+      uint64_t *os = s;
+      uint64_t x = s[i];
+      uint64_t x0 = eq_m & x;
+      os[i] = x0;
+    }
+    bool eq_b = eq_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(k, s, sgnt);
+    /* Everything below was derived from dP, dQ and qInv; this is the only
+       return, whether or not the check passed. */
+    Lib_Memzero0_memzero(mr, pLen * sizeof (uint64_t));
+    Lib_Memzero0_memzero(s1, pLen * sizeof (uint64_t));
+    Lib_Memzero0_memzero(s2, (pLen + pLen) * sizeof (uint64_t));
+    Lib_Memzero0_memzero(h, pLen * sizeof (uint64_t));
+    Lib_Memzero0_memzero(tmp, (pLen + pLen) * sizeof (uint64_t));
+    return eq_b;
+  }
+  return false;
+}
+
+Hacl_RSAPSS_rsapss_verify_ctx
+*Hacl_RSAPSS_new_verify_ctx(uint32_t modBits, uint32_t eBits, uint8_t *nb, uint8_t *eb)
+{
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t eLen = (eBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t *pkey = Hacl_RSAPSS_new_rsapss_load_pkey(modBits, eBits, nb, eb);
+  if (pkey == NULL)
+  {
+    return NULL;
+  }
+  uint64_t *n = pkey;
+  uint64_t *e = pkey + nLen + nLen;
+  bool is_f4 = e[0U] == (uint64_t)65537U;
+  for (uint32_t i = (uint32_t)1U; i < eLen; i++)
+  {
+    is_f4 = is_f4 && e[i] == (uint64_t)0U;
+  }
+  KRML_CHECK_SIZE(sizeof (Hacl_RSAPSS_rsapss_verify_ctx), (uint32_t)1U);
+  Hacl_RSAPSS_rsapss_verify_ctx
+  *ctx = KRML_HOST_MALLOC(sizeof (Hacl_RSAPSS_rsapss_verify_ctx));
+  ctx->modBits = modBits;
+  ctx->eBits = eBits;
+  ctx->e_is_65537 = is_f4;
+  ctx->pkey = pkey;
+  ctx->ctx_n = Hacl_Bignum64_mont_ctx_init(nLen, n);
+  return ctx;
+}
+
+void Hacl_RSAPSS_rsapss_verify_ctx_free(Hacl_RSAPSS_rsapss_verify_ctx *ctx)
+{
+  Hacl_Bignum64_mont_ctx_free(ctx->ctx_n);
+  KRML_HOST_FREE(ctx->pkey);
+  KRML_HOST_FREE(ctx);
+}
+
+bool
+Hacl_RSAPSS_rsapss_verify_with_ctx(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSAPSS_rsapss_verify_ctx *ctx,
+  uint32_t sLen,
+  uint32_t k,
+  uint8_t *sgnt,
+  uint32_t msgLen,
+  uint8_t *msg
+)
+{
+  uint32_t modBits = ctx->modBits;
+  uint32_t hLen = hash_len(a);
+  bool
+  b =
+    sLen
+    <= (uint32_t)0xffffffffU - hLen - (uint32_t)8U
+    && k == (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (!b)
+  {
+    return false;
+  }
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t *n = ctx->pkey;
+  uint64_t *e = ctx->pkey + nLen + nLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t m[nLen];
+  memset(m, 0U, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t s[nLen];
+  memset(s, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(k, sgnt, s);
+  if (Hacl_Bignum64_lt_mask(nLen, s, n) != (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  {
+    return false;
+  }
+  if (ctx->e_is_65537)
+  {
+    /* s^(2^16 + 1): sixteen squarings and one multiplication, in the
+       Montgomery domain of the cached context. */
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t sM[nLen];
+    memset(sM, 0U, nLen * sizeof (uint64_t));
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t accM[nLen];
+    memset(accM, 0U, nLen * sizeof (uint64_t));
+    Hacl_GenericField64_to_field(ctx->ctx_n, s, sM);
+    memcpy(accM, sM, nLen * sizeof (uint64_t));
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      Hacl_GenericField64_sqr(ctx->ctx_n, accM, accM);
+    }
+    Hacl_GenericField64_mul(ctx->ctx_n, accM, sM, accM);
+    Hacl_GenericField64_from_field(ctx->ctx_n, accM, m);
+  }
+  else
+  {
+    Hacl_Bignum64_mod_exp_vartime_precomp(ctx->ctx_n, s, ctx->eBits, e, m);
+  }
+  if ((modBits - (uint32_t)1U) % (uint32_t)8U == (uint32_t)0U)
+  {
+    uint32_t i = (modBits - (uint32_t)1U) / (uint32_t)64U;
+    uint32_t j = (modBits - (uint32_t)1U) % (uint32_t)64U;
+    if ((m[i] >> j & (uint64_t)1U) != (uint64_t)0U)
+    {
+      return false;
+    }
+  }
+  uint32_t emBits = modBits - (uint32_t)1U;
+  uint32_t emLen = (emBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), emLen);
+  uint8_t em[emLen];
+  memset(em, 0U, emLen * sizeof (uint8_t));
+  Hacl_Bignum_Convert_bn_to_bytes_be_uint64(emLen, m, em);
+  return pss_verify(a, sLen, msgLen, msg, emBits, em);
+}
@@ -39,6 +39,9 @@ extern "C" {
 
 #include "Hacl_Kremlib.h"
 #include "Hacl_Bignum.h"
+#include "Hacl_Bignum64.h"
+#include "Hacl_GenericField64.h"
+#include "Lib_Memzero0.h"
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
 
@@ -112,6 +115,97 @@ Hacl_RSAPSS_rsapss_pkey_verify(
   uint8_t *msg
 );
 
+/*
+  A private key in CRT form, loaded once and kept across signatures. It holds
+  the public key (n, r2 mod n, e) in the layout of Hacl_RSAPSS_new_rsapss_load_pkey,
+  Montgomery contexts for p and q, and dP, dQ, qInv, each pBits bits wide.
+*/
+typedef struct Hacl_RSAPSS_rsapss_crt_ctx_s
+{
+  uint32_t modBits;
+  uint32_t eBits;
+  uint32_t pBits;
+  uint64_t *pkey;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *ctx_p;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *ctx_q;
+  uint64_t *factors;
+}
+Hacl_RSAPSS_rsapss_crt_ctx;
+
+/*
+  Load a CRT private key. pb, qb, dPb, dQb and qInvb are big-endian and
+  (pBits - 1) / 8 + 1 bytes long; p must have exactly pBits bits and q at most
+  pBits bits, with p * q = n. Returns NULL if any check fails.
+*/
+Hacl_RSAPSS_rsapss_crt_ctx
+*Hacl_RSAPSS_new_rsapss_crt_ctx(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dPb,
+  uint8_t *dQb,
+  uint8_t *qInvb
+);
+
+void Hacl_RSAPSS_rsapss_crt_ctx_free(Hacl_RSAPSS_rsapss_crt_ctx *ctx);
+
+/*
+  Same result as Hacl_RSAPSS_rsapss_sign, computed with two pBits-wide
+  exponentiations and Garner recombination. The signature is checked against
+  the public exponent before it is written out.
+*/
+bool
+Hacl_RSAPSS_rsapss_crt_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSAPSS_rsapss_crt_ctx *ctx,
+  uint32_t sLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+);
+
+/*
+  A public key loaded once for repeated verification: the pkey layout of
+  Hacl_RSAPSS_new_rsapss_load_pkey plus a Montgomery context for n. Keys with
+  e = 65537 take a dedicated square-and-multiply chain.
+*/
+typedef struct Hacl_RSAPSS_rsapss_verify_ctx_s
+{
+  uint32_t modBits;
+  uint32_t eBits;
+  bool e_is_65537;
+  uint64_t *pkey;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *ctx_n;
+}
+Hacl_RSAPSS_rsapss_verify_ctx;
+
+/*
+  Returns NULL if the key is rejected by the checks of Hacl_RSAPSS_new_rsapss_load_pkey.
+*/
+Hacl_RSAPSS_rsapss_verify_ctx
+*Hacl_RSAPSS_new_verify_ctx(uint32_t modBits, uint32_t eBits, uint8_t *nb, uint8_t *eb);
+
+void Hacl_RSAPSS_rsapss_verify_ctx_free(Hacl_RSAPSS_rsapss_verify_ctx *ctx);
+
+/*
+  Same result as Hacl_RSAPSS_rsapss_verify under the key of ctx.
+*/
+bool
+Hacl_RSAPSS_rsapss_verify_with_ctx(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSAPSS_rsapss_verify_ctx *ctx,
+  uint32_t sLen,
+  uint32_t k,
+  uint8_t *sgnt,
+  uint32_t msgLen,
+  uint8_t *msg
+);
+
 #if defined(__cplusplus)
 }
 #endif
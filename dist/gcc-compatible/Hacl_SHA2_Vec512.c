@@ -0,0 +1,687 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SHA2_Vec512.h"
+
+static const
+uint32_t
+k224_256[64U] =
+  {
+    (uint32_t)0x428a2f98U, (uint32_t)0x71374491U, (uint32_t)0xb5c0fbcfU, (uint32_t)0xe9b5dba5U,
+    (uint32_t)0x3956c25bU, (uint32_t)0x59f111f1U, (uint32_t)0x923f82a4U, (uint32_t)0xab1c5ed5U,
+    (uint32_t)0xd807aa98U, (uint32_t)0x12835b01U, (uint32_t)0x243185beU, (uint32_t)0x550c7dc3U,
+    (uint32_t)0x72be5d74U, (uint32_t)0x80deb1feU, (uint32_t)0x9bdc06a7U, (uint32_t)0xc19bf174U,
+    (uint32_t)0xe49b69c1U, (uint32_t)0xefbe4786U, (uint32_t)0x0fc19dc6U, (uint32_t)0x240ca1ccU,
+    (uint32_t)0x2de92c6fU, (uint32_t)0x4a7484aaU, (uint32_t)0x5cb0a9dcU, (uint32_t)0x76f988daU,
+    (uint32_t)0x983e5152U, (uint32_t)0xa831c66dU, (uint32_t)0xb00327c8U, (uint32_t)0xbf597fc7U,
+    (uint32_t)0xc6e00bf3U, (uint32_t)0xd5a79147U, (uint32_t)0x06ca6351U, (uint32_t)0x14292967U,
+    (uint32_t)0x27b70a85U, (uint32_t)0x2e1b2138U, (uint32_t)0x4d2c6dfcU, (uint32_t)0x53380d13U,
+    (uint32_t)0x650a7354U, (uint32_t)0x766a0abbU, (uint32_t)0x81c2c92eU, (uint32_t)0x92722c85U,
+    (uint32_t)0xa2bfe8a1U, (uint32_t)0xa81a664bU, (uint32_t)0xc24b8b70U, (uint32_t)0xc76c51a3U,
+    (uint32_t)0xd192e819U, (uint32_t)0xd6990624U, (uint32_t)0xf40e3585U, (uint32_t)0x106aa070U,
+    (uint32_t)0x19a4c116U, (uint32_t)0x1e376c08U, (uint32_t)0x2748774cU, (uint32_t)0x34b0bcb5U,
+    (uint32_t)0x391c0cb3U, (uint32_t)0x4ed8aa4aU, (uint32_t)0x5b9cca4fU, (uint32_t)0x682e6ff3U,
+    (uint32_t)0x748f82eeU, (uint32_t)0x78a5636fU, (uint32_t)0x84c87814U, (uint32_t)0x8cc70208U,
+    (uint32_t)0x90befffaU, (uint32_t)0xa4506cebU, (uint32_t)0xbef9a3f7U, (uint32_t)0xc67178f2U
+  };
+
+static const
+uint64_t
+k384_512[80U] =
+  {
+    (uint64_t)0x428a2f98d728ae22U, (uint64_t)0x7137449123ef65cdU, (uint64_t)0xb5c0fbcfec4d3b2fU,
+    (uint64_t)0xe9b5dba58189dbbcU, (uint64_t)0x3956c25bf348b538U, (uint64_t)0x59f111f1b605d019U,
+    (uint64_t)0x923f82a4af194f9bU, (uint64_t)0xab1c5ed5da6d8118U, (uint64_t)0xd807aa98a3030242U,
+    (uint64_t)0x12835b0145706fbeU, (uint64_t)0x243185be4ee4b28cU, (uint64_t)0x550c7dc3d5ffb4e2U,
+    (uint64_t)0x72be5d74f27b896fU, (uint64_t)0x80deb1fe3b1696b1U, (uint64_t)0x9bdc06a725c71235U,
+    (uint64_t)0xc19bf174cf692694U, (uint64_t)0xe49b69c19ef14ad2U, (uint64_t)0xefbe4786384f25e3U,
+    (uint64_t)0x0fc19dc68b8cd5b5U, (uint64_t)0x240ca1cc77ac9c65U, (uint64_t)0x2de92c6f592b0275U,
+    (uint64_t)0x4a7484aa6ea6e483U, (uint64_t)0x5cb0a9dcbd41fbd4U, (uint64_t)0x76f988da831153b5U,
+    (uint64_t)0x983e5152ee66dfabU, (uint64_t)0xa831c66d2db43210U, (uint64_t)0xb00327c898fb213fU,
+    (uint64_t)0xbf597fc7beef0ee4U, (uint64_t)0xc6e00bf33da88fc2U, (uint64_t)0xd5a79147930aa725U,
+    (uint64_t)0x06ca6351e003826fU, (uint64_t)0x142929670a0e6e70U, (uint64_t)0x27b70a8546d22ffcU,
+    (uint64_t)0x2e1b21385c26c926U, (uint64_t)0x4d2c6dfc5ac42aedU, (uint64_t)0x53380d139d95b3dfU,
+    (uint64_t)0x650a73548baf63deU, (uint64_t)0x766a0abb3c77b2a8U, (uint64_t)0x81c2c92e47edaee6U,
+    (uint64_t)0x92722c851482353bU, (uint64_t)0xa2bfe8a14cf10364U, (uint64_t)0xa81a664bbc423001U,
+    (uint64_t)0xc24b8b70d0f89791U, (uint64_t)0xc76c51a30654be30U, (uint64_t)0xd192e819d6ef5218U,
+    (uint64_t)0xd69906245565a910U, (uint64_t)0xf40e35855771202aU, (uint64_t)0x106aa07032bbd1b8U,
+    (uint64_t)0x19a4c116b8d2d0c8U, (uint64_t)0x1e376c085141ab53U, (uint64_t)0x2748774cdf8eeb99U,
+    (uint64_t)0x34b0bcb5e19b48a8U, (uint64_t)0x391c0cb3c5c95a63U, (uint64_t)0x4ed8aa4ae3418acbU,
+    (uint64_t)0x5b9cca4f7763e373U, (uint64_t)0x682e6ff3d6b2b8a3U, (uint64_t)0x748f82ee5defb2fcU,
+    (uint64_t)0x78a5636f43172f60U, (uint64_t)0x84c87814a1f0ab72U, (uint64_t)0x8cc702081a6439ecU,
+    (uint64_t)0x90befffa23631e28U, (uint64_t)0xa4506cebde82bde9U, (uint64_t)0xbef9a3f7b2c67915U,
+    (uint64_t)0xc67178f2e372532bU, (uint64_t)0xca273eceea26619cU, (uint64_t)0xd186b8c721c0c207U,
+    (uint64_t)0xeada7dd6cde0eb1eU, (uint64_t)0xf57d4f7fee6ed178U, (uint64_t)0x06f067aa72176fbaU,
+    (uint64_t)0x0a637dc5a2c898a6U, (uint64_t)0x113f9804bef90daeU, (uint64_t)0x1b710b35131c471bU,
+    (uint64_t)0x28db77f523047d84U, (uint64_t)0x32caab7b40c72493U, (uint64_t)0x3c9ebe0a15c9bebcU,
+    (uint64_t)0x431d67c49c100d4cU, (uint64_t)0x4cc5d4becb3e42b6U, (uint64_t)0x597f299cfc657e2aU,
+    (uint64_t)0x5fcb6fab3ad6faecU, (uint64_t)0x6c44198c4a475817U
+  };
+
+static const uint8_t zero_block[128U] = { 0U };
+
+/* Transposes four groups of four rows, given as the 128-bit blocks of a, b, c
+   and d, so that o[k] holds block k of each of a, b, c and d, in that order. */
+static inline void
+transpose4x4_128(
+  Lib_IntVector_Intrinsics_vec512 *o,
+  uint32_t stride,
+  Lib_IntVector_Intrinsics_vec512 a,
+  Lib_IntVector_Intrinsics_vec512 b,
+  Lib_IntVector_Intrinsics_vec512 c,
+  Lib_IntVector_Intrinsics_vec512 d
+)
+{
+  Lib_IntVector_Intrinsics_vec512 ab0 = Lib_IntVector_Intrinsics_vec512_interleave_low128(a, b);
+  Lib_IntVector_Intrinsics_vec512 ab1 = Lib_IntVector_Intrinsics_vec512_interleave_high128(a, b);
+  Lib_IntVector_Intrinsics_vec512 cd0 = Lib_IntVector_Intrinsics_vec512_interleave_low128(c, d);
+  Lib_IntVector_Intrinsics_vec512 cd1 = Lib_IntVector_Intrinsics_vec512_interleave_high128(c, d);
+  o[0U] = Lib_IntVector_Intrinsics_vec512_interleave_low256(ab0, cd0);
+  o[stride] = Lib_IntVector_Intrinsics_vec512_interleave_low256(ab1, cd1);
+  o[(uint32_t)2U * stride] = Lib_IntVector_Intrinsics_vec512_interleave_high256(ab0, cd0);
+  o[(uint32_t)3U * stride] = Lib_IntVector_Intrinsics_vec512_interleave_high256(ab1, cd1);
+}
+
+static inline void
+transpose16x16_32(Lib_IntVector_Intrinsics_vec512 *c, Lib_IntVector_Intrinsics_vec512 *r)
+{
+  Lib_IntVector_Intrinsics_vec512 t[16U];
+  Lib_IntVector_Intrinsics_vec512 u[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    t[(uint32_t)2U * i] =
+      Lib_IntVector_Intrinsics_vec512_interleave_low32(r[(uint32_t)2U * i],
+        r[(uint32_t)2U * i + (uint32_t)1U]);
+    t[(uint32_t)2U * i + (uint32_t)1U] =
+      Lib_IntVector_Intrinsics_vec512_interleave_high32(r[(uint32_t)2U * i],
+        r[(uint32_t)2U * i + (uint32_t)1U]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512 *ti = t + (uint32_t)4U * i;
+    Lib_IntVector_Intrinsics_vec512 *ui = u + (uint32_t)4U * i;
+    ui[0U] = Lib_IntVector_Intrinsics_vec512_interleave_low64(ti[0U], ti[2U]);
+    ui[1U] = Lib_IntVector_Intrinsics_vec512_interleave_high64(ti[0U], ti[2U]);
+    ui[2U] = Lib_IntVector_Intrinsics_vec512_interleave_low64(ti[1U], ti[3U]);
+    ui[3U] = Lib_IntVector_Intrinsics_vec512_interleave_high64(ti[1U], ti[3U]);
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    transpose4x4_128(c + j,
+      (uint32_t)4U,
+      u[j],
+      u[(uint32_t)4U + j],
+      u[(uint32_t)8U + j],
+      u[(uint32_t)12U + j]);
+  }
+}
+
+static inline void
+transpose8x8_64(Lib_IntVector_Intrinsics_vec512 *c, Lib_IntVector_Intrinsics_vec512 *r)
+{
+  Lib_IntVector_Intrinsics_vec512 t[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    t[(uint32_t)2U * i] =
+      Lib_IntVector_Intrinsics_vec512_interleave_low64(r[(uint32_t)2U * i],
+        r[(uint32_t)2U * i + (uint32_t)1U]);
+    t[(uint32_t)2U * i + (uint32_t)1U] =
+      Lib_IntVector_Intrinsics_vec512_interleave_high64(r[(uint32_t)2U * i],
+        r[(uint32_t)2U * i + (uint32_t)1U]);
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)2U; j++)
+  {
+    transpose4x4_128(c + j,
+      (uint32_t)2U,
+      t[j],
+      t[(uint32_t)2U + j],
+      t[(uint32_t)4U + j],
+      t[(uint32_t)6U + j]);
+  }
+}
+
+/* One compression per lane: st holds sixteen scalar SHA2-256 states, one per
+   lane, and b[i] points to the 64-byte block for lane i. */
+static inline void sha256_update16(uint32_t *st, uint8_t **b)
+{
+  Lib_IntVector_Intrinsics_vec512 ws[16U];
+  Lib_IntVector_Intrinsics_vec512 r[16U];
+  Lib_IntVector_Intrinsics_vec512 hash[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    r[i] = Lib_IntVector_Intrinsics_vec512_load32_be(b[i]);
+  }
+  transpose16x16_32(ws, r);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *s = st + i;
+    hash[i] =
+      Lib_IntVector_Intrinsics_vec512_load32s(s[0U],
+        s[8U],
+        s[16U],
+        s[24U],
+        s[32U],
+        s[40U],
+        s[48U],
+        s[56U],
+        s[64U],
+        s[72U],
+        s[80U],
+        s[88U],
+        s[96U],
+        s[104U],
+        s[112U],
+        s[120U]);
+  }
+  Lib_IntVector_Intrinsics_vec512 a = hash[0U];
+  Lib_IntVector_Intrinsics_vec512 b0 = hash[1U];
+  Lib_IntVector_Intrinsics_vec512 c = hash[2U];
+  Lib_IntVector_Intrinsics_vec512 d = hash[3U];
+  Lib_IntVector_Intrinsics_vec512 e = hash[4U];
+  Lib_IntVector_Intrinsics_vec512 f = hash[5U];
+  Lib_IntVector_Intrinsics_vec512 g = hash[6U];
+  Lib_IntVector_Intrinsics_vec512 h = hash[7U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    if (i >= (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec512 w2 = ws[(i - (uint32_t)2U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec512 w15 = ws[(i - (uint32_t)15U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec512
+      s1 =
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(w2,
+            (uint32_t)17U),
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(w2,
+              (uint32_t)19U),
+            Lib_IntVector_Intrinsics_vec512_shift_right32(w2, (uint32_t)10U)));
+      Lib_IntVector_Intrinsics_vec512
+      s0 =
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(w15,
+            (uint32_t)7U),
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(w15,
+              (uint32_t)18U),
+            Lib_IntVector_Intrinsics_vec512_shift_right32(w15, (uint32_t)3U)));
+      ws[i % (uint32_t)16U] =
+        Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(s1,
+            ws[(i - (uint32_t)7U) % (uint32_t)16U]),
+          Lib_IntVector_Intrinsics_vec512_add32(s0, ws[i % (uint32_t)16U]));
+    }
+    Lib_IntVector_Intrinsics_vec512
+    sigma1 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(e,
+          (uint32_t)6U),
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(e,
+            (uint32_t)11U),
+          Lib_IntVector_Intrinsics_vec512_rotate_right32(e, (uint32_t)25U)));
+    Lib_IntVector_Intrinsics_vec512
+    ch =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(e, f),
+        Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_lognot(e), g));
+    Lib_IntVector_Intrinsics_vec512
+    t1 =
+      Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(h, sigma1),
+        Lib_IntVector_Intrinsics_vec512_add32(Lib_IntVector_Intrinsics_vec512_add32(ch,
+            Lib_IntVector_Intrinsics_vec512_load32(k224_256[i])),
+          ws[i % (uint32_t)16U]));
+    Lib_IntVector_Intrinsics_vec512
+    sigma0 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(a,
+          (uint32_t)2U),
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right32(a,
+            (uint32_t)13U),
+          Lib_IntVector_Intrinsics_vec512_rotate_right32(a, (uint32_t)22U)));
+    Lib_IntVector_Intrinsics_vec512
+    maj =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(a, b0),
+        Lib_IntVector_Intrinsics_vec512_and(c, Lib_IntVector_Intrinsics_vec512_xor(a, b0)));
+    Lib_IntVector_Intrinsics_vec512 t2 = Lib_IntVector_Intrinsics_vec512_add32(sigma0, maj);
+    h = g;
+    g = f;
+    f = e;
+    e = Lib_IntVector_Intrinsics_vec512_add32(d, t1);
+    d = c;
+    c = b0;
+    b0 = a;
+    a = Lib_IntVector_Intrinsics_vec512_add32(t1, t2);
+  }
+  hash[0U] = Lib_IntVector_Intrinsics_vec512_add32(hash[0U], a);
+  hash[1U] = Lib_IntVector_Intrinsics_vec512_add32(hash[1U], b0);
+  hash[2U] = Lib_IntVector_Intrinsics_vec512_add32(hash[2U], c);
+  hash[3U] = Lib_IntVector_Intrinsics_vec512_add32(hash[3U], d);
+  hash[4U] = Lib_IntVector_Intrinsics_vec512_add32(hash[4U], e);
+  hash[5U] = Lib_IntVector_Intrinsics_vec512_add32(hash[5U], f);
+  hash[6U] = Lib_IntVector_Intrinsics_vec512_add32(hash[6U], g);
+  hash[7U] = Lib_IntVector_Intrinsics_vec512_add32(hash[7U], h);
+  uint32_t tmp[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512_store32_le((uint8_t *)(tmp + i * (uint32_t)16U), hash[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)16U; j++)
+    {
+      st[j * (uint32_t)8U + i] = tmp[i * (uint32_t)16U + j];
+    }
+  }
+}
+
+/* One compression per lane: st holds eight scalar SHA2-512 states, one per
+   lane, and b[i] points to the 128-byte block for lane i. */
+static inline void sha512_update8(uint64_t *st, uint8_t **b)
+{
+  Lib_IntVector_Intrinsics_vec512 ws[16U];
+  Lib_IntVector_Intrinsics_vec512 r[8U];
+  Lib_IntVector_Intrinsics_vec512 hash[8U];
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)2U; k++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      r[i] = Lib_IntVector_Intrinsics_vec512_load64_be(b[i] + k * (uint32_t)64U);
+    }
+    transpose8x8_64(ws + k * (uint32_t)8U, r);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t *s = st + i;
+    hash[i] =
+      Lib_IntVector_Intrinsics_vec512_load64s(s[0U],
+        s[8U],
+        s[16U],
+        s[24U],
+        s[32U],
+        s[40U],
+        s[48U],
+        s[56U]);
+  }
+  Lib_IntVector_Intrinsics_vec512 a = hash[0U];
+  Lib_IntVector_Intrinsics_vec512 b0 = hash[1U];
+  Lib_IntVector_Intrinsics_vec512 c = hash[2U];
+  Lib_IntVector_Intrinsics_vec512 d = hash[3U];
+  Lib_IntVector_Intrinsics_vec512 e = hash[4U];
+  Lib_IntVector_Intrinsics_vec512 f = hash[5U];
+  Lib_IntVector_Intrinsics_vec512 g = hash[6U];
+  Lib_IntVector_Intrinsics_vec512 h = hash[7U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)80U; i++)
+  {
+    if (i >= (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec512 w2 = ws[(i - (uint32_t)2U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec512 w15 = ws[(i - (uint32_t)15U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec512
+      s1 =
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(w2,
+            (uint32_t)19U),
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(w2,
+              (uint32_t)61U),
+            Lib_IntVector_Intrinsics_vec512_shift_right64(w2, (uint32_t)6U)));
+      Lib_IntVector_Intrinsics_vec512
+      s0 =
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(w15,
+            (uint32_t)1U),
+          Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(w15,
+              (uint32_t)8U),
+            Lib_IntVector_Intrinsics_vec512_shift_right64(w15, (uint32_t)7U)));
+      ws[i % (uint32_t)16U] =
+        Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(s1,
+            ws[(i - (uint32_t)7U) % (uint32_t)16U]),
+          Lib_IntVector_Intrinsics_vec512_add64(s0, ws[i % (uint32_t)16U]));
+    }
+    Lib_IntVector_Intrinsics_vec512
+    sigma1 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(e,
+          (uint32_t)14U),
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(e,
+            (uint32_t)18U),
+          Lib_IntVector_Intrinsics_vec512_rotate_right64(e, (uint32_t)41U)));
+    Lib_IntVector_Intrinsics_vec512
+    ch =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(e, f),
+        Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_lognot(e), g));
+    Lib_IntVector_Intrinsics_vec512
+    t1 =
+      Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(h, sigma1),
+        Lib_IntVector_Intrinsics_vec512_add64(Lib_IntVector_Intrinsics_vec512_add64(ch,
+            Lib_IntVector_Intrinsics_vec512_load64(k384_512[i])),
+          ws[i % (uint32_t)16U]));
+    Lib_IntVector_Intrinsics_vec512
+    sigma0 =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(a,
+          (uint32_t)28U),
+        Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_rotate_right64(a,
+            (uint32_t)34U),
+          Lib_IntVector_Intrinsics_vec512_rotate_right64(a, (uint32_t)39U)));
+    Lib_IntVector_Intrinsics_vec512
+    maj =
+      Lib_IntVector_Intrinsics_vec512_xor(Lib_IntVector_Intrinsics_vec512_and(a, b0),
+        Lib_IntVector_Intrinsics_vec512_and(c, Lib_IntVector_Intrinsics_vec512_xor(a, b0)));
+    Lib_IntVector_Intrinsics_vec512 t2 = Lib_IntVector_Intrinsics_vec512_add64(sigma0, maj);
+    h = g;
+    g = f;
+    f = e;
+    e = Lib_IntVector_Intrinsics_vec512_add64(d, t1);
+    d = c;
+    c = b0;
+    b0 = a;
+    a = Lib_IntVector_Intrinsics_vec512_add64(t1, t2);
+  }
+  hash[0U] = Lib_IntVector_Intrinsics_vec512_add64(hash[0U], a);
+  hash[1U] = Lib_IntVector_Intrinsics_vec512_add64(hash[1U], b0);
+  hash[2U] = Lib_IntVector_Intrinsics_vec512_add64(hash[2U], c);
+  hash[3U] = Lib_IntVector_Intrinsics_vec512_add64(hash[3U], d);
+  hash[4U] = Lib_IntVector_Intrinsics_vec512_add64(hash[4U], e);
+  hash[5U] = Lib_IntVector_Intrinsics_vec512_add64(hash[5U], f);
+  hash[6U] = Lib_IntVector_Intrinsics_vec512_add64(hash[6U], g);
+  hash[7U] = Lib_IntVector_Intrinsics_vec512_add64(hash[7U], h);
+  uint64_t tmp[64U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec512_store64_le((uint8_t *)(tmp + i * (uint32_t)8U), hash[i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      st[j * (uint32_t)8U + i] = tmp[i * (uint32_t)8U + j];
+    }
+  }
+}
+
+/* Per-lane bookkeeping of the multi-buffer scheduler. The final one or two
+   blocks of each message (tail + padding + length) are materialized in last,
+   so that every message is just a sequence of whole blocks. */
+typedef struct lane_s
+{
+  uint32_t msg;
+  uint32_t blk;
+  uint32_t n_full;
+  uint32_t n_blocks;
+  uint8_t last[256U];
+}
+lane;
+
+static inline void
+lane_start(lane *l, uint32_t msg, uint8_t *input, uint32_t len, uint32_t block_len)
+{
+  uint32_t len_len = block_len / (uint32_t)8U;
+  uint32_t rem = len % block_len;
+  uint32_t n_last;
+  if (rem + (uint32_t)1U + len_len <= block_len)
+  {
+    n_last = (uint32_t)1U;
+  }
+  else
+  {
+    n_last = (uint32_t)2U;
+  }
+  l->msg = msg;
+  l->blk = (uint32_t)0U;
+  l->n_full = len / block_len;
+  l->n_blocks = l->n_full + n_last;
+  memset(l->last, 0U, n_last * block_len * sizeof (uint8_t));
+  memcpy(l->last, input + l->n_full * block_len, rem * sizeof (uint8_t));
+  l->last[rem] = (uint8_t)0x80U;
+  store64_be(l->last + n_last * block_len - (uint32_t)8U, (uint64_t)len << (uint32_t)3U);
+}
+
+static inline uint8_t *lane_block(lane *l, uint8_t *input, uint32_t block_len)
+{
+  if (l->blk < l->n_full)
+  {
+    return input + l->blk * block_len;
+  }
+  return l->last + (l->blk - l->n_full) * block_len;
+}
+
+static void
+sha256_multi(
+  void (*init)(uint32_t *x0),
+  void (*finish)(uint32_t *x0, uint8_t *x1),
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  uint32_t st[128U] = { 0U };
+  lane lanes[16U];
+  bool active[16U] = { 0U };
+  uint32_t n_active = (uint32_t)0U;
+  uint32_t next = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U && next < n; i++)
+  {
+    init(st + i * (uint32_t)8U);
+    lane_start(lanes + i, next, inputs[next], input_lens[next], (uint32_t)64U);
+    active[i] = true;
+    n_active++;
+    next++;
+  }
+  while (n_active > (uint32_t)1U || (n_active == (uint32_t)1U && next < n))
+  {
+    uint8_t *b[16U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      if (active[i])
+      {
+        b[i] = lane_block(lanes + i, inputs[lanes[i].msg], (uint32_t)64U);
+      }
+      else
+      {
+        b[i] = (uint8_t *)zero_block;
+      }
+    }
+    sha256_update16(st, b);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      if (active[i])
+      {
+        lanes[i].blk++;
+        if (lanes[i].blk == lanes[i].n_blocks)
+        {
+          finish(st + i * (uint32_t)8U, dsts[lanes[i].msg]);
+          if (next < n)
+          {
+            init(st + i * (uint32_t)8U);
+            lane_start(lanes + i, next, inputs[next], input_lens[next], (uint32_t)64U);
+            next++;
+          }
+          else
+          {
+            active[i] = false;
+            n_active--;
+          }
+        }
+      }
+    }
+  }
+  /* A lone straggler is cheaper to finish with the scalar code. */
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    if (active[i])
+    {
+      lane *l = lanes + i;
+      uint32_t *s = st + i * (uint32_t)8U;
+      uint8_t *input = inputs[l->msg];
+      if (l->blk < l->n_full)
+      {
+        Hacl_Hash_SHA2_update_multi_256(s,
+          input + l->blk * (uint32_t)64U,
+          l->n_full - l->blk);
+        l->blk = l->n_full;
+      }
+      Hacl_Hash_SHA2_update_multi_256(s,
+        l->last + (l->blk - l->n_full) * (uint32_t)64U,
+        l->n_blocks - l->blk);
+      finish(s, dsts[l->msg]);
+    }
+  }
+}
+
+static void
+sha512_multi(
+  void (*init)(uint64_t *x0),
+  void (*finish)(uint64_t *x0, uint8_t *x1),
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  uint64_t st[64U] = { 0U };
+  lane lanes[8U];
+  bool active[8U] = { 0U };
+  uint32_t n_active = (uint32_t)0U;
+  uint32_t next = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U && next < n; i++)
+  {
+    init(st + i * (uint32_t)8U);
+    lane_start(lanes + i, next, inputs[next], input_lens[next], (uint32_t)128U);
+    active[i] = true;
+    n_active++;
+    next++;
+  }
+  while (n_active > (uint32_t)1U || (n_active == (uint32_t)1U && next < n))
+  {
+    uint8_t *b[8U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (active[i])
+      {
+        b[i] = lane_block(lanes + i, inputs[lanes[i].msg], (uint32_t)128U);
+      }
+      else
+      {
+        b[i] = (uint8_t *)zero_block;
+      }
+    }
+    sha512_update8(st, b);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      if (active[i])
+      {
+        lanes[i].blk++;
+        if (lanes[i].blk == lanes[i].n_blocks)
+        {
+          finish(st + i * (uint32_t)8U, dsts[lanes[i].msg]);
+          if (next < n)
+          {
+            init(st + i * (uint32_t)8U);
+            lane_start(lanes + i, next, inputs[next], input_lens[next], (uint32_t)128U);
+            next++;
+          }
+          else
+          {
+            active[i] = false;
+            n_active--;
+          }
+        }
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    if (active[i])
+    {
+      lane *l = lanes + i;
+      uint64_t *s = st + i * (uint32_t)8U;
+      uint8_t *input = inputs[l->msg];
+      if (l->blk < l->n_full)
+      {
+        Hacl_Hash_SHA2_update_multi_512(s,
+          input + l->blk * (uint32_t)128U,
+          l->n_full - l->blk);
+        l->blk = l->n_full;
+      }
+      Hacl_Hash_SHA2_update_multi_512(s,
+        l->last + (l->blk - l->n_full) * (uint32_t)128U,
+        l->n_blocks - l->blk);
+      finish(s, dsts[l->msg]);
+    }
+  }
+}
+
+void
+Hacl_SHA2_Vec512_sha224_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha256_multi(Hacl_Hash_Core_SHA2_init_224,
+    Hacl_Hash_Core_SHA2_finish_224,
+    n,
+    dsts,
+    inputs,
+    input_lens);
+}
+
+void
+Hacl_SHA2_Vec512_sha256_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha256_multi(Hacl_Hash_Core_SHA2_init_256,
+    Hacl_Hash_Core_SHA2_finish_256,
+    n,
+    dsts,
+    inputs,
+    input_lens);
+}
+
+void
+Hacl_SHA2_Vec512_sha384_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha512_multi(Hacl_Hash_Core_SHA2_init_384,
+    Hacl_Hash_Core_SHA2_finish_384,
+    n,
+    dsts,
+    inputs,
+    input_lens);
+}
+
+void
+Hacl_SHA2_Vec512_sha512_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha512_multi(Hacl_Hash_Core_SHA2_init_512,
+    Hacl_Hash_Core_SHA2_finish_512,
+    n,
+    dsts,
+    inputs,
+    input_lens);
+}
+
@@ -0,0 +1,89 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_SHA2_Vec512_H
+#define __Hacl_SHA2_Vec512_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Hash.h"
+
+/*
+Hash `n` independent messages at once: message i is the `input_lens[i]`-byte
+  buffer `inputs[i]` and its digest is written to `dsts[i]`.
+
+  This is the AVX-512 counterpart of Hacl_SHA2_Vec256.h: SHA2-224 and SHA2-256
+  run sixteen messages side by side in the 32-bit lanes of a vec512, and
+  SHA2-384 and SHA2-512 run eight messages in the 64-bit lanes. Lanes are
+  refilled as in the vec256 version, so inputs of different lengths can be
+  mixed freely.
+*/
+void
+Hacl_SHA2_Vec512_sha224_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+);
+
+void
+Hacl_SHA2_Vec512_sha256_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+);
+
+void
+Hacl_SHA2_Vec512_sha384_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+);
+
+void
+Hacl_SHA2_Vec512_sha512_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_SHA2_Vec512_H_DEFINED
+#endif
@@ -0,0 +1,609 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_SHA3_Vec256.h"
+
+/*
+  Four independent Keccak-f[1600] states, one per 64-bit lane of a vec256:
+  s[i] holds word i of each of the four states. Blocks are laid out 224 bytes
+  apart, one per state, so that seven 4 x 4 transpositions cover the 25 words
+  of the state (the words past the rate are zero).
+*/
+
+static void state_permute4(Lib_IntVector_Intrinsics_vec256 *s)
+{
+  Lib_IntVector_Intrinsics_vec256 s0 = s[0U];
+  Lib_IntVector_Intrinsics_vec256 s1 = s[1U];
+  Lib_IntVector_Intrinsics_vec256 s2 = s[2U];
+  Lib_IntVector_Intrinsics_vec256 s3 = s[3U];
+  Lib_IntVector_Intrinsics_vec256 s4 = s[4U];
+  Lib_IntVector_Intrinsics_vec256 s5 = s[5U];
+  Lib_IntVector_Intrinsics_vec256 s6 = s[6U];
+  Lib_IntVector_Intrinsics_vec256 s7 = s[7U];
+  Lib_IntVector_Intrinsics_vec256 s8 = s[8U];
+  Lib_IntVector_Intrinsics_vec256 s9 = s[9U];
+  Lib_IntVector_Intrinsics_vec256 s10 = s[10U];
+  Lib_IntVector_Intrinsics_vec256 s11 = s[11U];
+  Lib_IntVector_Intrinsics_vec256 s12 = s[12U];
+  Lib_IntVector_Intrinsics_vec256 s13 = s[13U];
+  Lib_IntVector_Intrinsics_vec256 s14 = s[14U];
+  Lib_IntVector_Intrinsics_vec256 s15 = s[15U];
+  Lib_IntVector_Intrinsics_vec256 s16 = s[16U];
+  Lib_IntVector_Intrinsics_vec256 s17 = s[17U];
+  Lib_IntVector_Intrinsics_vec256 s18 = s[18U];
+  Lib_IntVector_Intrinsics_vec256 s19 = s[19U];
+  Lib_IntVector_Intrinsics_vec256 s20 = s[20U];
+  Lib_IntVector_Intrinsics_vec256 s21 = s[21U];
+  Lib_IntVector_Intrinsics_vec256 s22 = s[22U];
+  Lib_IntVector_Intrinsics_vec256 s23 = s[23U];
+  Lib_IntVector_Intrinsics_vec256 s24 = s[24U];
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)24U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 c0 = Lib_IntVector_Intrinsics_vec256_xor(s0, Lib_IntVector_Intrinsics_vec256_xor(s5, Lib_IntVector_Intrinsics_vec256_xor(s10, Lib_IntVector_Intrinsics_vec256_xor(s15, s20))));
+    Lib_IntVector_Intrinsics_vec256 c1 = Lib_IntVector_Intrinsics_vec256_xor(s1, Lib_IntVector_Intrinsics_vec256_xor(s6, Lib_IntVector_Intrinsics_vec256_xor(s11, Lib_IntVector_Intrinsics_vec256_xor(s16, s21))));
+    Lib_IntVector_Intrinsics_vec256 c2 = Lib_IntVector_Intrinsics_vec256_xor(s2, Lib_IntVector_Intrinsics_vec256_xor(s7, Lib_IntVector_Intrinsics_vec256_xor(s12, Lib_IntVector_Intrinsics_vec256_xor(s17, s22))));
+    Lib_IntVector_Intrinsics_vec256 c3 = Lib_IntVector_Intrinsics_vec256_xor(s3, Lib_IntVector_Intrinsics_vec256_xor(s8, Lib_IntVector_Intrinsics_vec256_xor(s13, Lib_IntVector_Intrinsics_vec256_xor(s18, s23))));
+    Lib_IntVector_Intrinsics_vec256 c4 = Lib_IntVector_Intrinsics_vec256_xor(s4, Lib_IntVector_Intrinsics_vec256_xor(s9, Lib_IntVector_Intrinsics_vec256_xor(s14, Lib_IntVector_Intrinsics_vec256_xor(s19, s24))));
+    Lib_IntVector_Intrinsics_vec256 d0 = Lib_IntVector_Intrinsics_vec256_xor(c4, Lib_IntVector_Intrinsics_vec256_rotate_left64(c1, (uint32_t)1U));
+    Lib_IntVector_Intrinsics_vec256 d1 = Lib_IntVector_Intrinsics_vec256_xor(c0, Lib_IntVector_Intrinsics_vec256_rotate_left64(c2, (uint32_t)1U));
+    Lib_IntVector_Intrinsics_vec256 d2 = Lib_IntVector_Intrinsics_vec256_xor(c1, Lib_IntVector_Intrinsics_vec256_rotate_left64(c3, (uint32_t)1U));
+    Lib_IntVector_Intrinsics_vec256 d3 = Lib_IntVector_Intrinsics_vec256_xor(c2, Lib_IntVector_Intrinsics_vec256_rotate_left64(c4, (uint32_t)1U));
+    Lib_IntVector_Intrinsics_vec256 d4 = Lib_IntVector_Intrinsics_vec256_xor(c3, Lib_IntVector_Intrinsics_vec256_rotate_left64(c0, (uint32_t)1U));
+    Lib_IntVector_Intrinsics_vec256 b0 = Lib_IntVector_Intrinsics_vec256_xor(s0, d0);
+    Lib_IntVector_Intrinsics_vec256 b1 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s6, d1), (uint32_t)44U);
+    Lib_IntVector_Intrinsics_vec256 b2 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s12, d2), (uint32_t)43U);
+    Lib_IntVector_Intrinsics_vec256 b3 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s18, d3), (uint32_t)21U);
+    Lib_IntVector_Intrinsics_vec256 b4 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s24, d4), (uint32_t)14U);
+    Lib_IntVector_Intrinsics_vec256 b5 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s3, d3), (uint32_t)28U);
+    Lib_IntVector_Intrinsics_vec256 b6 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s9, d4), (uint32_t)20U);
+    Lib_IntVector_Intrinsics_vec256 b7 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s10, d0), (uint32_t)3U);
+    Lib_IntVector_Intrinsics_vec256 b8 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s16, d1), (uint32_t)45U);
+    Lib_IntVector_Intrinsics_vec256 b9 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s22, d2), (uint32_t)61U);
+    Lib_IntVector_Intrinsics_vec256 b10 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s1, d1), (uint32_t)1U);
+    Lib_IntVector_Intrinsics_vec256 b11 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s7, d2), (uint32_t)6U);
+    Lib_IntVector_Intrinsics_vec256 b12 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s13, d3), (uint32_t)25U);
+    Lib_IntVector_Intrinsics_vec256 b13 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s19, d4), (uint32_t)8U);
+    Lib_IntVector_Intrinsics_vec256 b14 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s20, d0), (uint32_t)18U);
+    Lib_IntVector_Intrinsics_vec256 b15 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s4, d4), (uint32_t)27U);
+    Lib_IntVector_Intrinsics_vec256 b16 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s5, d0), (uint32_t)36U);
+    Lib_IntVector_Intrinsics_vec256 b17 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s11, d1), (uint32_t)10U);
+    Lib_IntVector_Intrinsics_vec256 b18 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s17, d2), (uint32_t)15U);
+    Lib_IntVector_Intrinsics_vec256 b19 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s23, d3), (uint32_t)56U);
+    Lib_IntVector_Intrinsics_vec256 b20 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s2, d2), (uint32_t)62U);
+    Lib_IntVector_Intrinsics_vec256 b21 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s8, d3), (uint32_t)55U);
+    Lib_IntVector_Intrinsics_vec256 b22 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s14, d4), (uint32_t)39U);
+    Lib_IntVector_Intrinsics_vec256 b23 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s15, d0), (uint32_t)41U);
+    Lib_IntVector_Intrinsics_vec256 b24 = Lib_IntVector_Intrinsics_vec256_rotate_left64(Lib_IntVector_Intrinsics_vec256_xor(s21, d1), (uint32_t)2U);
+    s0 = Lib_IntVector_Intrinsics_vec256_xor(b0, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b1), b2));
+    s1 = Lib_IntVector_Intrinsics_vec256_xor(b1, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b2), b3));
+    s2 = Lib_IntVector_Intrinsics_vec256_xor(b2, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b3), b4));
+    s3 = Lib_IntVector_Intrinsics_vec256_xor(b3, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b4), b0));
+    s4 = Lib_IntVector_Intrinsics_vec256_xor(b4, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b0), b1));
+    s5 = Lib_IntVector_Intrinsics_vec256_xor(b5, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b6), b7));
+    s6 = Lib_IntVector_Intrinsics_vec256_xor(b6, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b7), b8));
+    s7 = Lib_IntVector_Intrinsics_vec256_xor(b7, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b8), b9));
+    s8 = Lib_IntVector_Intrinsics_vec256_xor(b8, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b9), b5));
+    s9 = Lib_IntVector_Intrinsics_vec256_xor(b9, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b5), b6));
+    s10 = Lib_IntVector_Intrinsics_vec256_xor(b10, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b11), b12));
+    s11 = Lib_IntVector_Intrinsics_vec256_xor(b11, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b12), b13));
+    s12 = Lib_IntVector_Intrinsics_vec256_xor(b12, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b13), b14));
+    s13 = Lib_IntVector_Intrinsics_vec256_xor(b13, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b14), b10));
+    s14 = Lib_IntVector_Intrinsics_vec256_xor(b14, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b10), b11));
+    s15 = Lib_IntVector_Intrinsics_vec256_xor(b15, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b16), b17));
+    s16 = Lib_IntVector_Intrinsics_vec256_xor(b16, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b17), b18));
+    s17 = Lib_IntVector_Intrinsics_vec256_xor(b17, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b18), b19));
+    s18 = Lib_IntVector_Intrinsics_vec256_xor(b18, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b19), b15));
+    s19 = Lib_IntVector_Intrinsics_vec256_xor(b19, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b15), b16));
+    s20 = Lib_IntVector_Intrinsics_vec256_xor(b20, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b21), b22));
+    s21 = Lib_IntVector_Intrinsics_vec256_xor(b21, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b22), b23));
+    s22 = Lib_IntVector_Intrinsics_vec256_xor(b22, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b23), b24));
+    s23 = Lib_IntVector_Intrinsics_vec256_xor(b23, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b24), b20));
+    s24 = Lib_IntVector_Intrinsics_vec256_xor(b24, Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b20), b21));
+    s0 = Lib_IntVector_Intrinsics_vec256_xor(s0, Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_SHA3_keccak_rndc[i0]));
+  }
+  s[0U] = s0;
+  s[1U] = s1;
+  s[2U] = s2;
+  s[3U] = s3;
+  s[4U] = s4;
+  s[5U] = s5;
+  s[6U] = s6;
+  s[7U] = s7;
+  s[8U] = s8;
+  s[9U] = s9;
+  s[10U] = s10;
+  s[11U] = s11;
+  s[12U] = s12;
+  s[13U] = s13;
+  s[14U] = s14;
+  s[15U] = s15;
+  s[16U] = s16;
+  s[17U] = s17;
+  s[18U] = s18;
+  s[19U] = s19;
+  s[20U] = s20;
+  s[21U] = s21;
+  s[22U] = s22;
+  s[23U] = s23;
+  s[24U] = s24;
+}
+
+static inline void transpose4(Lib_IntVector_Intrinsics_vec256 *v)
+{
+  Lib_IntVector_Intrinsics_vec256
+  a = Lib_IntVector_Intrinsics_vec256_interleave_low64(v[0U], v[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  b = Lib_IntVector_Intrinsics_vec256_interleave_high64(v[0U], v[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  c = Lib_IntVector_Intrinsics_vec256_interleave_low64(v[2U], v[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  d = Lib_IntVector_Intrinsics_vec256_interleave_high64(v[2U], v[3U]);
+  v[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(a, c);
+  v[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(b, d);
+  v[2U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(a, c);
+  v[3U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(b, d);
+}
+
+static void loadState4(uint8_t *b, Lib_IntVector_Intrinsics_vec256 *s)
+{
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)7U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 v[4U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      v[i] = Lib_IntVector_Intrinsics_vec256_load64_le(b + i * (uint32_t)224U + i0 * (uint32_t)32U);
+    }
+    transpose4(v);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint32_t w = (uint32_t)4U * i0 + i;
+      if (w < (uint32_t)25U)
+      {
+        s[w] = Lib_IntVector_Intrinsics_vec256_xor(s[w], v[i]);
+      }
+    }
+  }
+}
+
+static void storeState4(Lib_IntVector_Intrinsics_vec256 *s, uint8_t *b)
+{
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)7U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 v[4U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint32_t w = (uint32_t)4U * i0 + i;
+      if (w < (uint32_t)25U)
+      {
+        v[i] = s[w];
+      }
+      else
+      {
+        v[i] = Lib_IntVector_Intrinsics_vec256_zero;
+      }
+    }
+    transpose4(v);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      Lib_IntVector_Intrinsics_vec256_store64_le(b + i * (uint32_t)224U + i0 * (uint32_t)32U, v[i]);
+    }
+  }
+}
+
+/*
+  Absorbs input[k] (inputByteLen[k] bytes) into lane k. The lengths may differ:
+  a lane that has taken its padded last block keeps its state while the others
+  go on. delimitedSuffix must be below 0x80, as for all SHA-3 and SHAKE
+  functions, so that the padding always fits in the last block.
+*/
+static void
+absorb4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t *inputByteLen,
+  uint8_t **input,
+  uint8_t delimitedSuffix
+)
+{
+  uint32_t nbmin = inputByteLen[0U] / rateInBytes;
+  uint32_t nbmax = nbmin;
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)4U; i++)
+  {
+    uint32_t nb = inputByteLen[i] / rateInBytes;
+    if (nb < nbmin)
+    {
+      nbmin = nb;
+    }
+    if (nb > nbmax)
+    {
+      nbmax = nb;
+    }
+  }
+  uint8_t b[896U] = { 0U };
+  for (uint32_t i0 = (uint32_t)0U; i0 < nbmax + (uint32_t)1U; i0++)
+  {
+    memset(b, 0U, (uint32_t)896U * sizeof (uint8_t));
+    uint64_t mask[4U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint32_t nb = inputByteLen[i] / rateInBytes;
+      uint8_t *bi = b + i * (uint32_t)224U;
+      if (i0 < nb)
+      {
+        memcpy(bi, input[i] + i0 * rateInBytes, rateInBytes * sizeof (uint8_t));
+        mask[i] = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+      }
+      else if (i0 == nb)
+      {
+        uint32_t rem = inputByteLen[i] % rateInBytes;
+        memcpy(bi, input[i] + i0 * rateInBytes, rem * sizeof (uint8_t));
+        bi[rem] = delimitedSuffix;
+        bi[rateInBytes - (uint32_t)1U] = bi[rateInBytes - (uint32_t)1U] ^ (uint8_t)0x80U;
+        mask[i] = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+      }
+    }
+    if (i0 <= nbmin)
+    {
+      loadState4(b, s);
+      state_permute4(s);
+    }
+    else
+    {
+      Lib_IntVector_Intrinsics_vec256 old[25U];
+      memcpy(old, s, (uint32_t)25U * sizeof (Lib_IntVector_Intrinsics_vec256));
+      loadState4(b, s);
+      state_permute4(s);
+      Lib_IntVector_Intrinsics_vec256
+      m = Lib_IntVector_Intrinsics_vec256_load64s(mask[0U], mask[1U], mask[2U], mask[3U]);
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)25U; i++)
+      {
+        s[i] =
+          Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_and(s[i], m),
+            Lib_IntVector_Intrinsics_vec256_and(old[i], Lib_IntVector_Intrinsics_vec256_lognot(m)));
+      }
+    }
+  }
+  Lib_Memzero0_memzero(b, (uint32_t)896U * sizeof (b[0U]));
+}
+
+static void
+squeeze4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t outputByteLen,
+  uint8_t **output
+)
+{
+  uint32_t outBlocks = outputByteLen / rateInBytes;
+  uint32_t remOut = outputByteLen % rateInBytes;
+  uint8_t b[896U] = { 0U };
+  for (uint32_t i0 = (uint32_t)0U; i0 < outBlocks; i0++)
+  {
+    storeState4(s, b);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      memcpy(output[i] + i0 * rateInBytes,
+        b + i * (uint32_t)224U,
+        rateInBytes * sizeof (uint8_t));
+    }
+    state_permute4(s);
+  }
+  storeState4(s, b);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    memcpy(output[i] + outBlocks * rateInBytes, b + i * (uint32_t)224U, remOut * sizeof (uint8_t));
+  }
+  Lib_Memzero0_memzero(b, (uint32_t)896U * sizeof (b[0U]));
+}
+
+static void
+keccak4(
+  uint32_t rate,
+  uint32_t *inputByteLen,
+  uint8_t **input,
+  uint8_t delimitedSuffix,
+  uint32_t outputByteLen,
+  uint8_t **output
+)
+{
+  uint32_t rateInBytes = rate / (uint32_t)8U;
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)25U; i++)
+  {
+    s[i] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  absorb4(s, rateInBytes, inputByteLen, input, delimitedSuffix);
+  squeeze4(s, rateInBytes, outputByteLen, output);
+  Lib_Memzero0_memzero(s, (uint32_t)25U * sizeof (s[0U]));
+}
+
+static void
+keccak_4x(
+  uint32_t rate,
+  uint8_t delimitedSuffix,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  uint32_t lens[4U] = { inputByteLen, inputByteLen, inputByteLen, inputByteLen };
+  uint8_t *inputs[4U] = { input0, input1, input2, input3 };
+  uint8_t *outputs[4U] = { output0, output1, output2, output3 };
+  keccak4(rate, lens, inputs, delimitedSuffix, outputByteLen, outputs);
+}
+
+/*
+  Groups of four messages of any lengths. The lanes of a final partial group
+  hash the empty message into a scratch buffer.
+*/
+static void
+sha3_multi(
+  uint32_t rate,
+  uint32_t hashLen,
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  uint8_t scratch[64U] = { 0U };
+  for (uint32_t i0 = (uint32_t)0U; i0 < (n + (uint32_t)3U) / (uint32_t)4U; i0++)
+  {
+    uint32_t lens[4U] = { 0U };
+    uint8_t *ins[4U];
+    uint8_t *outs[4U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      uint32_t j = (uint32_t)4U * i0 + i;
+      if (j < n)
+      {
+        lens[i] = input_lens[j];
+        ins[i] = inputs[j];
+        outs[i] = dsts[j];
+      }
+      else
+      {
+        ins[i] = scratch;
+        outs[i] = scratch;
+      }
+    }
+    keccak4(rate, lens, ins, (uint8_t)0x06U, hashLen, outs);
+  }
+}
+
+void
+Hacl_SHA3_Vec256_shake128_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  keccak_4x((uint32_t)1344U,
+    (uint8_t)0x1FU,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_shake256_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  keccak_4x((uint32_t)1088U,
+    (uint8_t)0x1FU,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_224_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  keccak_4x((uint32_t)1152U,
+    (uint8_t)0x06U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint32_t)28U,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_256_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  keccak_4x((uint32_t)1088U,
+    (uint8_t)0x06U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint32_t)32U,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_384_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  keccak_4x((uint32_t)832U,
+    (uint8_t)0x06U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint32_t)48U,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_512_4x(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  keccak_4x((uint32_t)576U,
+    (uint8_t)0x06U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint32_t)64U,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_224_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha3_multi((uint32_t)1152U, (uint32_t)28U, n, dsts, inputs, input_lens);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_256_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha3_multi((uint32_t)1088U, (uint32_t)32U, n, dsts, inputs, input_lens);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_384_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha3_multi((uint32_t)832U, (uint32_t)48U, n, dsts, inputs, input_lens);
+}
+
+void
+Hacl_SHA3_Vec256_sha3_512_multi(
+  uint32_t n,
+  uint8_t **dsts,
+  uint8_t **inputs,
+  uint32_t *input_lens
+)
+{
+  sha3_multi((uint32_t)576U, (uint32_t)64U, n, dsts, inputs, input_lens);
+}
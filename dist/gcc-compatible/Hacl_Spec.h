@@ -52,6 +52,10 @@ typedef uint8_t Spec_Blake2_alg;
 #define Spec_Hash_Definitions_MD5 5
 #define Spec_Hash_Definitions_Blake2S 6
 #define Spec_Hash_Definitions_Blake2B 7
+#define Spec_Hash_Definitions_SHA3_256 8
+#define Spec_Hash_Definitions_SHA3_224 9
+#define Spec_Hash_Definitions_SHA3_384 10
+#define Spec_Hash_Definitions_SHA3_512 11
 
 typedef uint8_t Spec_Hash_Definitions_hash_alg;
 
@@ -2509,3 +2509,667 @@ Hacl_Streaming_Blake2_blake2b_32_with_key_free(
   KRML_HOST_FREE(s1);
 }
 
+/*
+  BLAKE2bp: four BLAKE2b leaves (fanout 4, depth 2, inner length 64) fed with
+  the input in 128-byte blocks, round robin, and a root node hashing the four
+  leaf digests. With a key, every leaf first absorbs the padded key block.
+
+  The streaming state is the four leaf states, followed one another in
+  block_state, and a two-stripe buffer of 1024 bytes. A stripe (512 bytes,
+  one block per leaf) is only compressed once the last leaf has input beyond
+  it, so that the last block of every leaf is still in the buffer at finish
+  time. total_len counts the padded key blocks, if any, as a first stripe.
+*/
+
+static void
+blake2bp_init_node(uint64_t *hash, uint32_t kk, uint32_t nn, uint32_t node_offset, uint32_t node_depth)
+{
+  uint64_t p0 = (uint64_t)nn ^ ((uint64_t)kk << (uint32_t)8U ^ (uint64_t)0x02040000U);
+  uint64_t p1 = (uint64_t)node_offset;
+  uint64_t p2 = (uint64_t)node_depth ^ (uint64_t)0x4000U;
+  uint64_t p3 = (uint64_t)0U;
+  uint64_t *r0 = hash + (uint32_t)0U * (uint32_t)4U;
+  uint64_t *r1 = hash + (uint32_t)1U * (uint32_t)4U;
+  uint64_t *r2 = hash + (uint32_t)2U * (uint32_t)4U;
+  uint64_t *r3 = hash + (uint32_t)3U * (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    r1[i] = Hacl_Impl_Blake2_Constants_ivTable_B[(uint32_t)4U + i];
+    r2[i] = Hacl_Impl_Blake2_Constants_ivTable_B[i];
+    r3[i] = Hacl_Impl_Blake2_Constants_ivTable_B[(uint32_t)4U + i];
+  }
+  r0[0U] = Hacl_Impl_Blake2_Constants_ivTable_B[0U] ^ p0;
+  r0[1U] = Hacl_Impl_Blake2_Constants_ivTable_B[1U] ^ p1;
+  r0[2U] = Hacl_Impl_Blake2_Constants_ivTable_B[2U] ^ p2;
+  r0[3U] = Hacl_Impl_Blake2_Constants_ivTable_B[3U] ^ p3;
+}
+
+/*
+  The last row of a state is only read, XORed with the counter and flags, to
+  set up the compression; setting its last word raises the last-node flag.
+*/
+static void blake2bp_set_last_node(uint64_t *hash)
+{
+  hash[15U] = hash[15U] ^ (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
+
+static void
+blake2bp_update_stripes(uint64_t *leaves, uint64_t prev, uint8_t *stripes, uint32_t n)
+{
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256())
+  {
+    Hacl_Blake2_Vec256_blake2b_update_4x(leaves, prev, stripes, n);
+    return;
+  }
+  #endif
+  uint64_t wv[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      Hacl_Blake2b_32_blake2b_update_multi((uint32_t)128U,
+        wv,
+        leaves + i * (uint32_t)16U,
+        FStar_UInt128_uint64_to_uint128(prev + (uint64_t)(j * (uint32_t)128U)),
+        stripes + j * (uint32_t)512U + i * (uint32_t)128U,
+        (uint32_t)1U);
+    }
+  }
+}
+
+/* Number of stripes that can be compressed once total_len bytes are known. */
+static uint64_t blake2bp_stripes_done(uint64_t total_len)
+{
+  if (total_len > (uint64_t)384U)
+  {
+    return (total_len - (uint64_t)385U) / (uint64_t)512U;
+  }
+  return (uint64_t)0U;
+}
+
+static uint64_t
+blake2bp_init(uint64_t *leaves, uint8_t *buf, uint32_t kk, uint8_t *k, uint32_t nn)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    blake2bp_init_node(leaves + i * (uint32_t)16U, kk, nn, i, (uint32_t)0U);
+  }
+  if (kk == (uint32_t)0U)
+  {
+    return (uint64_t)0U;
+  }
+  memset(buf, 0U, (uint32_t)512U * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    memcpy(buf + i * (uint32_t)128U, k, kk * sizeof (uint8_t));
+  }
+  return (uint64_t)512U;
+}
+
+static uint64_t
+blake2bp_update(uint64_t *leaves, uint8_t *buf, uint64_t total_len, uint8_t *data, uint32_t len)
+{
+  uint64_t done = blake2bp_stripes_done(total_len);
+  uint32_t sz = (uint32_t)(total_len - done * (uint64_t)512U);
+  uint32_t n = (uint32_t)(blake2bp_stripes_done(total_len + (uint64_t)len) - done);
+  uint64_t prev = done * (uint64_t)128U;
+  uint8_t *rest = data;
+  uint32_t rest_len = len;
+  if (n > (uint32_t)0U && sz >= (uint32_t)512U)
+  {
+    blake2bp_update_stripes(leaves, prev, buf, (uint32_t)1U);
+    prev = prev + (uint64_t)128U;
+    n = n - (uint32_t)1U;
+    sz = sz - (uint32_t)512U;
+    memmove(buf, buf + (uint32_t)512U, sz * sizeof (uint8_t));
+  }
+  if (n > (uint32_t)0U && sz > (uint32_t)0U)
+  {
+    uint32_t fill = (uint32_t)512U - sz;
+    memcpy(buf + sz, rest, fill * sizeof (uint8_t));
+    blake2bp_update_stripes(leaves, prev, buf, (uint32_t)1U);
+    prev = prev + (uint64_t)128U;
+    n = n - (uint32_t)1U;
+    sz = (uint32_t)0U;
+    rest = rest + fill;
+    rest_len = rest_len - fill;
+  }
+  if (n > (uint32_t)0U)
+  {
+    blake2bp_update_stripes(leaves, prev, rest, n);
+    rest = rest + n * (uint32_t)512U;
+    rest_len = rest_len - n * (uint32_t)512U;
+  }
+  memcpy(buf + sz, rest, rest_len * sizeof (uint8_t));
+  return total_len + (uint64_t)len;
+}
+
+/* Works on copies of the leaf states, so that more input may follow. */
+static void
+blake2bp_finish(
+  uint64_t *leaves,
+  uint8_t *buf,
+  uint64_t total_len,
+  uint32_t kk,
+  uint32_t nn,
+  uint8_t *dst
+)
+{
+  uint64_t done = blake2bp_stripes_done(total_len);
+  uint32_t sz = (uint32_t)(total_len - done * (uint64_t)512U);
+  uint64_t wv[16U] = { 0U };
+  uint64_t node[16U] = { 0U };
+  uint8_t hashes[256U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint64_t prev = done * (uint64_t)128U;
+    uint32_t off = i * (uint32_t)128U;
+    memcpy(node, leaves + i * (uint32_t)16U, (uint32_t)16U * sizeof (uint64_t));
+    if (sz > (uint32_t)512U + off)
+    {
+      Hacl_Blake2b_32_blake2b_update_multi((uint32_t)128U, wv, node, FStar_UInt128_uint64_to_uint128(prev), buf + off, (uint32_t)1U);
+      prev = prev + (uint64_t)128U;
+      off = off + (uint32_t)512U;
+    }
+    uint32_t rem = (uint32_t)0U;
+    if (sz > off)
+    {
+      rem = sz - off;
+      if (rem > (uint32_t)128U)
+      {
+        rem = (uint32_t)128U;
+      }
+    }
+    if (i == (uint32_t)4U - (uint32_t)1U)
+    {
+      blake2bp_set_last_node(node);
+    }
+    Hacl_Blake2b_32_blake2b_update_last(rem, wv, node, FStar_UInt128_uint64_to_uint128(prev), rem, buf + off);
+    Hacl_Blake2b_32_blake2b_finish((uint32_t)64U, hashes + i * (uint32_t)64U, node);
+  }
+  blake2bp_init_node(node, kk, nn, (uint32_t)0U, (uint32_t)1U);
+  Hacl_Blake2b_32_blake2b_update_multi((uint32_t)256U, wv, node, FStar_UInt128_uint64_to_uint128((uint64_t)0U), hashes, (uint32_t)1U);
+  blake2bp_set_last_node(node);
+  Hacl_Blake2b_32_blake2b_update_last((uint32_t)128U,
+    wv,
+    node,
+    FStar_UInt128_uint64_to_uint128((uint64_t)128U),
+    (uint32_t)128U,
+    hashes + (uint32_t)128U);
+  Hacl_Blake2b_32_blake2b_finish(nn, dst, node);
+  Lib_Memzero0_memzero(node, (uint32_t)16U * sizeof (node[0U]));
+  Lib_Memzero0_memzero(wv, (uint32_t)16U * sizeof (wv[0U]));
+  Lib_Memzero0_memzero(hashes, (uint32_t)256U * sizeof (hashes[0U]));
+}
+
+static Hacl_Streaming_Blake2_blake2bp_state *blake2bp_create_in(uint32_t kk, uint8_t *k, uint32_t nn)
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)1024U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint64_t));
+  uint64_t total_len = blake2bp_init(block_state, buf, kk, k, nn);
+  Hacl_Streaming_Blake2_blake2bp_state s = { .block_state = block_state, .buf = buf, .total_len = total_len };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_Blake2_blake2bp_state), (uint32_t)1U);
+  Hacl_Streaming_Blake2_blake2bp_state *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_Blake2_blake2bp_state));
+  p[0U] = s;
+  return p;
+}
+
+static void blake2bp_free(Hacl_Streaming_Blake2_blake2bp_state *s)
+{
+  Hacl_Streaming_Blake2_blake2bp_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2_blake2bp_state *Hacl_Streaming_Blake2_blake2bp_no_key_create_in()
+{
+  return blake2bp_create_in((uint32_t)0U, NULL, (uint32_t)64U);
+}
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_init(Hacl_Streaming_Blake2_blake2bp_state *s1)
+{
+  Hacl_Streaming_Blake2_blake2bp_state scrut = *s1;
+  uint64_t total_len = blake2bp_init(scrut.block_state, scrut.buf, (uint32_t)0U, NULL, (uint32_t)64U);
+  s1->total_len = total_len;
+}
+
+/*
+  Update function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_update(Hacl_Streaming_Blake2_blake2bp_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_Blake2_blake2bp_state s = *p;
+  p->total_len = blake2bp_update(s.block_state, s.buf, s.total_len, data, len);
+}
+
+/*
+  Finish function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_finish(Hacl_Streaming_Blake2_blake2bp_state *p, uint8_t *dst)
+{
+  Hacl_Streaming_Blake2_blake2bp_state s = *p;
+  blake2bp_finish(s.block_state, s.buf, s.total_len, (uint32_t)0U, (uint32_t)64U, dst);
+}
+
+/*
+  Free state function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_free(Hacl_Streaming_Blake2_blake2bp_state *s1)
+{
+  blake2bp_free(s1);
+}
+
+/*
+  State allocation function when using a (potentially null) key
+*/
+Hacl_Streaming_Blake2_blake2bp_state *Hacl_Streaming_Blake2_blake2bp_with_key_create_in(uint32_t key_size, uint8_t *k1)
+{
+  return blake2bp_create_in(key_size, k1, (uint32_t)64U);
+}
+
+/*
+  (Re-)initialization function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2bp_with_key_init(uint32_t key_size, uint8_t *k1, Hacl_Streaming_Blake2_blake2bp_state *s1)
+{
+  Hacl_Streaming_Blake2_blake2bp_state scrut = *s1;
+  uint64_t total_len = blake2bp_init(scrut.block_state, scrut.buf, key_size, k1, (uint32_t)64U);
+  s1->total_len = total_len;
+}
+
+/*
+  Update function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2bp_with_key_update(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2_blake2bp_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake2_blake2bp_state s = *p;
+  p->total_len = blake2bp_update(s.block_state, s.buf, s.total_len, data, len);
+}
+
+/*
+  Finish function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2bp_with_key_finish(uint32_t key_size, Hacl_Streaming_Blake2_blake2bp_state *p, uint8_t *dst)
+{
+  Hacl_Streaming_Blake2_blake2bp_state s = *p;
+  blake2bp_finish(s.block_state, s.buf, s.total_len, key_size, (uint32_t)64U, dst);
+}
+
+/*
+  Free state function when using a (potentially null) key
+*/
+void Hacl_Streaming_Blake2_blake2bp_with_key_free(uint32_t key_size, Hacl_Streaming_Blake2_blake2bp_state *s1)
+{
+  blake2bp_free(s1);
+}
+
+/*
+  One-shot BLAKE2bp: write the nn-byte digest of the ll bytes at d, keyed with
+  the kk bytes at k, to output.
+*/
+void
+Hacl_Streaming_Blake2_blake2bp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+)
+{
+  uint64_t leaves[64U] = { 0U };
+  uint8_t buf[1024U] = { 0U };
+  uint64_t total_len = blake2bp_init(leaves, buf, kk, k, nn);
+  total_len = blake2bp_update(leaves, buf, total_len, d, ll);
+  blake2bp_finish(leaves, buf, total_len, kk, nn, output);
+  Lib_Memzero0_memzero(leaves, (uint32_t)64U * sizeof (leaves[0U]));
+  Lib_Memzero0_memzero(buf, (uint32_t)1024U * sizeof (buf[0U]));
+}
+
+/*
+  BLAKE2sp: eight BLAKE2s leaves (fanout 8, depth 2, inner length 32) fed with
+  the input in 64-byte blocks, round robin, and a root node hashing the eight
+  leaf digests. The stripe is again 512 bytes and the state has the same
+  layout as for BLAKE2bp.
+*/
+
+static void
+blake2sp_init_node(uint32_t *hash, uint32_t kk, uint32_t nn, uint32_t node_offset, uint32_t node_depth)
+{
+  uint32_t p0 = (uint32_t)nn ^ ((uint32_t)kk << (uint32_t)8U ^ (uint32_t)0x02080000U);
+  uint32_t p1 = (uint32_t)0U;
+  uint32_t p2 = (uint32_t)node_offset;
+  uint32_t p3 = (uint32_t)node_depth << (uint32_t)16U ^ (uint32_t)0x20000000U;
+  uint32_t *r0 = hash + (uint32_t)0U * (uint32_t)4U;
+  uint32_t *r1 = hash + (uint32_t)1U * (uint32_t)4U;
+  uint32_t *r2 = hash + (uint32_t)2U * (uint32_t)4U;
+  uint32_t *r3 = hash + (uint32_t)3U * (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    r1[i] = Hacl_Impl_Blake2_Constants_ivTable_S[(uint32_t)4U + i];
+    r2[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+    r3[i] = Hacl_Impl_Blake2_Constants_ivTable_S[(uint32_t)4U + i];
+  }
+  r0[0U] = Hacl_Impl_Blake2_Constants_ivTable_S[0U] ^ p0;
+  r0[1U] = Hacl_Impl_Blake2_Constants_ivTable_S[1U] ^ p1;
+  r0[2U] = Hacl_Impl_Blake2_Constants_ivTable_S[2U] ^ p2;
+  r0[3U] = Hacl_Impl_Blake2_Constants_ivTable_S[3U] ^ p3;
+}
+
+/*
+  The last row of a state is only read, XORed with the counter and flags, to
+  set up the compression; setting its last word raises the last-node flag.
+*/
+static void blake2sp_set_last_node(uint32_t *hash)
+{
+  hash[15U] = hash[15U] ^ (uint32_t)0xFFFFFFFFU;
+}
+
+static void
+blake2sp_update_stripes(uint32_t *leaves, uint64_t prev, uint8_t *stripes, uint32_t n)
+{
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256())
+  {
+    Hacl_Blake2_Vec256_blake2s_update_8x(leaves, prev, stripes, n);
+    return;
+  }
+  #endif
+  uint32_t wv[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      Hacl_Blake2s_32_blake2s_update_multi((uint32_t)64U,
+        wv,
+        leaves + i * (uint32_t)16U,
+        prev + (uint64_t)(j * (uint32_t)64U),
+        stripes + j * (uint32_t)512U + i * (uint32_t)64U,
+        (uint32_t)1U);
+    }
+  }
+}
+
+/* Number of stripes that can be compressed once total_len bytes are known. */
+static uint64_t blake2sp_stripes_done(uint64_t total_len)
+{
+  if (total_len > (uint64_t)448U)
+  {
+    return (total_len - (uint64_t)449U) / (uint64_t)512U;
+  }
+  return (uint64_t)0U;
+}
+
+static uint64_t
+blake2sp_init(uint32_t *leaves, uint8_t *buf, uint32_t kk, uint8_t *k, uint32_t nn)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    blake2sp_init_node(leaves + i * (uint32_t)16U, kk, nn, i, (uint32_t)0U);
+  }
+  if (kk == (uint32_t)0U)
+  {
+    return (uint64_t)0U;
+  }
+  memset(buf, 0U, (uint32_t)512U * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    memcpy(buf + i * (uint32_t)64U, k, kk * sizeof (uint8_t));
+  }
+  return (uint64_t)512U;
+}
+
+static uint64_t
+blake2sp_update(uint32_t *leaves, uint8_t *buf, uint64_t total_len, uint8_t *data, uint32_t len)
+{
+  uint64_t done = blake2sp_stripes_done(total_len);
+  uint32_t sz = (uint32_t)(total_len - done * (uint64_t)512U);
+  uint32_t n = (uint32_t)(blake2sp_stripes_done(total_len + (uint64_t)len) - done);
+  uint64_t prev = done * (uint64_t)64U;
+  uint8_t *rest = data;
+  uint32_t rest_len = len;
+  if (n > (uint32_t)0U && sz >= (uint32_t)512U)
+  {
+    blake2sp_update_stripes(leaves, prev, buf, (uint32_t)1U);
+    prev = prev + (uint64_t)64U;
+    n = n - (uint32_t)1U;
+    sz = sz - (uint32_t)512U;
+    memmove(buf, buf + (uint32_t)512U, sz * sizeof (uint8_t));
+  }
+  if (n > (uint32_t)0U && sz > (uint32_t)0U)
+  {
+    uint32_t fill = (uint32_t)512U - sz;
+    memcpy(buf + sz, rest, fill * sizeof (uint8_t));
+    blake2sp_update_stripes(leaves, prev, buf, (uint32_t)1U);
+    prev = prev + (uint64_t)64U;
+    n = n - (uint32_t)1U;
+    sz = (uint32_t)0U;
+    rest = rest + fill;
+    rest_len = rest_len - fill;
+  }
+  if (n > (uint32_t)0U)
+  {
+    blake2sp_update_stripes(leaves, prev, rest, n);
+    rest = rest + n * (uint32_t)512U;
+    rest_len = rest_len - n * (uint32_t)512U;
+  }
+  memcpy(buf + sz, rest, rest_len * sizeof (uint8_t));
+  return total_len + (uint64_t)len;
+}
+
+/* Works on copies of the leaf states, so that more input may follow. */
+static void
+blake2sp_finish(
+  uint32_t *leaves,
+  uint8_t *buf,
+  uint64_t total_len,
+  uint32_t kk,
+  uint32_t nn,
+  uint8_t *dst
+)
+{
+  uint64_t done = blake2sp_stripes_done(total_len);
+  uint32_t sz = (uint32_t)(total_len - done * (uint64_t)512U);
+  uint32_t wv[16U] = { 0U };
+  uint32_t node[16U] = { 0U };
+  uint8_t hashes[256U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t prev = done * (uint64_t)64U;
+    uint32_t off = i * (uint32_t)64U;
+    memcpy(node, leaves + i * (uint32_t)16U, (uint32_t)16U * sizeof (uint32_t));
+    if (sz > (uint32_t)512U + off)
+    {
+      Hacl_Blake2s_32_blake2s_update_multi((uint32_t)64U, wv, node, prev, buf + off, (uint32_t)1U);
+      prev = prev + (uint64_t)64U;
+      off = off + (uint32_t)512U;
+    }
+    uint32_t rem = (uint32_t)0U;
+    if (sz > off)
+    {
+      rem = sz - off;
+      if (rem > (uint32_t)64U)
+      {
+        rem = (uint32_t)64U;
+      }
+    }
+    if (i == (uint32_t)8U - (uint32_t)1U)
+    {
+      blake2sp_set_last_node(node);
+    }
+    Hacl_Blake2s_32_blake2s_update_last(rem, wv, node, prev, rem, buf + off);
+    Hacl_Blake2s_32_blake2s_finish((uint32_t)32U, hashes + i * (uint32_t)32U, node);
+  }
+  blake2sp_init_node(node, kk, nn, (uint32_t)0U, (uint32_t)1U);
+  Hacl_Blake2s_32_blake2s_update_multi((uint32_t)256U, wv, node, (uint64_t)0U, hashes, (uint32_t)3U);
+  blake2sp_set_last_node(node);
+  Hacl_Blake2s_32_blake2s_update_last((uint32_t)64U,
+    wv,
+    node,
+    (uint64_t)192U,
+    (uint32_t)64U,
+    hashes + (uint32_t)192U);
+  Hacl_Blake2s_32_blake2s_finish(nn, dst, node);
+  Lib_Memzero0_memzero(node, (uint32_t)16U * sizeof (node[0U]));
+  Lib_Memzero0_memzero(wv, (uint32_t)16U * sizeof (wv[0U]));
+  Lib_Memzero0_memzero(hashes, (uint32_t)256U * sizeof (hashes[0U]));
+}
+
+static Hacl_Streaming_Blake2_blake2sp_state *blake2sp_create_in(uint32_t kk, uint8_t *k, uint32_t nn)
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)1024U, sizeof (uint8_t));
+  uint32_t *block_state = KRML_HOST_CALLOC((uint32_t)128U, sizeof (uint32_t));
+  uint64_t total_len = blake2sp_init(block_state, buf, kk, k, nn);
+  Hacl_Streaming_Blake2_blake2sp_state s = { .block_state = block_state, .buf = buf, .total_len = total_len };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_Blake2_blake2sp_state), (uint32_t)1U);
+  Hacl_Streaming_Blake2_blake2sp_state *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_Blake2_blake2sp_state));
+  p[0U] = s;
+  return p;
+}
+
+static void blake2sp_free(Hacl_Streaming_Blake2_blake2sp_state *s)
+{
+  Hacl_Streaming_Blake2_blake2sp_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint32_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2_blake2sp_state *Hacl_Streaming_Blake2_blake2sp_no_key_create_in()
+{
+  return blake2sp_create_in((uint32_t)0U, NULL, (uint32_t)32U);
+}
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_init(Hacl_Streaming_Blake2_blake2sp_state *s1)
+{
+  Hacl_Streaming_Blake2_blake2sp_state scrut = *s1;
+  uint64_t total_len = blake2sp_init(scrut.block_state, scrut.buf, (uint32_t)0U, NULL, (uint32_t)32U);
+  s1->total_len = total_len;
+}
+
+/*
+  Update function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_update(Hacl_Streaming_Blake2_blake2sp_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_Blake2_blake2sp_state s = *p;
+  p->total_len = blake2sp_update(s.block_state, s.buf, s.total_len, data, len);
+}
+
+/*
+  Finish function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_finish(Hacl_Streaming_Blake2_blake2sp_state *p, uint8_t *dst)
+{
+  Hacl_Streaming_Blake2_blake2sp_state s = *p;
+  blake2sp_finish(s.block_state, s.buf, s.total_len, (uint32_t)0U, (uint32_t)32U, dst);
+}
+
+/*
+  Free state function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_free(Hacl_Streaming_Blake2_blake2sp_state *s1)
+{
+  blake2sp_free(s1);
+}
+
+/*
+  State allocation function when using a (potentially null) key
+*/
+Hacl_Streaming_Blake2_blake2sp_state *Hacl_Streaming_Blake2_blake2sp_with_key_create_in(uint32_t key_size, uint8_t *k1)
+{
+  return blake2sp_create_in(key_size, k1, (uint32_t)32U);
+}
+
+/*
+  (Re-)initialization function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2sp_with_key_init(uint32_t key_size, uint8_t *k1, Hacl_Streaming_Blake2_blake2sp_state *s1)
+{
+  Hacl_Streaming_Blake2_blake2sp_state scrut = *s1;
+  uint64_t total_len = blake2sp_init(scrut.block_state, scrut.buf, key_size, k1, (uint32_t)32U);
+  s1->total_len = total_len;
+}
+
+/*
+  Update function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2sp_with_key_update(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2_blake2sp_state *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake2_blake2sp_state s = *p;
+  p->total_len = blake2sp_update(s.block_state, s.buf, s.total_len, data, len);
+}
+
+/*
+  Finish function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2sp_with_key_finish(uint32_t key_size, Hacl_Streaming_Blake2_blake2sp_state *p, uint8_t *dst)
+{
+  Hacl_Streaming_Blake2_blake2sp_state s = *p;
+  blake2sp_finish(s.block_state, s.buf, s.total_len, key_size, (uint32_t)32U, dst);
+}
+
+/*
+  Free state function when using a (potentially null) key
+*/
+void Hacl_Streaming_Blake2_blake2sp_with_key_free(uint32_t key_size, Hacl_Streaming_Blake2_blake2sp_state *s1)
+{
+  blake2sp_free(s1);
+}
+
+/*
+  One-shot BLAKE2sp: write the nn-byte digest of the ll bytes at d, keyed with
+  the kk bytes at k, to output.
+*/
+void
+Hacl_Streaming_Blake2_blake2sp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+)
+{
+  uint32_t leaves[128U] = { 0U };
+  uint8_t buf[1024U] = { 0U };
+  uint64_t total_len = blake2sp_init(leaves, buf, kk, k, nn);
+  total_len = blake2sp_update(leaves, buf, total_len, d, ll);
+  blake2sp_finish(leaves, buf, total_len, kk, nn, output);
+  Lib_Memzero0_memzero(leaves, (uint32_t)128U * sizeof (leaves[0U]));
+  Lib_Memzero0_memzero(buf, (uint32_t)1024U * sizeof (buf[0U]));
+}
@@ -42,6 +42,9 @@ extern "C" {
 #include "Hacl_Blake2b_32.h"
 #include "Hacl_Spec.h"
 #include "Hacl_Impl_Blake2.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Blake2_Vec256.h"
+#include "Lib_Memzero0.h"
 
 uint32_t
 Hacl_Streaming_Blake2_blocks_state_len(Spec_Blake2_alg a, Hacl_Impl_Blake2_Core_m_spec m);
@@ -236,6 +239,166 @@ Hacl_Streaming_Blake2_blake2b_32_with_key_free(
   Hacl_Streaming_Blake2_blake2b_32_state *s1
 );
 
+typedef struct Hacl_Streaming_Blake2_blake2bp_state_s
+{
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_Streaming_Blake2_blake2bp_state;
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2_blake2bp_state *Hacl_Streaming_Blake2_blake2bp_no_key_create_in();
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_init(Hacl_Streaming_Blake2_blake2bp_state *s1);
+
+/*
+  Update function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_update(Hacl_Streaming_Blake2_blake2bp_state *p, uint8_t *data, uint32_t len);
+
+/*
+  Finish function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_finish(Hacl_Streaming_Blake2_blake2bp_state *p, uint8_t *dst);
+
+/*
+  Free state function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2bp_no_key_free(Hacl_Streaming_Blake2_blake2bp_state *s1);
+
+/*
+  State allocation function when using a (potentially null) key
+*/
+Hacl_Streaming_Blake2_blake2bp_state *Hacl_Streaming_Blake2_blake2bp_with_key_create_in(uint32_t key_size, uint8_t *k1);
+
+/*
+  (Re-)initialization function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2bp_with_key_init(uint32_t key_size, uint8_t *k1, Hacl_Streaming_Blake2_blake2bp_state *s1);
+
+/*
+  Update function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2bp_with_key_update(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2_blake2bp_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Finish function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2bp_with_key_finish(uint32_t key_size, Hacl_Streaming_Blake2_blake2bp_state *p, uint8_t *dst);
+
+/*
+  Free state function when using a (potentially null) key
+*/
+void Hacl_Streaming_Blake2_blake2bp_with_key_free(uint32_t key_size, Hacl_Streaming_Blake2_blake2bp_state *s1);
+
+/*
+  One-shot BLAKE2bp: write the nn-byte digest of the ll bytes at d, keyed with
+  the kk bytes at k, to output.
+*/
+void
+Hacl_Streaming_Blake2_blake2bp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+);
+
+typedef struct Hacl_Streaming_Blake2_blake2sp_state_s
+{
+  uint32_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_Streaming_Blake2_blake2sp_state;
+
+/*
+  State allocation function when there is no key
+*/
+Hacl_Streaming_Blake2_blake2sp_state *Hacl_Streaming_Blake2_blake2sp_no_key_create_in();
+
+/*
+  (Re-)initialization function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_init(Hacl_Streaming_Blake2_blake2sp_state *s1);
+
+/*
+  Update function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_update(Hacl_Streaming_Blake2_blake2sp_state *p, uint8_t *data, uint32_t len);
+
+/*
+  Finish function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_finish(Hacl_Streaming_Blake2_blake2sp_state *p, uint8_t *dst);
+
+/*
+  Free state function when there is no key
+*/
+void Hacl_Streaming_Blake2_blake2sp_no_key_free(Hacl_Streaming_Blake2_blake2sp_state *s1);
+
+/*
+  State allocation function when using a (potentially null) key
+*/
+Hacl_Streaming_Blake2_blake2sp_state *Hacl_Streaming_Blake2_blake2sp_with_key_create_in(uint32_t key_size, uint8_t *k1);
+
+/*
+  (Re-)initialization function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2sp_with_key_init(uint32_t key_size, uint8_t *k1, Hacl_Streaming_Blake2_blake2sp_state *s1);
+
+/*
+  Update function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2sp_with_key_update(
+  uint32_t key_size,
+  Hacl_Streaming_Blake2_blake2sp_state *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Finish function when using a (potentially null) key
+*/
+void
+Hacl_Streaming_Blake2_blake2sp_with_key_finish(uint32_t key_size, Hacl_Streaming_Blake2_blake2sp_state *p, uint8_t *dst);
+
+/*
+  Free state function when using a (potentially null) key
+*/
+void Hacl_Streaming_Blake2_blake2sp_with_key_free(uint32_t key_size, Hacl_Streaming_Blake2_blake2sp_state *s1);
+
+/*
+  One-shot BLAKE2sp: write the nn-byte digest of the ll bytes at d, keyed with
+  the kk bytes at k, to output.
+*/
+void
+Hacl_Streaming_Blake2_blake2sp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+);
+
 #if defined(__cplusplus)
 }
 #endif
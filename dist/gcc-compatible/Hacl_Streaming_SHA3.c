@@ -0,0 +1,466 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Streaming_SHA3.h"
+
+/* Number of bytes held in buf: a full block is kept until more input arrives. */
+static uint32_t buffered_len(uint32_t rateInBytes, uint64_t total_len)
+{
+  if (total_len % (uint64_t)rateInBytes == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    return rateInBytes;
+  }
+  return (uint32_t)(total_len % (uint64_t)rateInBytes);
+}
+
+static void absorb_blocks(uint32_t rateInBytes, uint64_t *s, uint8_t *blocks, uint32_t n)
+{
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    Hacl_Impl_SHA3_loadState(rateInBytes, blocks + i * rateInBytes, s);
+    Hacl_Impl_SHA3_state_permute(s);
+  }
+}
+
+/*
+  Feed len bytes to a state that already received total_len bytes: top up the
+  buffered block, absorb it and every following full block straight from data,
+  and keep the (non-empty) tail in buf.
+*/
+static void
+update_block_state(
+  uint32_t rateInBytes,
+  uint64_t *block_state,
+  uint8_t *buf,
+  uint64_t total_len,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  uint32_t sz = buffered_len(rateInBytes, total_len);
+  if (len <= rateInBytes - sz)
+  {
+    memcpy(buf + sz, data, len * sizeof (uint8_t));
+    return;
+  }
+  uint32_t diff = rateInBytes - sz;
+  memcpy(buf + sz, data, diff * sizeof (uint8_t));
+  absorb_blocks(rateInBytes, block_state, buf, (uint32_t)1U);
+  uint32_t rest = len - diff;
+  uint32_t ite;
+  if (rest % rateInBytes == (uint32_t)0U)
+  {
+    ite = rateInBytes;
+  }
+  else
+  {
+    ite = rest % rateInBytes;
+  }
+  uint32_t n_blocks = (rest - ite) / rateInBytes;
+  uint8_t *data1 = data + diff;
+  absorb_blocks(rateInBytes, block_state, data1, n_blocks);
+  memcpy(buf, data1 + n_blocks * rateInBytes, ite * sizeof (uint8_t));
+}
+
+static Hacl_Streaming_SHA3_state_sha3_224 *create_in_sha3(uint32_t rateInBytes)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
+  uint8_t *buf = KRML_HOST_CALLOC(rateInBytes, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_sha3_224
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_sha3_224), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_sha3_224
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_sha3_224));
+  p[0U] = s;
+  return p;
+}
+
+static void init_sha3(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+static void
+update_sha3(
+  uint32_t rateInBytes,
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 s = *p;
+  update_block_state(rateInBytes, s.block_state, s.buf, s.total_len, data, len);
+  *p
+  =
+    (
+      (Hacl_Streaming_SHA3_state_sha3_224){
+        .block_state = s.block_state,
+        .buf = s.buf,
+        .total_len = s.total_len + (uint64_t)len
+      }
+    );
+}
+
+/* Pads a copy of the state, so that the caller may keep feeding input. */
+static void
+finish_sha3(
+  uint32_t rateInBytes,
+  uint32_t hashLen,
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *p;
+  uint32_t r = buffered_len(rateInBytes, scrut.total_len);
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, scrut.block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_Impl_SHA3_absorb(tmp_block_state, rateInBytes, r, scrut.buf, (uint8_t)0x06U);
+  Hacl_Impl_SHA3_squeeze(tmp_block_state, rateInBytes, hashLen, dst);
+  Lib_Memzero0_memzero(tmp_block_state, (uint32_t)25U * sizeof (tmp_block_state[0U]));
+}
+
+static void free_sha3(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  Hacl_Streaming_SHA3_state_sha3_224 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+static Hacl_Streaming_SHA3_state_shake128 *create_in_shake(uint32_t rateInBytes)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
+  uint8_t *buf = KRML_HOST_CALLOC(rateInBytes, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state_shake128
+  s =
+    {
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U,
+      .squeezing = false,
+      .out_pos = (uint32_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state_shake128), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state_shake128
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state_shake128));
+  p[0U] = s;
+  return p;
+}
+
+static void init_shake(Hacl_Streaming_SHA3_state_shake128 *s)
+{
+  Hacl_Streaming_SHA3_state_shake128 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  memset(block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state_shake128){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U,
+        .squeezing = false,
+        .out_pos = (uint32_t)0U
+      }
+    );
+}
+
+static void
+update_shake(
+  uint32_t rateInBytes,
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_shake128 s = *p;
+  if (s.squeezing)
+  {
+    return;
+  }
+  update_block_state(rateInBytes, s.block_state, s.buf, s.total_len, data, len);
+  p->total_len = s.total_len + (uint64_t)len;
+}
+
+/*
+  The first call pads the input and turns buf into the first output block. The
+  next block is only computed once the current one is used up, which keeps the
+  permutations in step with Hacl_Impl_SHA3_squeeze.
+*/
+static void
+squeeze_shake(
+  uint32_t rateInBytes,
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *dst,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA3_state_shake128 s = *p;
+  uint64_t *block_state = s.block_state;
+  uint8_t *buf = s.buf;
+  uint32_t out_pos = s.out_pos;
+  if (!s.squeezing)
+  {
+    uint32_t r = buffered_len(rateInBytes, s.total_len);
+    Hacl_Impl_SHA3_absorb(block_state, rateInBytes, r, buf, (uint8_t)0x1FU);
+    Hacl_Impl_SHA3_storeState(rateInBytes, block_state, buf);
+    out_pos = (uint32_t)0U;
+  }
+  uint32_t done = (uint32_t)0U;
+  while (done < len)
+  {
+    if (out_pos == rateInBytes)
+    {
+      Hacl_Impl_SHA3_state_permute(block_state);
+      Hacl_Impl_SHA3_storeState(rateInBytes, block_state, buf);
+      out_pos = (uint32_t)0U;
+    }
+    uint32_t avail = rateInBytes - out_pos;
+    uint32_t n = len - done;
+    if (avail < n)
+    {
+      n = avail;
+    }
+    memcpy(dst + done, buf + out_pos, n * sizeof (uint8_t));
+    out_pos = out_pos + n;
+    done = done + n;
+  }
+  p->squeezing = true;
+  p->out_pos = out_pos;
+}
+
+static void free_shake(Hacl_Streaming_SHA3_state_shake128 *s)
+{
+  Hacl_Streaming_SHA3_state_shake128 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_224()
+{
+  return create_in_sha3((uint32_t)144U);
+}
+
+void Hacl_Streaming_SHA3_init_224(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  init_sha3(s);
+}
+
+void
+Hacl_Streaming_SHA3_update_224(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  update_sha3((uint32_t)144U, p, data, len);
+}
+
+void Hacl_Streaming_SHA3_finish_224(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  finish_sha3((uint32_t)144U, (uint32_t)28U, p, dst);
+}
+
+void Hacl_Streaming_SHA3_free_224(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  free_sha3(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_256()
+{
+  return create_in_sha3((uint32_t)136U);
+}
+
+void Hacl_Streaming_SHA3_init_256(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  init_sha3(s);
+}
+
+void
+Hacl_Streaming_SHA3_update_256(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  update_sha3((uint32_t)136U, p, data, len);
+}
+
+void Hacl_Streaming_SHA3_finish_256(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  finish_sha3((uint32_t)136U, (uint32_t)32U, p, dst);
+}
+
+void Hacl_Streaming_SHA3_free_256(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  free_sha3(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_384()
+{
+  return create_in_sha3((uint32_t)104U);
+}
+
+void Hacl_Streaming_SHA3_init_384(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  init_sha3(s);
+}
+
+void
+Hacl_Streaming_SHA3_update_384(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  update_sha3((uint32_t)104U, p, data, len);
+}
+
+void Hacl_Streaming_SHA3_finish_384(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  finish_sha3((uint32_t)104U, (uint32_t)48U, p, dst);
+}
+
+void Hacl_Streaming_SHA3_free_384(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  free_sha3(s);
+}
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_512()
+{
+  return create_in_sha3((uint32_t)72U);
+}
+
+void Hacl_Streaming_SHA3_init_512(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  init_sha3(s);
+}
+
+void
+Hacl_Streaming_SHA3_update_512(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  update_sha3((uint32_t)72U, p, data, len);
+}
+
+void Hacl_Streaming_SHA3_finish_512(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst)
+{
+  finish_sha3((uint32_t)72U, (uint32_t)64U, p, dst);
+}
+
+void Hacl_Streaming_SHA3_free_512(Hacl_Streaming_SHA3_state_sha3_224 *s)
+{
+  free_sha3(s);
+}
+
+Hacl_Streaming_SHA3_state_shake128 *Hacl_Streaming_SHA3_create_in_shake128()
+{
+  return create_in_shake((uint32_t)168U);
+}
+
+void Hacl_Streaming_SHA3_init_shake128(Hacl_Streaming_SHA3_state_shake128 *s)
+{
+  init_shake(s);
+}
+
+void
+Hacl_Streaming_SHA3_update_shake128(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  update_shake((uint32_t)168U, p, data, len);
+}
+
+void
+Hacl_Streaming_SHA3_squeeze_shake128(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *dst,
+  uint32_t len
+)
+{
+  squeeze_shake((uint32_t)168U, p, dst, len);
+}
+
+void Hacl_Streaming_SHA3_free_shake128(Hacl_Streaming_SHA3_state_shake128 *s)
+{
+  free_shake(s);
+}
+
+Hacl_Streaming_SHA3_state_shake128 *Hacl_Streaming_SHA3_create_in_shake256()
+{
+  return create_in_shake((uint32_t)136U);
+}
+
+void Hacl_Streaming_SHA3_init_shake256(Hacl_Streaming_SHA3_state_shake128 *s)
+{
+  init_shake(s);
+}
+
+void
+Hacl_Streaming_SHA3_update_shake256(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  update_shake((uint32_t)136U, p, data, len);
+}
+
+void
+Hacl_Streaming_SHA3_squeeze_shake256(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *dst,
+  uint32_t len
+)
+{
+  squeeze_shake((uint32_t)136U, p, dst, len);
+}
+
+void Hacl_Streaming_SHA3_free_shake256(Hacl_Streaming_SHA3_state_shake128 *s)
+{
+  free_shake(s);
+}
@@ -0,0 +1,196 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+#ifndef __Hacl_Streaming_SHA3_H
+#define __Hacl_Streaming_SHA3_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_SHA3.h"
+
+/*
+  The Keccak state (25 lanes), the partial block that has not been absorbed yet
+  and the number of bytes fed so far. As for the other streaming hashes, a full
+  block stays in buf until more input arrives, so that finish always has a
+  non-empty last block to pad.
+*/
+typedef struct Hacl_Streaming_SHA3_state_sha3_224_s
+{
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_Streaming_SHA3_state_sha3_224;
+
+typedef Hacl_Streaming_SHA3_state_sha3_224 Hacl_Streaming_SHA3_state_sha3_256;
+
+typedef Hacl_Streaming_SHA3_state_sha3_224 Hacl_Streaming_SHA3_state_sha3_384;
+
+typedef Hacl_Streaming_SHA3_state_sha3_224 Hacl_Streaming_SHA3_state_sha3_512;
+
+/*
+  A SHAKE state absorbs like the SHA-3 ones until the first call to squeeze,
+  which pads the input. From then on buf holds the current output block and
+  out_pos is the number of its bytes already handed out.
+*/
+typedef struct Hacl_Streaming_SHA3_state_shake128_s
+{
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+  bool squeezing;
+  uint32_t out_pos;
+}
+Hacl_Streaming_SHA3_state_shake128;
+
+typedef Hacl_Streaming_SHA3_state_shake128 Hacl_Streaming_SHA3_state_shake256;
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_224();
+
+void Hacl_Streaming_SHA3_init_224(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+void
+Hacl_Streaming_SHA3_update_224(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA3_finish_224(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst);
+
+void Hacl_Streaming_SHA3_free_224(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_256();
+
+void Hacl_Streaming_SHA3_init_256(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+void
+Hacl_Streaming_SHA3_update_256(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA3_finish_256(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst);
+
+void Hacl_Streaming_SHA3_free_256(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_384();
+
+void Hacl_Streaming_SHA3_init_384(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+void
+Hacl_Streaming_SHA3_update_384(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA3_finish_384(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst);
+
+void Hacl_Streaming_SHA3_free_384(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+Hacl_Streaming_SHA3_state_sha3_224 *Hacl_Streaming_SHA3_create_in_512();
+
+void Hacl_Streaming_SHA3_init_512(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+void
+Hacl_Streaming_SHA3_update_512(
+  Hacl_Streaming_SHA3_state_sha3_224 *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA3_finish_512(Hacl_Streaming_SHA3_state_sha3_224 *p, uint8_t *dst);
+
+void Hacl_Streaming_SHA3_free_512(Hacl_Streaming_SHA3_state_sha3_224 *s);
+
+Hacl_Streaming_SHA3_state_shake128 *Hacl_Streaming_SHA3_create_in_shake128();
+
+void Hacl_Streaming_SHA3_init_shake128(Hacl_Streaming_SHA3_state_shake128 *s);
+
+/*
+  Absorb len more bytes. Input given after the first call to squeeze is ignored:
+  call init to start a new message.
+*/
+void
+Hacl_Streaming_SHA3_update_shake128(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+/*
+  Write the next len bytes of output to dst. Successive calls continue the same
+  output stream, so squeezing n1 then n2 bytes yields the same bytes as
+  squeezing n1 + n2 at once.
+*/
+void
+Hacl_Streaming_SHA3_squeeze_shake128(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *dst,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA3_free_shake128(Hacl_Streaming_SHA3_state_shake128 *s);
+
+Hacl_Streaming_SHA3_state_shake128 *Hacl_Streaming_SHA3_create_in_shake256();
+
+void Hacl_Streaming_SHA3_init_shake256(Hacl_Streaming_SHA3_state_shake128 *s);
+
+void
+Hacl_Streaming_SHA3_update_shake256(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+void
+Hacl_Streaming_SHA3_squeeze_shake256(
+  Hacl_Streaming_SHA3_state_shake128 *p,
+  uint8_t *dst,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA3_free_shake256(Hacl_Streaming_SHA3_state_shake128 *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Streaming_SHA3_H_DEFINED
+#endif
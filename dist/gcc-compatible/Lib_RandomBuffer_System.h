@@ -47,6 +47,14 @@ extern void *Lib_RandomBuffer_System_entropy_p;
 
 extern void Lib_RandomBuffer_System_crypto_random(uint8_t *buf, uint32_t len);
 
+/*
+  Opt-in buffered mode for the two functions above. Requests of up to 256 bytes
+  are then served from a per-thread ChaCha20 pool seeded from the OS, with fast
+  key erasure, a reseed every MiB, and a reseed in the child after fork().
+  Larger requests still read from the OS directly. Off by default.
+*/
+extern void Lib_RandomBuffer_System_set_buffered(bool enable);
+
 #if defined(__cplusplus)
 }
 #endif
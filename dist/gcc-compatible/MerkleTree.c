@@ -24,6 +24,13 @@
 
 #include "MerkleTree.h"
 
+#if !(defined(_WIN32) || defined(_WIN64))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 static uint8_t *hash_r_alloc(uint32_t s)
 {
   KRML_CHECK_SIZE(sizeof (uint8_t), s);
@@ -257,6 +264,8 @@ inline void mt_free(MerkleTree_Low_merkle_tree *mt)
   @param[in]  v   The tree does not take ownership of the hash, it makes a copy of its content.
 
  Note: The content of the hash will be overwritten with an arbitrary value.
+ A memory-mapped tree that cannot extend its storage exits the process; use
+ mt_try_insert to handle this case.
 */
 inline void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
 {
@@ -271,6 +280,49 @@ inline bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
   return MerkleTree_Low_mt_insert_pre(mt, v);
 }
 
+/*
+  Insertion that reports storage failures
+
+  @param[in]  mt  The Merkle tree
+  @param[in]  v   As for mt_insert; its content is overwritten.
+
+  return true, or false if a memory-mapped tree cannot extend its storage, in
+  which case the tree is left unchanged
+
+ The precondition is that of mt_insert.
+*/
+inline bool mt_try_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+{
+  return MerkleTree_Low_mt_try_insert(mt, v);
+}
+
+/*
+  Batch insertion
+
+  @param[in]  mt  The Merkle tree
+  @param[in]  vs  The n hashes to insert, stored contiguously (n * hash_size bytes).
+  @param[in]  n   The number of hashes
+
+ Equivalent to n calls to mt_insert, but each level of the tree is built in a
+ single pass; with the default hash function, sibling pairs are compressed
+ several at a time. The content of vs is left untouched.
+
+  return true, or false if a memory-mapped tree cannot extend its storage, in
+  which case the tree is left unchanged
+*/
+inline bool mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *vs, uint32_t n)
+{
+  return MerkleTree_Low_mt_insert_batch(mt, vs, n);
+}
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+inline bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *vs, uint32_t n)
+{
+  return MerkleTree_Low_mt_insert_batch_pre(mt, vs, n);
+}
+
 /*
   Getting the Merkle root
 
@@ -331,6 +383,50 @@ mt_get_path_pre(
   return MerkleTree_Low_mt_get_path_pre(mt, idx, path1, root);
 }
 
+/*
+  Getting the Merkle paths of several leaves at once (a multi-path)
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The indices of the target hashes, in strictly increasing order
+  @param[in]  n    The number of indices
+  @param[out] path A resulting multi-path: the n leaf hashes, followed by the
+                   sibling hashes needed to recompute the root from all of them.
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - Hashes that are shared by the paths of several leaves are included once.
+  - As with mt_get_path, the resulting path points to hashes in the tree, and
+    the indices must be within the currently held indices in the tree.
+*/
+inline uint32_t
+mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_paths(mt, idx, n, path1, root);
+}
+
+/*
+  Precondition predicate for mt_get_paths
+*/
+inline bool
+mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_paths_pre(mt, idx, n, path1, root);
+}
+
 /*
   Flush the Merkle tree
 
@@ -429,6 +525,50 @@ mt_verify_pre(
   return MerkleTree_Low_mt_verify_pre(mt, tgt, max, path1, root);
 }
 
+/*
+  Client-side verification of a multi-path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The indices of the target hashes, in strictly increasing order
+  @param[in]  n    The number of indices
+  @param[in]  max  The maximum index + 1 of the tree when the path was generated
+  @param[in]  path The multi-path to verify, as returned by mt_get_paths
+  @param[in]  root
+
+  return true if the verification succeeded for all the leaves, false otherwise
+
+  Note: each internal node is recomputed once, however many of the leaves
+  lie below it.
+*/
+inline bool
+mt_verify_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_verify_paths(mt, idx, n, max, path1, root);
+}
+
+/*
+  Precondition predicate for mt_verify_paths
+*/
+inline bool
+mt_verify_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_verify_paths_pre(mt, idx, n, max, path1, root);
+}
+
 /*
   Serialization size
 
@@ -509,6 +649,60 @@ inline MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len
   return MerkleTree_Low_Serialization_mt_deserialize_path(buf, len);
 }
 
+/*
+  Multi-path serialization, together with the leaf indices and tree size it
+  is valid for
+
+  @param[in]  idx  The indices of the target hashes
+  @param[in]  n    The number of indices
+  @param[in]  max  The maximum index + 1 of the tree when the path was generated
+  @param[in]  path The multi-path
+  @param[out] buf  The buffer to serialize the multi-path into
+  @param[in]  len  Length of buf
+
+  return the number of bytes written, 0 if buf is too small
+
+  Note: this takes 20 + 4 * n + hash_size * (number of hashes in path) bytes.
+*/
+inline uint64_t
+mt_serialize_paths(
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *buf,
+  uint64_t len
+)
+{
+  return MerkleTree_Low_Serialization_mt_serialize_paths(idx, n, max, path1, buf, len);
+}
+
+/*
+  Multi-path deserialization
+
+  @param[in]  buf     The buffer to deserialize the multi-path from
+  @param[in]  len     Length of buf
+  @param[out] idx     The indices of the target hashes
+  @param[in]  idx_len The number of entries available in idx
+  @param[out] n       The number of indices
+  @param[out] max     The maximum index + 1 of the tree the path is valid for
+
+  return pointer to the new path if successful, NULL otherwise (including
+  when the multi-path covers more than idx_len leaves)
+*/
+inline MerkleTree_Low_path
+*mt_deserialize_paths(
+  const uint8_t *buf,
+  uint64_t len,
+  uint64_t *idx,
+  uint32_t idx_len,
+  uint32_t *n,
+  uint64_t *max
+)
+{
+  return MerkleTree_Low_Serialization_mt_deserialize_paths(buf, len, idx, idx_len, n, max);
+}
+
 /*
   Default hash function
 */
@@ -647,6 +841,31 @@ void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst)
   EverCrypt_Hash_finish(&st, dst);
 }
 
+/*
+  Default hash function, applied to n sibling pairs at once: blocks[i] holds
+  the two 32-byte hashes to combine into dsts[i].
+*/
+static void mt_sha256_compress_multi(uint32_t n, uint8_t **dsts, uint8_t **blocks)
+{
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if EVERCRYPT_CAN_COMPILE_VEC256
+  if (vec256 && !(has_shaext && has_sse))
+  {
+    Hacl_SHA2_Vec256_sha256_compress_multi(n, dsts, blocks);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint32_t st[8U] = { 0U };
+    Hacl_Hash_Core_SHA2_init_256(st);
+    EverCrypt_Hash_update_multi_256(st, blocks[i], (uint32_t)1U);
+    Hacl_Hash_Core_SHA2_finish_256(st, dsts[i]);
+  }
+}
+
 /*
   Construction wired to sha256 from EverCrypt
 
@@ -657,6 +876,100 @@ inline MerkleTree_Low_merkle_tree *mt_create(uint8_t *init)
   return MerkleTree_Low_mt_create_custom((uint32_t)32U, init, mt_sha256_compress);
 }
 
+/*
+  Construction of a tree whose levels live in memory-mapped files in an
+  existing directory, wired to sha256 from EverCrypt
+
+  @param[in]  dir    The directory; it must not already hold a tree
+  @param[in]  init   The initial hash
+
+  return The new Merkle tree, or NULL if the storage cannot be created
+*/
+inline MerkleTree_Low_merkle_tree *mt_create_mmap(const char *dir, uint8_t *init)
+{
+  return MerkleTree_Low_mt_create_mmap(dir, (uint32_t)32U, init, mt_sha256_compress);
+}
+
+/*
+  Custom construction of a memory-mapped tree
+
+  @param[in]  dir       The directory; it must not already hold a tree
+  @param[in]  hash_size Hash size (in bytes), at most 64
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the storage cannot be created
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_mmap_custom(
+  const char *dir,
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_create_mmap(dir, hash_size, i, hash_fun);
+}
+
+/*
+  Construction wired to sha256 from EverCrypt, keeping each level in one
+  contiguous array (falls back to mt_create where this is not supported). The
+  tree reserves about 2 * 2^32 * 32 bytes of virtual address space.
+
+  @param[in]  init   The initial hash
+
+  return The new Merkle tree, or NULL if the initial hash cannot be stored
+*/
+inline MerkleTree_Low_merkle_tree *mt_create_arena(uint8_t *init)
+{
+  return MerkleTree_Low_mt_create_arena((uint32_t)32U, init, mt_sha256_compress);
+}
+
+/*
+  Custom construction keeping each level in one contiguous array
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the initial hash cannot be stored
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_arena_custom(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_create_arena(hash_size, i, hash_fun);
+}
+
+/*
+  Reopen a memory-mapped tree in the state of its last mt_sync (mt_free syncs
+  implicitly)
+
+  @param[in]  dir       The directory
+  @param[in]  hash_fun  The hash function the tree was built with
+
+  return The Merkle tree, or NULL if the directory does not hold a valid tree
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_open_mmap(const char *dir, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2))
+{
+  return MerkleTree_Low_mt_open_mmap(dir, hash_fun);
+}
+
+/*
+  Make the current state of a memory-mapped tree durable, then release the
+  storage of the hashes it no longer holds; a no-op on trees held in memory
+
+  @param[in]  mt   The Merkle tree
+
+  return true on success
+*/
+inline bool mt_sync(MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_mt_sync(mt);
+}
+
 uint32_t MerkleTree_Low_uint32_32_max = (uint32_t)4294967295U;
 
 uint64_t MerkleTree_Low_uint32_max = (uint64_t)4294967295U;
@@ -896,7 +1209,8 @@ static MerkleTree_Low_merkle_tree
         .rhs_ok = false,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = NULL
       }
     );
   return mt;
@@ -947,89 +1261,837 @@ free__LowStar_Vector_vector_str__uint8_t__uint32_t(
   free__LowStar_Vector_vector_str__uint8_t_(rv);
 }
 
-void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
+/*
+  Memory-mapped storage
+
+  A tree created by mt_create_mmap keeps level lv in the file <dir>/level.<lv>,
+  in which the node at position k (counted from the first leaf ever inserted,
+  flushed or not) is stored at byte k * hash_size. Each file is mapped into an
+  address range that is reserved for the largest level the tree can have, so
+  hashes never move once written and paths remain valid exactly as they do for
+  heap trees. The bounds of the tree are recorded in <dir>/meta by mt_sync.
+  Until then the files must still hold everything the previous meta refers to,
+  so flushed prefixes are punched out and retracted tails truncated only once
+  the new meta is on disk.
+
+  A tree created by mt_create_arena uses the same layout with anonymous memory
+  instead of files (dir is NULL): each level is one contiguous array indexed by
+  position, rather than a vector of separately allocated hashes.
+*/
+
+typedef struct hash_level_s
 {
-  MerkleTree_Low_merkle_tree mtv = *mt;
-  free__LowStar_Vector_vector_str__uint8_t__uint32_t((
-      (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
-        .state = mtv.hash_size,
-        .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-        .r_alloc = hash_vec_r_alloc,
-        .r_free = hash_vec_r_free
-      }
-    ),
-    mtv.hs);
-  free___uint8_t__uint32_t((
-      (regional__uint32_t__uint8_t_){
-        .state = mtv.hash_size,
-        .dummy = NULL,
-        .r_alloc = hash_r_alloc,
-        .r_free = hash_r_free
-      }
-    ),
-    mtv.rhs);
-  regional__uint32_t__uint8_t_
-  x00 = { .state = mtv.hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
-  regional__uint32_t__uint8_t_
-  x0 = { .state = mtv.hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
-  x00.r_free(x0.state, mtv.mroot);
-  KRML_HOST_FREE(mt);
+  int fd;
+  uint8_t *base;
+  uint64_t mapped;
+  uint64_t reserved;
+  uint64_t dropped;
+  uint64_t drop_to;
+  bool shrunk;
 }
+hash_level;
 
-static MerkleTree_Low_Datastructures_hash_vec
-insert___uint8_t__uint32_t(MerkleTree_Low_Datastructures_hash_vec rv, uint8_t *v)
+struct MerkleTree_Low_hash_store_s
 {
-  MerkleTree_Low_Datastructures_hash_vec irv = insert___uint8_t_(rv, v);
-  return irv;
+  char *dir;
+  hash_level levels[32U];
+};
+
+static char *store_path(const char *dir, const char *name)
+{
+  size_t len = strlen(dir) + strlen(name) + (size_t)2U;
+  char *path = KRML_HOST_MALLOC(len);
+  snprintf(path, len, "%s/%s", dir, name);
+  return path;
 }
 
-typedef void (*copyable__uint32_t__uint8_t_)(uint32_t x0, uint8_t *x1, uint8_t *x2);
+static MerkleTree_Low_hash_store *store_new(const char *dir)
+{
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_hash_store), (uint32_t)1U);
+  MerkleTree_Low_hash_store *st = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_hash_store));
+  st->dir = NULL;
+  if (dir != NULL)
+  {
+    size_t len = strlen(dir) + (size_t)1U;
+    st->dir = KRML_HOST_MALLOC(len);
+    memcpy(st->dir, dir, len);
+  }
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    st->levels[lv] =
+      (
+        (hash_level){
+          .fd = -1,
+          .base = NULL,
+          .mapped = (uint64_t)0U,
+          .reserved = (uint64_t)0U,
+          .dropped = (uint64_t)0U,
+          .drop_to = (uint64_t)0U,
+          .shrunk = false
+        }
+      );
+  }
+  return st;
+}
 
-static MerkleTree_Low_Datastructures_hash_vec
-insert_copy___uint8_t__uint32_t(
-  regional__uint32_t__uint8_t_ rg,
-  void (*cp)(uint32_t x0, uint8_t *x1, uint8_t *x2),
-  MerkleTree_Low_Datastructures_hash_vec rv,
-  uint8_t *v
-)
+#if !(defined(_WIN32) || defined(_WIN64))
+
+static uint64_t store_round(uint64_t n)
 {
-  uint8_t *nv = rg.r_alloc(rg.state);
-  cp(rg.state, v, nv);
-  return insert___uint8_t__uint32_t(rv, nv);
+  uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE);
+  return (n + page - (uint64_t)1U) / page * page;
 }
 
-static void
-assign__LowStar_Vector_vector_str__uint8_t__uint32_t(
-  MerkleTree_Low_Datastructures_hash_vv rv,
-  uint32_t i,
-  MerkleTree_Low_Datastructures_hash_vec v
-)
+/* Give a range back to the reservation: it stays in the address space, but is
+   no longer backed by the file. */
+static bool store_unback(uint8_t *p, uint64_t len)
 {
-  assign__LowStar_Vector_vector_str__uint8_t_(rv, i, v);
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED;
+  #ifdef MAP_NORESERVE
+  flags = flags | MAP_NORESERVE;
+  #endif
+  return mmap(p, (size_t)len, PROT_NONE, flags, -1, (off_t)0) != MAP_FAILED;
 }
 
-static void
-insert_(
-  uint32_t hsz,
-  uint32_t lv,
-  uint32_t j,
-  MerkleTree_Low_Datastructures_hash_vv hs,
-  uint8_t *acc,
-  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
-)
+/* Extend a level file from len0 to len bytes, allocating the blocks so that
+   running out of space shows up here rather than as a fault on the mapping. */
+static bool store_extend(int fd, uint64_t len0, uint64_t len)
 {
-  MerkleTree_Low_Datastructures_hash_vec
-  uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-  MerkleTree_Low_Datastructures_hash_vec
-  ihv =
-    insert_copy___uint8_t__uint32_t((
-        (regional__uint32_t__uint8_t_){
-          .state = hsz,
-          .dummy = NULL,
-          .r_alloc = hash_r_alloc,
-          .r_free = hash_r_free
-        }
-      ),
+  #if defined(__APPLE__)
+  return ftruncate(fd, (off_t)len) == 0;
+  #else
+  return posix_fallocate(fd, (off_t)len0, (off_t)(len - len0)) == 0;
+  #endif
+}
+
+static bool store_level_open(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, bool create)
+{
+  hash_level *l = st->levels + lv;
+  uint64_t reserved = store_round(((uint64_t)1U << ((uint32_t)32U - lv)) * (uint64_t)hsz);
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+  #ifdef MAP_NORESERVE
+  flags = flags | MAP_NORESERVE;
+  #endif
+  if (st->dir == NULL)
+  {
+    void *base = mmap(NULL, (size_t)reserved, PROT_NONE, flags, -1, (off_t)0);
+    if (base == MAP_FAILED)
+    {
+      return false;
+    }
+    l->base = (uint8_t *)base;
+    l->reserved = reserved;
+    return true;
+  }
+  char name[16U];
+  snprintf(name, sizeof name, "level.%u", (unsigned)lv);
+  char *path = store_path(st->dir, name);
+  int fd;
+  if (create)
+  {
+    fd = open(path, O_RDWR | O_CREAT, 0644);
+  }
+  else
+  {
+    fd = open(path, O_RDWR);
+  }
+  KRML_HOST_FREE(path);
+  if (fd < 0)
+  {
+    return false;
+  }
+  void *base = mmap(NULL, (size_t)reserved, PROT_NONE, flags, -1, (off_t)0);
+  struct stat sb;
+  if (base == MAP_FAILED || fstat(fd, &sb) != 0)
+  {
+    if (base != MAP_FAILED)
+    {
+      munmap(base, (size_t)reserved);
+    }
+    close(fd);
+    return false;
+  }
+  uint64_t mapped = store_round((uint64_t)sb.st_size);
+  bool ok = mapped <= reserved;
+  if (ok && mapped > (uint64_t)0U)
+  {
+    ok =
+      (mapped == (uint64_t)sb.st_size || store_extend(fd, (uint64_t)sb.st_size, mapped))
+      &&
+        mmap(base,
+          (size_t)mapped,
+          PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_FIXED,
+          fd,
+          (off_t)0)
+        != MAP_FAILED;
+  }
+  if (!ok)
+  {
+    munmap(base, (size_t)reserved);
+    close(fd);
+    return false;
+  }
+  *l =
+    (
+      (hash_level){
+        .fd = fd,
+        .base = (uint8_t *)base,
+        .mapped = mapped,
+        .reserved = reserved,
+        .dropped = (uint64_t)0U,
+        .drop_to = (uint64_t)0U,
+        .shrunk = false
+      }
+    );
+  return true;
+}
+
+/* Make positions [0, n) of level lv addressable, growing the file (or the
+   accessible part of the reservation) geometrically. */
+static bool store_level_grow(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, uint32_t n)
+{
+  hash_level *l = st->levels + lv;
+  uint64_t need = (uint64_t)n * (uint64_t)hsz;
+  if (need <= l->mapped)
+  {
+    return true;
+  }
+  if (l->base == NULL && !store_level_open(st, hsz, lv, true))
+  {
+    return false;
+  }
+  if (need <= l->mapped)
+  {
+    return true;
+  }
+  uint64_t len = (uint64_t)2U * l->mapped;
+  if (len < need)
+  {
+    len = need;
+  }
+  if (len < (uint64_t)65536U)
+  {
+    len = (uint64_t)65536U;
+  }
+  len = store_round(len);
+  if (len > l->reserved)
+  {
+    len = l->reserved;
+  }
+  if (l->fd < 0)
+  {
+    if (mprotect(l->base + l->mapped, (size_t)(len - l->mapped), PROT_READ | PROT_WRITE) != 0)
+    {
+      return false;
+    }
+    l->mapped = len;
+    return true;
+  }
+  if (!store_extend(l->fd, l->mapped, len))
+  {
+    return false;
+  }
+  void
+  *p =
+    mmap(l->base + l->mapped,
+      (size_t)(len - l->mapped),
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_FIXED,
+      l->fd,
+      (off_t)l->mapped);
+  if (p == MAP_FAILED)
+  {
+    return false;
+  }
+  l->mapped = len;
+  return true;
+}
+
+/* Retraction: positions n and above are gone. Anonymous memory is released
+   right away; a level file keeps its tail until store_sync, which truncates it
+   to the size of the synced tree. */
+static void store_level_shrink(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, uint32_t n)
+{
+  hash_level *l = st->levels + lv;
+  uint64_t len = store_round((uint64_t)n * (uint64_t)hsz);
+  if (l->base == NULL || len >= l->mapped)
+  {
+    return;
+  }
+  if (l->fd >= 0)
+  {
+    l->shrunk = true;
+    return;
+  }
+  if (store_unback(l->base + len, l->mapped - len))
+  {
+    l->mapped = len;
+    if (l->dropped > len)
+    {
+      l->dropped = len;
+    }
+  }
+}
+
+/* Flushing: positions below n are no longer needed, give their pages back to
+   the system. Anonymous pages go right away; pages of a level file are punched
+   out of it by store_sync, where the system supports it. */
+static void store_level_drop(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, uint32_t n)
+{
+  hash_level *l = st->levels + lv;
+  uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE);
+  uint64_t end = (uint64_t)n * (uint64_t)hsz / page * page;
+  if (end > l->mapped)
+  {
+    end = l->mapped;
+  }
+  if (l->fd >= 0)
+  {
+    if (end > l->drop_to)
+    {
+      l->drop_to = end;
+    }
+    return;
+  }
+  if (end > l->dropped)
+  {
+    madvise(l->base + l->dropped, (size_t)(end - l->dropped), MADV_DONTNEED);
+    l->dropped = end;
+  }
+}
+
+/* The part of store_level_shrink and store_level_drop that waits for the meta
+   of a tree with j leaves to be on disk. */
+static bool store_level_trim(hash_level *l, uint32_t hsz, uint32_t lv, uint32_t j)
+{
+  bool ok = true;
+  if (l->shrunk)
+  {
+    uint64_t len = store_round((uint64_t)(j >> lv) * (uint64_t)hsz);
+    if (len < l->mapped)
+    {
+      ok = store_unback(l->base + len, l->mapped - len) && ftruncate(l->fd, (off_t)len) == 0;
+      if (ok)
+      {
+        l->mapped = len;
+      }
+    }
+    l->shrunk = !ok;
+  }
+  if (l->drop_to > l->mapped)
+  {
+    l->drop_to = l->mapped;
+  }
+  if (l->dropped > l->mapped)
+  {
+    l->dropped = l->mapped;
+  }
+  #ifdef MADV_REMOVE
+  if (l->drop_to > l->dropped)
+  {
+    if (madvise(l->base + l->dropped, (size_t)(l->drop_to - l->dropped), MADV_REMOVE) == 0)
+    {
+      l->dropped = l->drop_to;
+    }
+  }
+  #endif
+  return ok;
+}
+
+static bool
+store_write_meta(
+  MerkleTree_Low_hash_store *st,
+  uint32_t hsz,
+  uint64_t offset,
+  uint32_t i,
+  uint32_t j
+)
+{
+  uint8_t buf[24U] = { 0U };
+  memcpy(buf, "MTM\001", (uint32_t)4U * sizeof (uint8_t));
+  store32_le(buf + (uint32_t)4U, hsz);
+  store64_le(buf + (uint32_t)8U, offset);
+  store32_le(buf + (uint32_t)16U, i);
+  store32_le(buf + (uint32_t)20U, j);
+  char *tmp = store_path(st->dir, "meta.tmp");
+  char *path = store_path(st->dir, "meta");
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  bool ok = fd >= 0 && write(fd, buf, sizeof buf) == (ssize_t)sizeof buf && fsync(fd) == 0;
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+  ok = ok && rename(tmp, path) == 0;
+  KRML_HOST_FREE(tmp);
+  KRML_HOST_FREE(path);
+  /* The rename is durable once the directory itself is synced. */
+  if (ok)
+  {
+    int dfd = open(st->dir, O_RDONLY);
+    ok = dfd >= 0 && fsync(dfd) == 0;
+    if (dfd >= 0)
+    {
+      close(dfd);
+    }
+  }
+  return ok;
+}
+
+static bool
+store_read_meta(
+  MerkleTree_Low_hash_store *st,
+  uint32_t *hsz,
+  uint64_t *offset,
+  uint32_t *i,
+  uint32_t *j
+)
+{
+  uint8_t buf[24U] = { 0U };
+  char *path = store_path(st->dir, "meta");
+  int fd = open(path, O_RDONLY);
+  KRML_HOST_FREE(path);
+  if (fd < 0)
+  {
+    return false;
+  }
+  bool ok = read(fd, buf, sizeof buf) == (ssize_t)sizeof buf && memcmp(buf, "MTM\001", 4U) == 0;
+  close(fd);
+  *hsz = load32_le(buf + (uint32_t)4U);
+  *offset = load64_le(buf + (uint32_t)8U);
+  *i = load32_le(buf + (uint32_t)16U);
+  *j = load32_le(buf + (uint32_t)20U);
+  return ok;
+}
+
+static bool store_exists(MerkleTree_Low_hash_store *st)
+{
+  char *path = store_path(st->dir, "meta");
+  bool r = access(path, F_OK) == 0;
+  KRML_HOST_FREE(path);
+  return r;
+}
+
+static bool
+store_sync(MerkleTree_Low_hash_store *st, uint32_t hsz, uint64_t offset, uint32_t i, uint32_t j)
+{
+  if (st->dir == NULL)
+  {
+    return true;
+  }
+  bool ok = true;
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    hash_level *l = st->levels + lv;
+    if (l->mapped > (uint64_t)0U)
+    {
+      ok = msync(l->base, (size_t)l->mapped, MS_SYNC) == 0 && ok;
+    }
+  }
+  if (!(ok && store_write_meta(st, hsz, offset, i, j)))
+  {
+    return false;
+  }
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    hash_level *l = st->levels + lv;
+    if (l->base != NULL)
+    {
+      ok = store_level_trim(l, hsz, lv, j) && ok;
+    }
+  }
+  return ok;
+}
+
+/* Release the mappings and file descriptors, leaving the files as they are. */
+static void store_free(MerkleTree_Low_hash_store *st)
+{
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    hash_level *l = st->levels + lv;
+    if (l->base != NULL)
+    {
+      munmap(l->base, (size_t)l->reserved);
+    }
+    if (l->fd >= 0)
+    {
+      close(l->fd);
+    }
+  }
+  KRML_HOST_FREE(st->dir);
+  KRML_HOST_FREE(st);
+}
+
+/* Persist the tree, trim the files to their logical size and release it. */
+static void store_close(MerkleTree_Low_hash_store *st, uint32_t hsz, uint64_t offset, uint32_t i, uint32_t j)
+{
+  if (st->dir == NULL)
+  {
+    store_free(st);
+    return;
+  }
+  /* The files may only be cut to the new size once its meta is on disk:
+     otherwise the meta still describes hashes past that size. */
+  bool ok = store_sync(st, hsz, offset, i, j);
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    hash_level *l = st->levels + lv;
+    if (l->base != NULL)
+    {
+      munmap(l->base, (size_t)l->reserved);
+      l->base = NULL;
+    }
+    if (ok && l->fd >= 0)
+    {
+      ok = ftruncate(l->fd, (off_t)((uint64_t)(j >> lv) * (uint64_t)hsz)) == 0;
+    }
+  }
+  if (!ok)
+  {
+    KRML_HOST_EPRINTF("MerkleTree: cannot sync the memory-mapped storage\n");
+  }
+  store_free(st);
+}
+
+#else
+
+static bool store_level_open(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, bool create)
+{
+  return false;
+}
+
+static bool store_level_grow(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, uint32_t n)
+{
+  return false;
+}
+
+static void store_level_shrink(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, uint32_t n)
+{
+
+}
+
+static void store_level_drop(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, uint32_t n)
+{
+
+}
+
+static bool
+store_read_meta(
+  MerkleTree_Low_hash_store *st,
+  uint32_t *hsz,
+  uint64_t *offset,
+  uint32_t *i,
+  uint32_t *j
+)
+{
+  return false;
+}
+
+static bool store_exists(MerkleTree_Low_hash_store *st)
+{
+  return true;
+}
+
+static bool
+store_sync(MerkleTree_Low_hash_store *st, uint32_t hsz, uint64_t offset, uint32_t i, uint32_t j)
+{
+  return false;
+}
+
+static void store_free(MerkleTree_Low_hash_store *st)
+{
+  KRML_HOST_FREE(st->dir);
+  KRML_HOST_FREE(st);
+}
+
+static void store_close(MerkleTree_Low_hash_store *st, uint32_t hsz, uint64_t offset, uint32_t i, uint32_t j)
+{
+  store_free(st);
+}
+
+#endif
+
+static uint8_t *store_hash(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t lv, uint32_t k)
+{
+  return st->levels[lv].base + (uint64_t)k * (uint64_t)hsz;
+}
+
+/* Counterpart of insert_ and insert_batch_level: since siblings are adjacent
+   in a level file, pairs are hashed in place. Every level is extended before
+   anything is written, so that the tree is left as it was when the storage
+   cannot grow. */
+static bool store_insert_batch(MerkleTree_Low_merkle_tree mtv, uint8_t *vs, uint32_t n)
+{
+  MerkleTree_Low_hash_store *st = mtv.store;
+  uint32_t hsz = mtv.hash_size;
+  uint32_t j0 = mtv.j;
+  uint32_t j1 = mtv.j + n;
+  bool multi = mtv.hash_fun == mt_sha256_compress && hsz == (uint32_t)32U;
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U && j1 >> lv > (uint32_t)0U; lv++)
+  {
+    if (!store_level_grow(st, hsz, lv, j1 >> lv))
+    {
+      return false;
+    }
+  }
+  memcpy(store_hash(st, hsz, (uint32_t)0U, j0), vs, (uint64_t)n * (uint64_t)hsz);
+  for
+  (uint32_t lv = (uint32_t)0U;
+    lv + (uint32_t)1U < (uint32_t)32U && j0 >> (lv + (uint32_t)1U) < j1 >> (lv + (uint32_t)1U);
+    lv++)
+  {
+    uint32_t p0 = j0 >> (lv + (uint32_t)1U);
+    uint32_t p1 = j1 >> (lv + (uint32_t)1U);
+    uint8_t *bs[64U];
+    uint8_t *ds[64U];
+    for (uint32_t c0 = p0; c0 < p1; c0 = c0 + (uint32_t)64U)
+    {
+      uint32_t m = p1 - c0;
+      if (m > (uint32_t)64U)
+      {
+        m = (uint32_t)64U;
+      }
+      for (uint32_t i = (uint32_t)0U; i < m; i++)
+      {
+        uint8_t *l = store_hash(st, hsz, lv, (uint32_t)2U * (c0 + i));
+        ds[i] = store_hash(st, hsz, lv + (uint32_t)1U, c0 + i);
+        if (multi)
+        {
+          bs[i] = l;
+        }
+        else
+        {
+          mtv.hash_fun(l, l + hsz, ds[i]);
+        }
+      }
+      if (multi)
+      {
+        mt_sha256_compress_multi(m, ds, bs);
+      }
+    }
+  }
+  return true;
+}
+
+/* Counterpart of construct_rhs. */
+static void
+store_construct_rhs(
+  MerkleTree_Low_hash_store *st,
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_vec rhs,
+  uint32_t j,
+  uint8_t *acc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  bool actd = false;
+  for (uint32_t lv = (uint32_t)0U; j != (uint32_t)0U; lv++)
+  {
+    if (j % (uint32_t)2U == (uint32_t)1U)
+    {
+      uint8_t *h = store_hash(st, hsz, lv, j - (uint32_t)1U);
+      if (actd)
+      {
+        hash_copy(hsz, acc, index___uint8_t_(rhs, lv));
+        hash_fun(h, acc, acc);
+      }
+      else
+      {
+        hash_copy(hsz, h, acc);
+      }
+      actd = true;
+    }
+    j = j / (uint32_t)2U;
+  }
+}
+
+/* Counterpart of mt_get_path_. */
+static void
+store_get_path(
+  MerkleTree_Low_hash_store *st,
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_vec rhs,
+  uint32_t j,
+  uint32_t k,
+  MerkleTree_Low_path *p
+)
+{
+  bool actd = false;
+  for (uint32_t lv = (uint32_t)0U; j != (uint32_t)0U; lv++)
+  {
+    uint8_t *h = NULL;
+    if (k % (uint32_t)2U == (uint32_t)1U)
+    {
+      h = store_hash(st, hsz, lv, k - (uint32_t)1U);
+    }
+    else if (!(k == j))
+    {
+      if (k + (uint32_t)1U == j)
+      {
+        if (actd)
+        {
+          h = index___uint8_t_(rhs, lv);
+        }
+      }
+      else
+      {
+        h = store_hash(st, hsz, lv, k + (uint32_t)1U);
+      }
+    }
+    if (h != NULL)
+    {
+      MerkleTree_Low_mt_path_insert(hsz, p, h);
+    }
+    if (j % (uint32_t)2U == (uint32_t)1U)
+    {
+      actd = true;
+    }
+    j = j / (uint32_t)2U;
+    k = k / (uint32_t)2U;
+  }
+}
+
+/* Counterpart of mt_flush_to_. */
+static void store_flush_to(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t pi, uint32_t i)
+{
+  for
+  (uint32_t lv = (uint32_t)0U;
+    !(MerkleTree_Low_offset_of(i) == MerkleTree_Low_offset_of(pi));
+    lv++)
+  {
+    store_level_drop(st, hsz, lv, MerkleTree_Low_offset_of(i));
+    pi = pi / (uint32_t)2U;
+    i = i / (uint32_t)2U;
+  }
+}
+
+/* Counterpart of mt_retract_to_. */
+static void store_retract_to(MerkleTree_Low_hash_store *st, uint32_t hsz, uint32_t s)
+{
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    store_level_shrink(st, hsz, lv, s >> lv);
+  }
+}
+
+/* A heap-style view of the levels (pointers into the mapping), for the
+   serializer. */
+static MerkleTree_Low_Datastructures_hash_vv store_view(MerkleTree_Low_merkle_tree mtv)
+{
+  MerkleTree_Low_Datastructures_hash_vv
+  hs =
+    alloc_rid__LowStar_Vector_vector_str__uint8_t_((uint32_t)32U,
+      ((MerkleTree_Low_Datastructures_hash_vec){ .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }));
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    uint32_t ofs = MerkleTree_Low_offset_of(mtv.i >> lv);
+    uint32_t n = (mtv.j >> lv) - ofs;
+    MerkleTree_Low_Datastructures_hash_vec v = alloc_rid___uint8_t_(n, NULL);
+    for (uint32_t k = (uint32_t)0U; k < n; k++)
+    {
+      v.vs[k] = store_hash(mtv.store, mtv.hash_size, lv, ofs + k);
+    }
+    assign__LowStar_Vector_vector_str__uint8_t_(hs, lv, v);
+  }
+  return hs;
+}
+
+static void store_view_free(MerkleTree_Low_Datastructures_hash_vv hs)
+{
+  for (uint32_t lv = (uint32_t)0U; lv < hs.sz; lv++)
+  {
+    free___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv));
+  }
+  free__LowStar_Vector_vector_str__uint8_t_(hs);
+}
+
+void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  if (mtv.store != NULL)
+  {
+    store_close(mtv.store, mtv.hash_size, mtv.offset, mtv.i, mtv.j);
+  }
+  free__LowStar_Vector_vector_str__uint8_t__uint32_t((
+      (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+        .state = mtv.hash_size,
+        .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
+        .r_alloc = hash_vec_r_alloc,
+        .r_free = hash_vec_r_free
+      }
+    ),
+    mtv.hs);
+  free___uint8_t__uint32_t((
+      (regional__uint32_t__uint8_t_){
+        .state = mtv.hash_size,
+        .dummy = NULL,
+        .r_alloc = hash_r_alloc,
+        .r_free = hash_r_free
+      }
+    ),
+    mtv.rhs);
+  regional__uint32_t__uint8_t_
+  x00 = { .state = mtv.hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
+  regional__uint32_t__uint8_t_
+  x0 = { .state = mtv.hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
+  x00.r_free(x0.state, mtv.mroot);
+  KRML_HOST_FREE(mt);
+}
+
+static MerkleTree_Low_Datastructures_hash_vec
+insert___uint8_t__uint32_t(MerkleTree_Low_Datastructures_hash_vec rv, uint8_t *v)
+{
+  MerkleTree_Low_Datastructures_hash_vec irv = insert___uint8_t_(rv, v);
+  return irv;
+}
+
+typedef void (*copyable__uint32_t__uint8_t_)(uint32_t x0, uint8_t *x1, uint8_t *x2);
+
+static MerkleTree_Low_Datastructures_hash_vec
+insert_copy___uint8_t__uint32_t(
+  regional__uint32_t__uint8_t_ rg,
+  void (*cp)(uint32_t x0, uint8_t *x1, uint8_t *x2),
+  MerkleTree_Low_Datastructures_hash_vec rv,
+  uint8_t *v
+)
+{
+  uint8_t *nv = rg.r_alloc(rg.state);
+  cp(rg.state, v, nv);
+  return insert___uint8_t__uint32_t(rv, nv);
+}
+
+static void
+assign__LowStar_Vector_vector_str__uint8_t__uint32_t(
+  MerkleTree_Low_Datastructures_hash_vv rv,
+  uint32_t i,
+  MerkleTree_Low_Datastructures_hash_vec v
+)
+{
+  assign__LowStar_Vector_vector_str__uint8_t_(rv, i, v);
+}
+
+static void
+insert_(
+  uint32_t hsz,
+  uint32_t lv,
+  uint32_t j,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  uint8_t *acc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_Datastructures_hash_vec
+  uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+  MerkleTree_Low_Datastructures_hash_vec
+  ihv =
+    insert_copy___uint8_t__uint32_t((
+        (regional__uint32_t__uint8_t_){
+          .state = hsz,
+          .dummy = NULL,
+          .r_alloc = hash_r_alloc,
+          .r_free = hash_r_free
+        }
+      ),
       hash_copy,
       uu____0,
       acc);
@@ -1053,12 +2115,167 @@ bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t
     && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)(mt1.j + (uint32_t)1U);
 }
 
-void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+bool MerkleTree_Low_mt_try_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  uint32_t hsz1 = mtv.hash_size;
+  if (mtv.store != NULL)
+  {
+    if (!store_insert_batch(mtv, v, (uint32_t)1U))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    insert_(hsz1, (uint32_t)0U, mtv.j, hs, v, mtv.hash_fun);
+  }
+  *mt
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = mtv.hash_size,
+        .offset = mtv.offset,
+        .i = mtv.i,
+        .j = mtv.j + (uint32_t)1U,
+        .hs = mtv.hs,
+        .rhs_ok = false,
+        .rhs = mtv.rhs,
+        .mroot = mtv.mroot,
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
+      }
+    );
+  return true;
+}
+
+void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+{
+  if (!MerkleTree_Low_mt_try_insert(mt, v))
+  {
+    KRML_HOST_EPRINTF("MerkleTree: cannot extend the memory-mapped storage\n");
+    KRML_HOST_EXIT(255U);
+  }
+}
+
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint8_t *vs,
+  uint32_t n
+)
+{
+  MerkleTree_Low_merkle_tree mt1 = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    n
+    <= MerkleTree_Low_uint32_32_max - mt1.j
+    && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)mt1.j + (uint64_t)n;
+}
+
+/* Level lv of the tree holds nodes [j0 >> lv, j1 >> lv) after appending
+   leaves [j0, j1); compute the new parents [j0 >> (lv + 1), j1 >> (lv + 1))
+   and append them to level lv + 1. */
+static void
+insert_batch_level(
+  uint32_t hsz,
+  uint32_t lv,
+  uint32_t j0,
+  uint32_t j1,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_Datastructures_hash_vec lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+  MerkleTree_Low_Datastructures_hash_vec
+  uvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv + (uint32_t)1U);
+  uint32_t base = (j1 >> lv) - lvhs.sz;
+  uint32_t p0 = j0 >> (lv + (uint32_t)1U);
+  uint32_t p1 = j1 >> (lv + (uint32_t)1U);
+  bool multi = hash_fun == mt_sha256_compress && hsz == (uint32_t)32U;
+  uint8_t blocks[4096U];
+  uint8_t *bs[64U];
+  uint8_t *ds[64U];
+  for (uint32_t c0 = p0; c0 < p1; c0 = c0 + (uint32_t)64U)
+  {
+    uint32_t m = p1 - c0;
+    if (m > (uint32_t)64U)
+    {
+      m = (uint32_t)64U;
+    }
+    for (uint32_t i = (uint32_t)0U; i < m; i++)
+    {
+      uint32_t p = c0 + i;
+      uint8_t *l = index___uint8_t_(lvhs, (uint32_t)2U * p - base);
+      uint8_t *r = index___uint8_t_(lvhs, (uint32_t)2U * p + (uint32_t)1U - base);
+      uint8_t *nv = hash_r_alloc(hsz);
+      if (multi)
+      {
+        memcpy(blocks + i * (uint32_t)64U, l, (uint32_t)32U * sizeof (uint8_t));
+        memcpy(blocks + i * (uint32_t)64U + (uint32_t)32U, r, (uint32_t)32U * sizeof (uint8_t));
+        bs[i] = blocks + i * (uint32_t)64U;
+      }
+      else
+      {
+        hash_fun(l, r, nv);
+      }
+      ds[i] = nv;
+      uvhs = insert___uint8_t__uint32_t(uvhs, nv);
+    }
+    if (multi)
+    {
+      mt_sha256_compress_multi(m, ds, bs);
+    }
+  }
+  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv + (uint32_t)1U, uvhs);
+}
+
+bool MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *vs, uint32_t n)
 {
   MerkleTree_Low_merkle_tree mtv = *mt;
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
   uint32_t hsz1 = mtv.hash_size;
-  insert_(hsz1, (uint32_t)0U, mtv.j, hs, v, mtv.hash_fun);
+  uint32_t j0 = mtv.j;
+  uint32_t j1 = mtv.j + n;
+  if (n == (uint32_t)0U)
+  {
+    return true;
+  }
+  if (mtv.store != NULL)
+  {
+    if (!store_insert_batch(mtv, vs, n))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    MerkleTree_Low_Datastructures_hash_vec lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U);
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      lvhs =
+        insert_copy___uint8_t__uint32_t((
+            (regional__uint32_t__uint8_t_){
+              .state = hsz1,
+              .dummy = NULL,
+              .r_alloc = hash_r_alloc,
+              .r_free = hash_r_free
+            }
+          ),
+          hash_copy,
+          lvhs,
+          vs + i * hsz1);
+    }
+    assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, (uint32_t)0U, lvhs);
+    /* Once a level gains no parent, no level above it does either. */
+    for
+    (uint32_t lv = (uint32_t)0U;
+      lv + (uint32_t)1U < hs.sz && j0 >> (lv + (uint32_t)1U) < j1 >> (lv + (uint32_t)1U);
+      lv++)
+    {
+      insert_batch_level(hsz1, lv, j0, j1, hs, mtv.hash_fun);
+    }
+  }
   *mt
   =
     (
@@ -1066,14 +2283,16 @@ void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
         .hash_size = mtv.hash_size,
         .offset = mtv.offset,
         .i = mtv.i,
-        .j = mtv.j + (uint32_t)1U,
+        .j = j1,
         .hs = mtv.hs,
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
+  return true;
 }
 
 MerkleTree_Low_merkle_tree
@@ -1088,6 +2307,119 @@ MerkleTree_Low_merkle_tree
   return mt;
 }
 
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_mmap(
+  const char *dir,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_hash_store *st = store_new(dir);
+  if
+  (
+    hsz
+    == (uint32_t)0U
+    || hsz > (uint32_t)64U
+    || sizeof (void *) < (size_t)8U
+    || store_exists(st)
+    || !store_level_grow(st, hsz, (uint32_t)0U, (uint32_t)1U)
+  )
+  {
+    store_free(st);
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  mt->store = st;
+  if (!MerkleTree_Low_mt_try_insert(mt, init) || !MerkleTree_Low_mt_sync(mt))
+  {
+    mt->store = NULL;
+    store_free(st);
+    MerkleTree_Low_mt_free(mt);
+    return NULL;
+  }
+  return mt;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_open_mmap(
+  const char *dir,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_hash_store *st = store_new(dir);
+  uint32_t hsz = (uint32_t)0U;
+  uint64_t offset = (uint64_t)0U;
+  uint32_t i = (uint32_t)0U;
+  uint32_t j = (uint32_t)0U;
+  bool ok =
+    store_read_meta(st, &hsz, &offset, &i, &j)
+    && hsz > (uint32_t)0U
+    && hsz <= (uint32_t)64U
+    && sizeof (void *) >= (size_t)8U
+    && i <= j
+    && MerkleTree_Low_uint64_max - offset >= (uint64_t)j;
+  for (uint32_t lv = (uint32_t)0U; ok && lv < (uint32_t)32U && j >> lv > (uint32_t)0U; lv++)
+  {
+    ok =
+      store_level_open(st, hsz, lv, false)
+      && st->levels[lv].mapped >= (uint64_t)(j >> lv) * (uint64_t)hsz;
+  }
+  if (!ok)
+  {
+    store_free(st);
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  mt->offset = offset;
+  mt->i = i;
+  mt->j = j;
+  mt->store = st;
+  return mt;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_arena(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_hash_store *st = store_new(NULL);
+  if
+  (
+    hsz
+    == (uint32_t)0U
+    || hsz > (uint32_t)64U
+    || sizeof (void *) < (size_t)8U
+    || !store_level_grow(st, hsz, (uint32_t)0U, (uint32_t)1U)
+  )
+  {
+    store_free(st);
+    return MerkleTree_Low_mt_create_custom(hsz, init, hash_fun);
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  mt->store = st;
+  if (!MerkleTree_Low_mt_try_insert(mt, init))
+  {
+    mt->store = NULL;
+    store_free(st);
+    MerkleTree_Low_mt_free(mt);
+    return NULL;
+  }
+  return mt;
+}
+
+bool MerkleTree_Low_mt_sync(MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  if (mtv.store == NULL)
+  {
+    return true;
+  }
+  return store_sync(mtv.store, mtv.hash_size, mtv.offset, mtv.i, mtv.j);
+}
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee)
 {
   return true;
@@ -1253,7 +2585,14 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
     hash_copy(hash_size, mroot, rt);
     return;
   }
-  construct_rhs(hash_size, (uint32_t)0U, hs, rhs, i, j, rt, false, hash_fun);
+  if (mtv.store != NULL)
+  {
+    store_construct_rhs(mtv.store, hash_size, rhs, j, rt, hash_fun);
+  }
+  else
+  {
+    construct_rhs(hash_size, (uint32_t)0U, hs, rhs, i, j, rt, false, hash_fun);
+  }
   hash_copy(hash_size, rt, mroot);
   *mt1
   =
@@ -1267,7 +2606,8 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
         .rhs_ok = true,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1449,15 +2789,29 @@ MerkleTree_Low_mt_get_path(
   uint32_t j = mtv.j;
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
   MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
-  uint8_t
-  *ih =
-    index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
-      idx1 - ofs);
+  uint8_t *ih;
+  if (mtv.store != NULL)
+  {
+    ih = store_hash(mtv.store, hsz1, (uint32_t)0U, idx1);
+  }
+  else
+  {
+    ih =
+      index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
+        idx1 - ofs);
+  }
   MerkleTree_Low_path pth = *p;
   MerkleTree_Low_Datastructures_hash_vec pv = pth.hashes;
   MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, ih);
   *p = ((MerkleTree_Low_path){ .hash_size = hsz1, .hashes = ipv });
-  mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, rhs, i, j, idx1, p, false);
+  if (mtv.store != NULL)
+  {
+    store_get_path(mtv.store, hsz1, rhs, j, idx1, p);
+  }
+  else
+  {
+    mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, rhs, i, j, idx1, p, false);
+  }
   return j;
 }
 
@@ -1548,7 +2902,14 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
   uint32_t hsz = mtv.hash_size;
   uint32_t idx1 = (uint32_t)(idx - offset);
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.i, idx1);
+  if (mtv.store != NULL)
+  {
+    store_flush_to(mtv.store, hsz, mtv.i, idx1);
+  }
+  else
+  {
+    mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.i, idx1);
+  }
   *mt
   =
     (
@@ -1561,7 +2922,8 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
         .rhs_ok = mtv.rhs_ok,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1682,7 +3044,14 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
   uint64_t offset = mtv.offset;
   uint32_t r1 = (uint32_t)(r - offset);
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  mt_retract_to_(mtv.hash_size, hs, (uint32_t)0U, mtv.i, r1 + (uint32_t)1U, mtv.j);
+  if (mtv.store != NULL)
+  {
+    store_retract_to(mtv.store, mtv.hash_size, r1 + (uint32_t)1U);
+  }
+  else
+  {
+    mt_retract_to_(mtv.hash_size, hs, (uint32_t)0U, mtv.i, r1 + (uint32_t)1U, mtv.j);
+  }
   *mt
   =
     (
@@ -1695,7 +3064,8 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1815,6 +3185,246 @@ MerkleTree_Low_mt_verify(
   return r;
 }
 
+/*
+  Multi-paths
+
+  A multi-path for the leaves k_0 < ... < k_(n-1) holds the n leaf hashes,
+  followed by the sibling hashes that cannot be computed from those leaves,
+  level by level from the bottom and from left to right within a level. Each
+  internal node that is shared by several of the leaves is thus sent (or
+  recomputed) once, instead of once per leaf.
+
+  As in mt_verify_, level lv of a tree of size j has the nodes [0, j >> lv),
+  plus the right-hand-side hash at position j >> lv when j mod 2^lv is not
+  zero; a node without a sibling is promoted unchanged.
+*/
+
+static bool mt_has_sibling(uint32_t k, uint32_t j, bool actd)
+{
+  return k % (uint32_t)2U == (uint32_t)1U || !(k == j || (k + (uint32_t)1U == j && !actd));
+}
+
+static uint8_t *mt_hash_at(MerkleTree_Low_merkle_tree mtv, uint32_t lv, uint32_t k)
+{
+  if (mtv.store != NULL)
+  {
+    return store_hash(mtv.store, mtv.hash_size, lv, k);
+  }
+  uint32_t ofs = MerkleTree_Low_offset_of(mtv.i >> lv);
+  return index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(mtv.hs, lv), k - ofs);
+}
+
+static void
+mt_get_paths_(MerkleTree_Low_merkle_tree mtv, uint32_t *ks, uint32_t n, MerkleTree_Low_path *p)
+{
+  uint32_t hsz = mtv.hash_size;
+  uint32_t j = mtv.j;
+  bool actd = false;
+  for (uint32_t lv = (uint32_t)0U; j != (uint32_t)0U; lv++)
+  {
+    uint32_t m = (uint32_t)0U;
+    for (uint32_t t = (uint32_t)0U; t < n; t++)
+    {
+      uint32_t k = ks[t];
+      if (k % (uint32_t)2U == (uint32_t)0U && t + (uint32_t)1U < n && ks[t + (uint32_t)1U] == k + (uint32_t)1U)
+      {
+        t++;
+      }
+      else if (k % (uint32_t)2U == (uint32_t)1U)
+      {
+        MerkleTree_Low_mt_path_insert(hsz, p, mt_hash_at(mtv, lv, k - (uint32_t)1U));
+      }
+      else if (mt_has_sibling(k, j, actd))
+      {
+        if (k + (uint32_t)1U == j)
+        {
+          MerkleTree_Low_mt_path_insert(hsz, p, index___uint8_t_(mtv.rhs, lv));
+        }
+        else
+        {
+          MerkleTree_Low_mt_path_insert(hsz, p, mt_hash_at(mtv, lv, k + (uint32_t)1U));
+        }
+      }
+      ks[m] = k / (uint32_t)2U;
+      m++;
+    }
+    n = m;
+    if (j % (uint32_t)2U == (uint32_t)1U)
+    {
+      actd = true;
+    }
+    j = j / (uint32_t)2U;
+  }
+}
+
+bool
+MerkleTree_Low_mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_path pv = *(MerkleTree_Low_path *)p;
+  bool ok = n > (uint32_t)0U && pv.hash_size == mtv.hash_size && pv.hashes.sz == (uint32_t)0U;
+  for (uint32_t t = (uint32_t)0U; ok && t < n; t++)
+  {
+    ok =
+      idx[t]
+      >= mtv.offset
+      && idx[t] - mtv.offset <= MerkleTree_Low_offset_range_limit
+      && mtv.i <= (uint32_t)(idx[t] - mtv.offset)
+      && (uint32_t)(idx[t] - mtv.offset) < mtv.j
+      && (t == (uint32_t)0U || idx[t - (uint32_t)1U] < idx[t]);
+  }
+  return ok;
+}
+
+uint32_t
+MerkleTree_Low_mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  MerkleTree_Low_mt_get_root(mt, root);
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  KRML_CHECK_SIZE(sizeof (uint32_t), n);
+  uint32_t *ks = KRML_HOST_MALLOC(sizeof (uint32_t) * n);
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    ks[t] = (uint32_t)(idx[t] - mtv.offset);
+    MerkleTree_Low_mt_path_insert(mtv.hash_size, p, mt_hash_at(mtv, (uint32_t)0U, ks[t]));
+  }
+  mt_get_paths_(mtv, ks, n, p);
+  KRML_HOST_FREE(ks);
+  return mtv.j;
+}
+
+bool
+MerkleTree_Low_mt_verify_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_path pv = *(MerkleTree_Low_path *)p;
+  bool
+  ok =
+    n
+    > (uint32_t)0U
+    && j >= mtv.offset && j - mtv.offset <= MerkleTree_Low_offset_range_limit
+    && pv.hash_size == mtv.hash_size
+    && pv.hashes.sz >= n;
+  for (uint32_t t = (uint32_t)0U; ok && t < n; t++)
+  {
+    ok =
+      idx[t]
+      >= mtv.offset
+      && idx[t] < j
+      && (t == (uint32_t)0U || idx[t - (uint32_t)1U] < idx[t]);
+  }
+  return ok;
+}
+
+bool
+MerkleTree_Low_mt_verify_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_path pv = *(MerkleTree_Low_path *)p;
+  uint32_t hsz = mtv.hash_size;
+  uint32_t j1 = (uint32_t)(j - mtv.offset);
+  /* n * hsz must not wrap around: it sizes vals and bounds every offset into
+     it. */
+  if (n == (uint32_t)0U || pv.hashes.sz < n || hsz == (uint32_t)0U || n > MerkleTree_Low_uint32_32_max / hsz)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), n);
+  uint32_t *ks = KRML_HOST_MALLOC(sizeof (uint32_t) * n);
+  KRML_CHECK_SIZE(sizeof (uint8_t), n * hsz);
+  uint8_t *vals = KRML_HOST_MALLOC(sizeof (uint8_t) * n * hsz);
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    ks[t] = (uint32_t)(idx[t] - mtv.offset);
+    hash_copy(hsz, index___uint8_t_(pv.hashes, t), vals + t * hsz);
+  }
+  /* Nodes are computed in place: the t-th known node of a level becomes the
+     m-th known node of the next one, with m <= t. */
+  uint32_t ppos = n;
+  bool ok = true;
+  bool actd = false;
+  for (uint32_t lv = (uint32_t)0U; ok && j1 != (uint32_t)0U; lv++)
+  {
+    uint32_t m = (uint32_t)0U;
+    for (uint32_t t = (uint32_t)0U; ok && t < n; t++)
+    {
+      uint32_t k = ks[t];
+      uint8_t *acc = vals + t * hsz;
+      uint8_t *dst = vals + m * hsz;
+      if (k % (uint32_t)2U == (uint32_t)0U && t + (uint32_t)1U < n && ks[t + (uint32_t)1U] == k + (uint32_t)1U)
+      {
+        mtv.hash_fun(acc, acc + hsz, dst);
+        t++;
+      }
+      else if (mt_has_sibling(k, j1, actd))
+      {
+        if (ppos >= pv.hashes.sz)
+        {
+          ok = false;
+        }
+        else if (k % (uint32_t)2U == (uint32_t)1U)
+        {
+          mtv.hash_fun(index___uint8_t_(pv.hashes, ppos), acc, dst);
+          ppos++;
+        }
+        else
+        {
+          mtv.hash_fun(acc, index___uint8_t_(pv.hashes, ppos), dst);
+          ppos++;
+        }
+      }
+      else if (dst != acc)
+      {
+        hash_copy(hsz, acc, dst);
+      }
+      ks[m] = k / (uint32_t)2U;
+      m++;
+    }
+    n = m;
+    if (j1 % (uint32_t)2U == (uint32_t)1U)
+    {
+      actd = true;
+    }
+    j1 = j1 / (uint32_t)2U;
+  }
+  ok = ok && n == (uint32_t)1U && ppos == pv.hashes.sz;
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < hsz; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(vals[i], rt[i]);
+    res = uu____0 & res;
+  }
+  KRML_HOST_FREE(ks);
+  KRML_HOST_FREE(vals);
+  return ok && res == (uint8_t)255U;
+}
+
 typedef struct __bool_uint32_t_s
 {
   bool fst;
@@ -2468,7 +4078,15 @@ uint64_t MerkleTree_Low_Serialization_mt_serialize_size(const MerkleTree_Low_mer
   MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
   MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
+  if (mtv.store != NULL)
+  {
+    hs = store_view(mtv);
+  }
   uint64_t hs_sz = hash_vv_bytes_i(mtv.hash_size, hs, (uint32_t)0U);
+  if (mtv.store != NULL)
+  {
+    store_view_free(hs);
+  }
   if (hs_sz < (uint64_t)4294967295U)
   {
     uint64_t vs_hs = (uint64_t)rhs.sz * (uint64_t)mtv.hash_size;
@@ -2511,7 +4129,16 @@ MerkleTree_Low_Serialization_mt_serialize(
   __bool_uint32_t scrut3 = serialize_uint32_t(ok3, mtv.j, output, sz1, pos3);
   bool ok4 = scrut3.fst;
   uint32_t pos4 = scrut3.snd;
-  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, output, sz1, pos4);
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  if (mtv.store != NULL)
+  {
+    hs = store_view(mtv);
+  }
+  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, hs, output, sz1, pos4);
+  if (mtv.store != NULL)
+  {
+    store_view_free(hs);
+  }
   bool ok5 = scrut4.fst;
   uint32_t pos5 = scrut4.snd;
   __bool_uint32_t scrut5 = serialize_bool(ok5, mtv.rhs_ok, output, sz1, pos5);
@@ -2607,7 +4234,8 @@ MerkleTree_Low_merkle_tree
         .rhs_ok = rhs_ok,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = NULL
       }
     );
   return buf;
@@ -2664,6 +4292,84 @@ MerkleTree_Low_path
   return buf;
 }
 
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_paths(
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *output,
+  uint64_t sz
+)
+{
+  MerkleTree_Low_path pv = *(MerkleTree_Low_path *)p;
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t scrut = serialize_uint32_t(true, pv.hash_size, output, sz1, (uint32_t)0U);
+  __bool_uint32_t scrut0 = serialize_uint64_t(scrut.fst, j, output, sz1, scrut.snd);
+  __bool_uint32_t scrut1 = serialize_uint32_t(scrut0.fst, n, output, sz1, scrut0.snd);
+  /* Leaf indices are stored relative to the tree size, which fits 32 bits. */
+  bool ok = scrut1.fst;
+  uint32_t pos = scrut1.snd;
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    __bool_uint32_t scrut2 = serialize_uint32_t(ok, (uint32_t)(j - idx[t]), output, sz1, pos);
+    ok = scrut2.fst;
+    pos = scrut2.snd;
+  }
+  __bool_uint32_t scrut3 = serialize_hash_vec(pv.hash_size, ok, pv.hashes, output, sz1, pos);
+  if (scrut3.fst)
+  {
+    return (uint64_t)scrut3.snd;
+  }
+  return (uint64_t)0U;
+}
+
+MerkleTree_Low_path
+*MerkleTree_Low_Serialization_mt_deserialize_paths(
+  const uint8_t *input,
+  uint64_t sz,
+  uint64_t *idx,
+  uint32_t idx_len,
+  uint32_t *n,
+  uint64_t *j
+)
+{
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t_uint32_t scrut = deserialize_uint32_t(true, input, sz1, (uint32_t)0U);
+  uint32_t hash_size = scrut.thd;
+  __bool_uint32_t_uint64_t scrut0 = deserialize_uint64_t(scrut.fst, input, sz1, scrut.snd);
+  uint64_t max = scrut0.thd;
+  __bool_uint32_t_uint32_t scrut1 = deserialize_uint32_t(scrut0.fst, input, sz1, scrut0.snd);
+  uint32_t cnt = scrut1.thd;
+  bool ok = scrut1.fst && hash_size != (uint32_t)0U && cnt <= idx_len;
+  uint32_t pos = scrut1.snd;
+  for (uint32_t t = (uint32_t)0U; ok && t < cnt; t++)
+  {
+    __bool_uint32_t_uint32_t scrut2 = deserialize_uint32_t(ok, input, sz1, pos);
+    /* A relative index of 0 would be the leaf max itself, which is not in the
+       tree. */
+    ok = scrut2.fst && scrut2.thd != (uint32_t)0U && (uint64_t)scrut2.thd <= max;
+    pos = scrut2.snd;
+    idx[t] = max - (uint64_t)scrut2.thd;
+  }
+  if (!ok)
+  {
+    return NULL;
+  }
+  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
+  scrut3 = deserialize_hash_vec(hash_size, ok, input, sz1, pos);
+  if (!scrut3.fst)
+  {
+    return NULL;
+  }
+  *n = cnt;
+  *j = max;
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_path), (uint32_t)1U);
+  MerkleTree_Low_path *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_path));
+  buf[0U] = ((MerkleTree_Low_path){ .hash_size = hash_size, .hashes = scrut3.thd });
+  return buf;
+}
+
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz)
 {
   regional__uint32_t__uint8_t_
@@ -76,6 +76,8 @@ typedef struct MerkleTree_Low_Datastructures_hash_vv_s
 }
 MerkleTree_Low_Datastructures_hash_vv;
 
+typedef struct MerkleTree_Low_hash_store_s MerkleTree_Low_hash_store;
+
 typedef struct MerkleTree_Low_merkle_tree_s
 {
   uint32_t hash_size;
@@ -87,6 +89,7 @@ typedef struct MerkleTree_Low_merkle_tree_s
   MerkleTree_Low_Datastructures_hash_vec rhs;
   uint8_t *mroot;
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  MerkleTree_Low_hash_store *store;
 }
 MerkleTree_Low_merkle_tree;
 
@@ -177,6 +180,8 @@ void mt_free(MerkleTree_Low_merkle_tree *mt);
   @param[in]  v   The tree does not take ownership of the hash, it makes a copy of its content.
 
  Note: The content of the hash will be overwritten with an arbitrary value.
+ A memory-mapped tree that cannot extend its storage exits the process; use
+ mt_try_insert to handle this case.
 */
 void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
@@ -185,6 +190,40 @@ void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 */
 bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+/*
+  Insertion that reports storage failures
+
+  @param[in]  mt  The Merkle tree
+  @param[in]  v   As for mt_insert; its content is overwritten.
+
+  return true, or false if a memory-mapped tree cannot extend its storage, in
+  which case the tree is left unchanged
+
+ The precondition is that of mt_insert.
+*/
+bool mt_try_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+
+/*
+  Batch insertion
+
+  @param[in]  mt  The Merkle tree
+  @param[in]  vs  The n hashes to insert, stored contiguously (n * hash_size bytes).
+  @param[in]  n   The number of hashes
+
+ Equivalent to n calls to mt_insert, but each level of the tree is built in a
+ single pass; with the default hash function, sibling pairs are compressed
+ several at a time. The content of vs is left untouched.
+
+  return true, or false if a memory-mapped tree cannot extend its storage, in
+  which case the tree is left unchanged
+*/
+bool mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *vs, uint32_t n);
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *vs, uint32_t n);
+
 /*
   Getting the Merkle root
 
@@ -233,6 +272,44 @@ mt_get_path_pre(
   uint8_t *root
 );
 
+/*
+  Getting the Merkle paths of several leaves at once (a multi-path)
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The indices of the target hashes, in strictly increasing order
+  @param[in]  n    The number of indices
+  @param[out] path A resulting multi-path: the n leaf hashes, followed by the
+                   sibling hashes needed to recompute the root from all of them.
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - Hashes that are shared by the paths of several leaves are included once.
+  - As with mt_get_path, the resulting path points to hashes in the tree, and
+    the indices must be within the currently held indices in the tree.
+*/
+uint32_t
+mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_get_paths
+*/
+bool
+mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
 /*
   Flush the Merkle tree
 
@@ -307,6 +384,44 @@ mt_verify_pre(
   uint8_t *root
 );
 
+/*
+  Client-side verification of a multi-path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The indices of the target hashes, in strictly increasing order
+  @param[in]  n    The number of indices
+  @param[in]  max  The maximum index + 1 of the tree when the path was generated
+  @param[in]  path The multi-path to verify, as returned by mt_get_paths
+  @param[in]  root
+
+  return true if the verification succeeded for all the leaves, false otherwise
+
+  Note: each internal node is recomputed once, however many of the leaves
+  lie below it.
+*/
+bool
+mt_verify_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_verify_paths
+*/
+bool
+mt_verify_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
 /*
   Serialization size
 
@@ -372,6 +487,54 @@ uint64_t mt_serialize_path(const MerkleTree_Low_path *path1, uint8_t *buf, uint6
 */
 MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len);
 
+/*
+  Multi-path serialization, together with the leaf indices and tree size it
+  is valid for
+
+  @param[in]  idx  The indices of the target hashes
+  @param[in]  n    The number of indices
+  @param[in]  max  The maximum index + 1 of the tree when the path was generated
+  @param[in]  path The multi-path
+  @param[out] buf  The buffer to serialize the multi-path into
+  @param[in]  len  Length of buf
+
+  return the number of bytes written, 0 if buf is too small
+
+  Note: this takes 20 + 4 * n + hash_size * (number of hashes in path) bytes.
+*/
+uint64_t
+mt_serialize_paths(
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *buf,
+  uint64_t len
+);
+
+/*
+  Multi-path deserialization
+
+  @param[in]  buf     The buffer to deserialize the multi-path from
+  @param[in]  len     Length of buf
+  @param[out] idx     The indices of the target hashes
+  @param[in]  idx_len The number of entries available in idx
+  @param[out] n       The number of indices
+  @param[out] max     The maximum index + 1 of the tree the path is valid for
+
+  return pointer to the new path if successful, NULL otherwise (including
+  when the multi-path covers more than idx_len leaves)
+*/
+MerkleTree_Low_path
+*mt_deserialize_paths(
+  const uint8_t *buf,
+  uint64_t len,
+  uint64_t *idx,
+  uint32_t idx_len,
+  uint32_t *n,
+  uint64_t *max
+);
+
 typedef MerkleTree_Low_merkle_tree *mt_p0;
 
 /*
@@ -386,6 +549,97 @@ void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
 */
 MerkleTree_Low_merkle_tree *mt_create(uint8_t *init);
 
+/*
+  Construction of a tree whose levels live in memory-mapped files in an
+  existing directory, wired to sha256 from EverCrypt
+
+  Level lv is kept in <dir>/level.<lv> and the bounds of the tree in <dir>/meta.
+  The files are extended with their blocks allocated, so running out of disk
+  space makes mt_try_insert and mt_insert_batch return false. Flushed hashes are
+  punched out of the files (where the system supports it) and retracted ones
+  truncated by the next mt_sync, once the new <dir>/meta is on disk, so the tree
+  can grow beyond the available memory. Only available on POSIX systems with a
+  64-bit address space.
+
+  @param[in]  dir    The directory; it must not already hold a tree
+  @param[in]  init   The initial hash
+
+  return The new Merkle tree, or NULL if the storage cannot be created
+*/
+MerkleTree_Low_merkle_tree *mt_create_mmap(const char *dir, uint8_t *init);
+
+/*
+  Custom construction of a memory-mapped tree
+
+  @param[in]  dir       The directory; it must not already hold a tree
+  @param[in]  hash_size Hash size (in bytes), at most 64
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the storage cannot be created
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_mmap_custom(
+  const char *dir,
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/*
+  Construction wired to sha256 from EverCrypt, keeping each level in one
+  contiguous array indexed by position instead of a vector of separately
+  allocated hashes. Inserting and extracting paths is faster and the tree
+  takes less memory; in exchange, the tree reserves virtual address space for
+  its largest possible size (2^32 leaves), about 2 * 2^32 * hash_size bytes:
+  256 GiB per sha256 tree. Only the pages holding hashes are backed by memory,
+  but the number of arena trees a process can hold at once is bounded by its
+  address space. Falls back to mt_create on systems without mmap or with a
+  32-bit address space.
+
+  @param[in]  init   The initial hash
+
+  return The new Merkle tree, or NULL if the initial hash cannot be stored
+*/
+MerkleTree_Low_merkle_tree *mt_create_arena(uint8_t *init);
+
+/*
+  Custom construction keeping each level in one contiguous array (see
+  mt_create_arena); hash sizes above 64 bytes fall back to mt_create_custom
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the initial hash cannot be stored
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_arena_custom(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/*
+  Reopen a memory-mapped tree in the state of its last mt_sync (mt_free syncs
+  implicitly)
+
+  @param[in]  dir       The directory
+  @param[in]  hash_fun  The hash function the tree was built with
+
+  return The Merkle tree, or NULL if the directory does not hold a valid tree
+*/
+MerkleTree_Low_merkle_tree
+*mt_open_mmap(const char *dir, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2));
+
+/*
+  Make the current state of a memory-mapped tree durable, then release the
+  storage of the hashes it no longer holds; a no-op on trees held in memory
+
+  @param[in]  mt   The Merkle tree
+
+  return true on success
+*/
+bool mt_sync(MerkleTree_Low_merkle_tree *mt);
+
 typedef uint32_t MerkleTree_Low_index_t;
 
 extern uint32_t MerkleTree_Low_uint32_32_max;
@@ -450,6 +704,17 @@ bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t
 
 void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+bool MerkleTree_Low_mt_try_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint8_t *vs,
+  uint32_t n
+);
+
+bool MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *vs, uint32_t n);
+
 MerkleTree_Low_merkle_tree
 *MerkleTree_Low_mt_create_custom(
   uint32_t hsz,
@@ -457,6 +722,29 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 );
 
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_mmap(
+  const char *dir,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_open_mmap(
+  const char *dir,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_arena(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+bool MerkleTree_Low_mt_sync(MerkleTree_Low_merkle_tree *mt);
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee);
 
 uint32_t MerkleTree_Low___proj__Path__item__hash_size(MerkleTree_Low_path projectee);
@@ -532,6 +820,44 @@ MerkleTree_Low_mt_verify(
   uint8_t *rt
 );
 
+bool
+MerkleTree_Low_mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+uint32_t
+MerkleTree_Low_mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+bool
+MerkleTree_Low_mt_verify_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+);
+
+bool
+MerkleTree_Low_mt_verify_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+);
+
 typedef uint8_t MerkleTree_Low_Serialization_uint8_t;
 
 typedef uint16_t MerkleTree_Low_Serialization_uint16_t;
@@ -570,6 +896,26 @@ MerkleTree_Low_Serialization_mt_serialize_path(
 MerkleTree_Low_path
 *MerkleTree_Low_Serialization_mt_deserialize_path(const uint8_t *input, uint64_t sz);
 
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_paths(
+  const uint64_t *idx,
+  uint32_t n,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *output,
+  uint64_t sz
+);
+
+MerkleTree_Low_path
+*MerkleTree_Low_Serialization_mt_deserialize_paths(
+  const uint8_t *input,
+  uint64_t sz,
+  uint64_t *idx,
+  uint32_t idx_len,
+  uint32_t *n,
+  uint64_t *j
+);
+
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz);
 
 void MerkleTree_Low_Hashfunctions_free_hash(uint8_t *h);
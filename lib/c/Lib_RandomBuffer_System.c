@@ -1,4 +1,10 @@
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
 #include "Lib_RandomBuffer_System.h"
+#include "Hacl_Chacha20.h"
+#include "Lib_Memzero0.h"
 
 #if (defined(_WIN32) || defined(_WIN64))
 
@@ -7,6 +13,8 @@
 #include <malloc.h>
 #include <windows.h>
 
+#define RANDOM_THREAD_LOCAL __declspec(thread)
+
 bool read_random_bytes(uint32_t len, uint8_t *buf) {
   HCRYPTPROV ctxt;
   if (!(CryptAcquireContext(&ctxt, NULL, NULL, PROV_RSA_FULL,
@@ -24,14 +32,24 @@ bool read_random_bytes(uint32_t len, uint8_t *buf) {
   return pass;
 }
 
+/* No fork on Windows: the pool never needs to be invalidated. */
+static void register_fork_handler(void) {}
+
 #else
 
 /* assume POSIX here */
 #include <fcntl.h>
+#include <pthread.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#define RANDOM_THREAD_LOCAL _Thread_local
 
 bool read_random_bytes(uint32_t len, uint8_t *buf) {
 #ifdef SYS_getrandom
@@ -50,13 +68,183 @@ bool read_random_bytes(uint32_t len, uint8_t *buf) {
   return ((size_t)res == (size_t)len);
 }
 
+static volatile uint32_t fork_generation = 0;
+
+static void on_fork_child(void) {
+  fork_generation++;
+}
+
+static pthread_once_t fork_handler_once = PTHREAD_ONCE_INIT;
+
+#if defined(MADV_WIPEONFORK)
+#define POOL_WIPEONFORK
+static pthread_key_t pool_key;
+static bool pool_key_ok = false;
+static void pool_page_free(void *page);
 #endif
 
+static void install_fork_handler(void) {
+  pthread_atfork(NULL, NULL, on_fork_child);
+#ifdef POOL_WIPEONFORK
+  pool_key_ok = pthread_key_create(&pool_key, pool_page_free) == 0;
+#endif
+}
+
+static void register_fork_handler(void) {
+  pthread_once(&fork_handler_once, install_fork_handler);
+}
+
+#endif
+
+/* Buffered mode (opt-in, see Lib_RandomBuffer_System_set_buffered).
+ *
+ * Each thread owns a ChaCha20 key seeded from the OS. A refill produces
+ * POOL_LEN bytes of keystream; the first 32 bytes immediately replace the key
+ * and the rest is handed out and wiped as it is consumed, so a later
+ * compromise of the pool reveals nothing already returned. The key is reseeded
+ * from the OS after RESEED_BYTES bytes and in a child after fork. Requests
+ * larger than DIRECT_LEN go to the OS directly, where the syscall is already
+ * amortized.
+ *
+ * pthread_atfork handlers do not run in children created with a raw clone() or
+ * fork syscall, so the pool does not rely on them alone. Where the system
+ * supports MADV_WIPEONFORK, each thread's pool lives in its own page that the
+ * kernel zeroes in any child, which then reseeds; elsewhere, the pool records
+ * the pid it was seeded in and is discarded when getpid() no longer matches. */
+
+#define POOL_LEN 512U
+#define DIRECT_LEN 256U
+#define RESEED_BYTES (1U << 20)
+
+typedef struct {
+  uint8_t key[32];
+  uint8_t buf[POOL_LEN];
+  uint32_t avail;
+  uint32_t served;
+  uint32_t fork_generation;
+  uint64_t pid;
+  bool seeded;
+} random_pool;
+
+static volatile bool buffered = false;
+
+static RANDOM_THREAD_LOCAL random_pool pool;
+
+#ifdef POOL_WIPEONFORK
+
+static RANDOM_THREAD_LOCAL random_pool *pool_page = NULL;
+static RANDOM_THREAD_LOCAL bool pool_page_failed = false;
+
+static void pool_page_free(void *page) {
+  Lib_Memzero0_memzero(page, sizeof (random_pool));
+  munmap(page, sizeof (random_pool));
+}
+
+/* The wipe-on-fork pool of the calling thread, or NULL if it cannot have one
+   (old kernel, or out of memory), in which case the thread uses pool. */
+static random_pool *pool_get(void) {
+  if (pool_page == NULL && !pool_page_failed) {
+    void *page = MAP_FAILED;
+    if (pool_key_ok) {
+      page = mmap(NULL, sizeof (random_pool), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    if (page != MAP_FAILED &&
+        (madvise(page, sizeof (random_pool), MADV_WIPEONFORK) != 0 ||
+         pthread_setspecific(pool_key, page) != 0)) {
+      munmap(page, sizeof (random_pool));
+      page = MAP_FAILED;
+    }
+    if (page == MAP_FAILED) {
+      pool_page_failed = true;
+    } else {
+      pool_page = (random_pool *)page;
+    }
+  }
+  return pool_page;
+}
+
+#endif
+
+static const uint8_t pool_zeroes[POOL_LEN] = { 0 };
+
+static bool pool_refill(random_pool *p) {
+#if !(defined(_WIN32) || defined(_WIN64))
+  uint32_t gen = fork_generation;
+#else
+  uint32_t gen = 0;
+#endif
+  if (!p->seeded || p->served >= RESEED_BYTES || p->fork_generation != gen) {
+    if (!read_random_bytes(32U, p->key)) {
+      return false;
+    }
+    p->seeded = true;
+    p->served = 0;
+    p->fork_generation = gen;
+#if !(defined(_WIN32) || defined(_WIN64))
+    p->pid = (uint64_t)getpid();
+#endif
+  }
+  uint8_t nonce[12U] = { 0 };
+  Hacl_Chacha20_chacha20_encrypt(POOL_LEN, p->buf, (uint8_t *)pool_zeroes, p->key, nonce, 0U);
+  memcpy(p->key, p->buf, 32U);
+  memset(p->buf, 0, 32U);
+  p->avail = POOL_LEN - 32U;
+  return true;
+}
+
+static bool pool_read(uint32_t len, uint8_t *x) {
+  random_pool *p = &pool;
+#if !(defined(_WIN32) || defined(_WIN64))
+  bool check_pid = true;
+#ifdef POOL_WIPEONFORK
+  random_pool *w = pool_get();
+  if (w != NULL) {
+    p = w;
+    check_pid = false;
+  }
+#endif
+  if (p->seeded &&
+      (p->fork_generation != fork_generation || (check_pid && p->pid != (uint64_t)getpid()))) {
+    Lib_Memzero0_memzero(p->buf, POOL_LEN);
+    p->avail = 0;
+    p->seeded = false;
+  }
+#endif
+  while (len > 0) {
+    if (p->avail == 0 && !pool_refill(p)) {
+      return false;
+    }
+    uint32_t n = len < p->avail ? len : p->avail;
+    uint8_t *src = p->buf + POOL_LEN - p->avail;
+    memcpy(x, src, n);
+    Lib_Memzero0_memzero(src, n);
+    p->avail -= n;
+    p->served += n;
+    x += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool random_bytes(uint32_t len, uint8_t *x) {
+  if (buffered && len <= DIRECT_LEN) {
+    return pool_read(len, x);
+  }
+  return read_random_bytes(len, x);
+}
+
+void Lib_RandomBuffer_System_set_buffered(bool enable) {
+  if (enable) {
+    register_fork_handler();
+  }
+  buffered = enable;
+}
+
 // WARNING: this function is deprecated
 bool Lib_RandomBuffer_System_randombytes(uint8_t *x, uint32_t len) {
-  return read_random_bytes(len, x);
+  return random_bytes(len, x);
 }
 
 void Lib_RandomBuffer_System_crypto_random(uint8_t *x, uint32_t len) {
-    while(!read_random_bytes(len, x)) {}
+    while(!random_bytes(len, x)) {}
 }
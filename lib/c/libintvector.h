@@ -338,6 +338,9 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 #define Lib_IntVector_Intrinsics_vec256_rotate_right_lanes64(x0, x1)	\
   (_mm256_permute4x64_epi64(x0, _MM_SHUFFLE((x1+3)%4,(x1+2)%4,(x1+1)%4,x1%4)))
 
+#define Lib_IntVector_Intrinsics_vec256_load16_le(x0) \
+  (_mm256_loadu_si256((__m256i*)(x0)))
+
 #define Lib_IntVector_Intrinsics_vec256_load32_le(x0) \
   (_mm256_loadu_si256((__m256i*)(x0)))
 
@@ -351,6 +354,9 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
   (_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)(x0)), _mm256_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7)))
 
 
+#define Lib_IntVector_Intrinsics_vec256_store16_le(x0, x1) \
+  (_mm256_storeu_si256((__m256i*)(x0), x1))
+
 #define Lib_IntVector_Intrinsics_vec256_store32_le(x0, x1) \
   (_mm256_storeu_si256((__m256i*)(x0), x1))
 
@@ -410,6 +416,15 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 #define Lib_IntVector_Intrinsics_vec256_smul32(x0, x1) \
   (_mm256_mullo_epi32(x0, _mm256_set1_epi32(x1)))
 
+#define Lib_IntVector_Intrinsics_vec256_add16(x0, x1) \
+  (_mm256_add_epi16(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_mul16(x0, x1) \
+  (_mm256_mullo_epi16(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_hadd16(x0, x1) \
+  (_mm256_hadd_epi16(x0, x1))
+
 
 #define Lib_IntVector_Intrinsics_vec256_load64(x1) \
   (_mm256_set1_epi64x(x1)) /* hi lo */
@@ -417,6 +432,9 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 #define Lib_IntVector_Intrinsics_vec256_load64s(x0, x1, x2, x3) \
   (_mm256_set_epi64x(x3,x2,x1,x0)) /* hi lo */
 
+#define Lib_IntVector_Intrinsics_vec256_load16(x) \
+  (_mm256_set1_epi16(x))
+
 #define Lib_IntVector_Intrinsics_vec256_load32(x) \
   (_mm256_set1_epi32(x))
 
@@ -447,6 +465,146 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 #define Lib_IntVector_Intrinsics_vec256_interleave_high128(x1, x2) \
   (_mm256_permute2x128_si256(x1, x2, 0x31))
 
+#define Lib_IntVector_Intrinsics_vec256_extract128(x0, x1) \
+  (_mm256_extracti128_si256(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec256_byteswap128(x0) \
+  (_mm256_shuffle_epi8(x0, _mm256_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)))
+
+// The following functions are only available on machines that support VAES and VPCLMULQDQ.
+// They operate on each 128-bit lane independently.
+
+#define Lib_IntVector_Intrinsics_ni_aes_enc256(x0, x1) \
+  (_mm256_aesenc_epi128(x0, x1))
+
+#define Lib_IntVector_Intrinsics_ni_aes_enc_last256(x0, x1) \
+  (_mm256_aesenclast_epi128(x0, x1))
+
+#define Lib_IntVector_Intrinsics_ni_clmul256(x0, x1, x2) \
+  (_mm256_clmulepi64_epi128(x0, x1, x2))
+
+// The following functions are only available on machines that support Intel AVX512F.
+// Only the operations needed by the 512-bit ChaCha20, Poly1305 and multi-buffer
+// SHA2 are provided.
+
+typedef __m512i Lib_IntVector_Intrinsics_vec512;
+
+#define Lib_IntVector_Intrinsics_vec512_xor(x0, x1) \
+  (_mm512_xor_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_or(x0, x1) \
+  (_mm512_or_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_and(x0, x1) \
+  (_mm512_and_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_lognot(x0) \
+  (_mm512_xor_si512(x0, _mm512_set1_epi32(-1)))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left64(x0, x1) \
+  (_mm512_slli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right64(x0, x1) \
+  (_mm512_srli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left32(x0, x1) \
+  (_mm512_slli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right32(x0, x1) \
+  (_mm512_srli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left32(x0, x1) \
+  (_mm512_rol_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right32(x0, x1) \
+  (_mm512_ror_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right64(x0, x1) \
+  (_mm512_ror_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_extract64(x0, x1) \
+  ((uint64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(_mm512_alignr_epi64(x0, x0, x1))))
+
+#define Lib_IntVector_Intrinsics_vec512_zero  \
+  (_mm512_setzero_si512())
+
+#define Lib_IntVector_Intrinsics_vec512_add64(x0, x1) \
+  (_mm512_add_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub64(x0, x1) \
+  (_mm512_sub_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_mul64(x0, x1) \
+  (_mm512_mul_epu32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_smul64(x0, x1) \
+  (_mm512_mul_epu32(x0, _mm512_set1_epi64(x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_add32(x0, x1) \
+  (_mm512_add_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub32(x0, x1) \
+  (_mm512_sub_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_load64(x1) \
+  (_mm512_set1_epi64(x1)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load64s(x0, x1, x2, x3, x4, x5, x6, x7) \
+  (_mm512_set_epi64(x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load32(x) \
+  (_mm512_set1_epi32(x))
+
+#define Lib_IntVector_Intrinsics_vec512_load32s(x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) \
+  (_mm512_set_epi32(x15, x14, x13, x12, x11, x10, x9, x8, x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load32_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_load64_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+// AVX512F has no byte shuffle, so the big-endian loads swap each 256-bit half.
+#define Lib_IntVector_Intrinsics_vec512_load32_be(x0) \
+  (_mm512_inserti64x4(_mm512_castsi256_si512(Lib_IntVector_Intrinsics_vec256_load32_be(x0)), \
+    Lib_IntVector_Intrinsics_vec256_load32_be((uint8_t *)(x0) + 32), 1))
+
+#define Lib_IntVector_Intrinsics_vec512_load64_be(x0) \
+  (_mm512_inserti64x4(_mm512_castsi256_si512(Lib_IntVector_Intrinsics_vec256_load64_be(x0)), \
+    Lib_IntVector_Intrinsics_vec256_load64_be((uint8_t *)(x0) + 32), 1))
+
+#define Lib_IntVector_Intrinsics_vec512_store32_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_store64_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low32(x1, x2) \
+  (_mm512_unpacklo_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high32(x1, x2) \
+  (_mm512_unpackhi_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low64(x1, x2) \
+  (_mm512_unpacklo_epi64(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high64(x1, x2) \
+  (_mm512_unpackhi_epi64(x1, x2))
+
+// The 128-bit interleavings work within each 256-bit half, like their
+// 32-bit and 64-bit counterparts do within each 128-bit lane.
+#define Lib_IntVector_Intrinsics_vec512_interleave_low128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0x44))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0xee))
+
 
 #elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)) \
       && !defined(__ARM_32BIT_STATE)
@@ -11,17 +11,36 @@
 
 #include "kremlib.h"
 #include "EverCrypt.h"
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#if EVERCRYPT_CAN_COMPILE_VALE
+#include "Vale.h"
+#include "Hacl_AES_GCM_NI.h"
+#endif
+#include "Lib_Memzero0.h"
 #include "quic_provider.h"
 
+// The AEAD state holds the expanded key (and, for AES-GCM, the GHASH
+// table), so nothing is recomputed per packet. The nonce of packet sn
+// is static_iv[0..4] || BE64(iv_lo ^ sn). When EverCrypt_AEAD has no
+// AES-GCM implementation for this CPU, st is NULL and the raw key goes
+// to the legacy EverCrypt AES-GCM calls, which fall back to OpenSSL.
 typedef struct quic_key {
   mitls_aead alg;
+  EverCrypt_AEAD_state_s *st;
   unsigned char key[32];
   unsigned char static_iv[12];
+  uint64_t iv_lo;
   union {
     unsigned char case_chacha20[32];
     EverCrypt_aes128_key case_aes128;
     EverCrypt_aes256_key case_aes256;
   } pne;
+  // AES-NI round keys for header protection, when hp_ni is set
+  int hp_ni;
+  unsigned char hp_rk[240];
 } quic_key;
 
 #if DEBUG
@@ -205,6 +224,46 @@ int MITLS_CALLCONV quic_derive_initial_secrets(quic_secret *client_in, quic_secr
   return 1;
 }
 
+static inline Spec_Agile_AEAD_alg convert_aead(mitls_aead a)
+{
+  if(a == TLS_aead_AES_128_GCM) return Spec_Agile_AEAD_AES128_GCM;
+  if(a == TLS_aead_AES_256_GCM) return Spec_Agile_AEAD_AES256_GCM;
+  return Spec_Agile_AEAD_CHACHA20_POLY1305;
+}
+
+// Expands the AEAD key once and splits the static IV for the nonce XOR
+static int quic_crypto_init_aead(quic_key *key, const unsigned char *raw_key)
+{
+  EverCrypt_Error_error_code r = EverCrypt_AEAD_create_in(convert_aead(key->alg), &key->st, (uint8_t*)raw_key);
+  memset(key->key, 0, 32);
+  if(r == EverCrypt_Error_UnsupportedAlgorithm && key->alg != TLS_aead_CHACHA20_POLY1305)
+  {
+    key->st = NULL;
+    memcpy(key->key, raw_key, key->alg == TLS_aead_AES_128_GCM ? 16 : 32);
+  }
+  else if(r != EverCrypt_Error_Success)
+    return 0;
+  key->iv_lo = load64_be(key->static_iv + 4);
+  return 1;
+}
+
+// Expands the AES header protection key for the multi-block kernel
+static void quic_crypto_init_hp(quic_key *key, const unsigned char *hp_key)
+{
+  key->hp_ni = 0;
+#if EVERCRYPT_CAN_COMPILE_VALE
+  if(key->alg != TLS_aead_CHACHA20_POLY1305 && EverCrypt_AutoConfig2_has_aesni()
+    && EverCrypt_AutoConfig2_has_avx() && EverCrypt_AutoConfig2_has_sse())
+  {
+    if(key->alg == TLS_aead_AES_128_GCM)
+      aes128_key_expansion((uint8_t*)hp_key, key->hp_rk);
+    else
+      aes256_key_expansion((uint8_t*)hp_key, key->hp_rk);
+    key->hp_ni = 1;
+  }
+#endif
+}
+
 int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secret)
 {
   quic_key *key = KRML_HOST_MALLOC(sizeof(quic_key));
@@ -215,30 +274,36 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
   uint32_t slen = (secret->hash == TLS_hash_SHA256 ? 32 : (secret->hash == TLS_hash_SHA384 ? 48 : 64));
 
   unsigned char info[259] = {0};
+  unsigned char raw_key[32];
   unsigned char pnkey[32];
   size_t info_len;
 
-  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "key", klen))
-    return 0;
-  if(!quic_crypto_hkdf_expand(secret->hash, key->key, klen, (uint8_t *) secret->secret, slen, info, info_len))
-    return 0;
-
-  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "iv", 12))
-    return 0;
-  if(!quic_crypto_hkdf_expand(secret->hash, key->static_iv, 12, (uint8_t *) secret->secret, slen, info, info_len))
-    return 0;
-
-  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "pn", klen))
-    return 0;
-  if(!quic_crypto_hkdf_expand(secret->hash, pnkey, klen, (uint8_t *) secret->secret, slen, info, info_len))
-    return 0;
+  // raw_key and pnkey only live until they are expanded into key; every
+  // return below wipes them.
+  int ok = quic_crypto_hkdf_label(secret->hash, info, &info_len, "key", klen)
+    && quic_crypto_hkdf_expand(secret->hash, raw_key, klen, (uint8_t *) secret->secret, slen, info, info_len)
+    && quic_crypto_hkdf_label(secret->hash, info, &info_len, "iv", 12)
+    && quic_crypto_hkdf_expand(secret->hash, key->static_iv, 12, (uint8_t *) secret->secret, slen, info, info_len)
+    && quic_crypto_hkdf_label(secret->hash, info, &info_len, "pn", klen)
+    && quic_crypto_hkdf_expand(secret->hash, pnkey, klen, (uint8_t *) secret->secret, slen, info, info_len);
 
 #if DEBUG
-   printf("KEY: "); dump(key->key, klen);
-   printf("IV: "); dump(key->static_iv, 12);
-   printf("PNE: "); dump(pnkey, klen);
+   if(ok)
+   {
+     printf("KEY: "); dump(raw_key, klen);
+     printf("IV: "); dump(key->static_iv, 12);
+     printf("PNE: "); dump(pnkey, klen);
+   }
 #endif
 
+   if(!ok || !quic_crypto_init_aead(key, raw_key))
+   {
+     Lib_Memzero0_memzero(raw_key, sizeof raw_key);
+     Lib_Memzero0_memzero(pnkey, sizeof pnkey);
+     KRML_HOST_FREE(key);
+     return 0;
+   }
+
    if(key->alg == TLS_aead_AES_128_GCM)
    {
      key->pne.case_aes128 = EverCrypt_aes128_create(pnkey);
@@ -251,26 +316,58 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
    {
      memcpy(key->pne.case_chacha20, pnkey, 32);
    }
+   quic_crypto_init_hp(key, pnkey);
+   Lib_Memzero0_memzero(raw_key, sizeof raw_key);
+   Lib_Memzero0_memzero(pnkey, sizeof pnkey);
 
   *k = key;
   return 1;
 }
 
-static inline void sn_to_iv(unsigned char *iv, uint64_t sn)
+static inline void sn_to_iv(const quic_key *key, unsigned char *iv, uint64_t sn)
 {
-  for(int i = 4; i < 12; i++)
-    iv[i] ^= (sn >> (88-(i<<3))) & 255;
+  memcpy(iv, key->static_iv, 4);
+  store64_be(iv + 4, key->iv_lo ^ sn);
+}
+
+static int quic_crypto_seal(quic_key *key, unsigned char *iv, const unsigned char *ad, uint32_t ad_len,
+  const unsigned char *plain, uint32_t plain_len, unsigned char *cipher)
+{
+  if(key->st != NULL)
+    return EverCrypt_AEAD_encrypt(key->st, iv, 12, (uint8_t*)ad, ad_len,
+      (uint8_t*)plain, plain_len, cipher, cipher + plain_len) == EverCrypt_Error_Success;
+
+  if(key->alg == TLS_aead_AES_128_GCM)
+    EverCrypt_aes128_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
+  else
+    EverCrypt_aes256_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
+  return 1;
+}
+
+static int quic_crypto_open(quic_key *key, unsigned char *iv, const unsigned char *ad, uint32_t ad_len,
+  const unsigned char *cipher, uint32_t plain_len, unsigned char *plain)
+{
+  if(key->st != NULL)
+    return EverCrypt_AEAD_decrypt(key->st, iv, 12, (uint8_t*)ad, ad_len, (uint8_t*)cipher, plain_len,
+      (uint8_t*)(cipher+plain_len), plain) == EverCrypt_Error_Success;
+
+  if(key->alg == TLS_aead_AES_128_GCM)
+    return EverCrypt_aes128_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
+  return EverCrypt_aes256_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
 }
 
 int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsigned char *raw_key, const unsigned char *iv, const unsigned char *pne_key)
 {
   quic_key *k = KRML_HOST_MALLOC(sizeof(quic_key));
   if(!k) return 0;
-  uint32_t klen = (alg == TLS_aead_AES_128_GCM ? 16 : 32);
 
   k->alg = alg;
-  memcpy(k->key, raw_key, klen);
   memcpy(k->static_iv, iv, 12);
+  if(!quic_crypto_init_aead(k, raw_key))
+  {
+    KRML_HOST_FREE(k);
+    return 0;
+  }
 
   if(alg == TLS_aead_AES_128_GCM)
     k->pne.case_aes128 = EverCrypt_aes128_create((uint8_t*)pne_key);
@@ -278,6 +375,7 @@ int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsi
     k->pne.case_aes256 = EverCrypt_aes256_create((uint8_t*)pne_key);
   else if(alg == TLS_aead_CHACHA20_POLY1305)
     memcpy(k->pne.case_chacha20, pne_key, 32);
+  quic_crypto_init_hp(k, pne_key);
 
   *key = k;
   return 1;
@@ -287,26 +385,12 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, unsigned char *cipher, uin
   const unsigned char *ad, uint32_t ad_len, const unsigned char *plain, uint32_t plain_len)
 {
   unsigned char iv[12];
-  memcpy(iv, key->static_iv, 12);
-  sn_to_iv(iv, sn);
+  sn_to_iv(key, iv, sn);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    EverCrypt_aes128_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    EverCrypt_aes256_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    EverCrypt_Chacha20Poly1305_aead_encrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, cipher + plain_len);
-  }
+  int r = quic_crypto_seal(key, iv, ad, ad_len, plain, plain_len, cipher);
 
 #if DEBUG
   printf("ENCRYPT %s\n", key->alg == TLS_aead_AES_128_GCM ? "AES128-GCM" : (key->alg == TLS_aead_AES_256_GCM ? "AES256-GCM" : "CHACHA20-POLY1305"));
-  printf("KEY="); dump(key->key, key->alg == TLS_aead_AES_128_GCM ? 16 : 32);
   printf("NONCE="); dump(iv, 12);
   printf("STATIC="); dump(key->static_iv, 12);
   printf("AD="); dump(ad, ad_len);
@@ -314,38 +398,39 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, unsigned char *cipher, uin
   printf("CIPHER="); dump(cipher, plain_len + 16);
 #endif
 
-  return 1;
+  return r;
+}
+
+int MITLS_CALLCONV quic_crypto_encrypt_batch(quic_key *key, quic_packet *pkts, size_t n)
+{
+  unsigned char iv[12];
+  int ok = 1;
+  memcpy(iv, key->static_iv, 4);
+
+  for(size_t i = 0; i < n; i++)
+  {
+    quic_packet *p = &pkts[i];
+    store64_be(iv + 4, key->iv_lo ^ p->sn);
+    ok &= quic_crypto_seal(key, iv, p->ad, p->ad_len, p->plain, p->plain_len, p->cipher);
+  }
+
+  return ok;
 }
 
 int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint64_t sn,
   const unsigned char *ad, uint32_t ad_len, const unsigned char *cipher, uint32_t cipher_len)
 {
   unsigned char iv[12];
-  memcpy(iv, key->static_iv, 12);
-  sn_to_iv(iv, sn);
+  sn_to_iv(key, iv, sn);
 
   if(cipher_len < quic_crypto_tag_length(key))
     return 0;
 
-  uint32_t r = 0, plain_len = cipher_len - quic_crypto_tag_length(key);
-
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    r = EverCrypt_aes128_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    r = EverCrypt_aes256_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    r = 1 - EverCrypt_Chacha20Poly1305_aead_decrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, (uint8_t*)(cipher+plain_len));
-  }
+  uint32_t plain_len = cipher_len - quic_crypto_tag_length(key);
+  int r = quic_crypto_open(key, iv, ad, ad_len, cipher, plain_len, plain);
 
 #if DEBUG
   printf("DECRYPT %X->%X %s\n", cipher, plain, r?"OK":"BAD");
-  printf("KEY="); dump(key->key, key->alg == TLS_aead_AES_128_GCM ? 16 : 32);
   printf("NONCE="); dump(iv, 12);
   printf("STATIC="); dump(key->static_iv, 12);
   printf("AD="); dump(ad, ad_len);
@@ -359,6 +444,16 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask)
 {
   unsigned char block[16];
+#if EVERCRYPT_CAN_COMPILE_VALE
+  if(key->hp_ni)
+  {
+    uint32_t nr = (key->alg == TLS_aead_AES_128_GCM ? 10 : 14);
+    Hacl_AES_GCM_NI_aes_encrypt_block(block, nr, key->hp_rk, (uint8_t*)sample);
+    memcpy(mask, block, 5);
+    return 1;
+  }
+#endif
+
   if(key->alg == TLS_aead_AES_128_GCM)
   {
     EverCrypt_aes128_compute(key->pne.case_aes128, (uint8_t*)sample, block);
@@ -386,10 +481,83 @@ int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sampl
   return 0;
 }
 
+// Copies up to lanes samples into consecutive 16-byte blocks of in
+static size_t hp_gather(unsigned char *in, const unsigned char **samples, size_t n, size_t lanes)
+{
+  size_t m = n < lanes ? n : lanes;
+  memset(in, 0, 16 * lanes);
+  for(size_t j = 0; j < m; j++)
+    memcpy(in + 16 * j, samples[j], 16);
+  return m;
+}
+
+static void hp_scatter(unsigned char *masks, const unsigned char *out, size_t m, size_t stride)
+{
+  for(size_t j = 0; j < m; j++)
+    memcpy(masks + 5 * j, out + stride * j, 5);
+}
+
+int MITLS_CALLCONV quic_crypto_hp_mask_batch(quic_key *key, const unsigned char **samples, unsigned char *masks, size_t n)
+{
+  unsigned char in[128], out[512];
+  size_t i = 0, m;
+
+#if EVERCRYPT_CAN_COMPILE_VALE
+  if(key->hp_ni)
+  {
+    uint32_t nr = (key->alg == TLS_aead_AES_128_GCM ? 10 : 14);
+    for(; i < n; i += m)
+    {
+      m = hp_gather(in, samples + i, n - i, 8);
+      Hacl_AES_GCM_NI_aes_ecb(16 * m, out, in, nr, key->hp_rk);
+      hp_scatter(masks + 5 * i, out, m, 16);
+    }
+    return 1;
+  }
+#endif
+
+  if(key->alg == TLS_aead_CHACHA20_POLY1305)
+  {
+#if EVERCRYPT_CAN_COMPILE_VEC256
+    if(EverCrypt_AutoConfig2_has_vec256())
+    {
+      for(; i < n; i += m)
+      {
+        m = hp_gather(in, samples + i, n - i, 8);
+        Hacl_Chacha20_Vec256_chacha20_lanes_256(out, key->pne.case_chacha20, in);
+        hp_scatter(masks + 5 * i, out, m, 64);
+      }
+      return 1;
+    }
+#endif
+#if EVERCRYPT_CAN_COMPILE_VEC128
+    if(EverCrypt_AutoConfig2_has_vec128())
+    {
+      for(; i < n; i += m)
+      {
+        m = hp_gather(in, samples + i, n - i, 4);
+        Hacl_Chacha20_Vec128_chacha20_lanes_128(out, key->pne.case_chacha20, in);
+        hp_scatter(masks + 5 * i, out, m, 64);
+      }
+      return 1;
+    }
+#endif
+  }
+
+  for(; i < n; i++)
+    if(!quic_crypto_hp_mask(key, samples[i], masks + 5 * i))
+      return 0;
+  return 1;
+}
+
 int MITLS_CALLCONV quic_crypto_free_key(quic_key *key)
 {
   if(key != NULL)
   {
+    if(key->st != NULL)
+      EverCrypt_AEAD_free(key->st);
+    Lib_Memzero0_memzero(key->key, sizeof key->key);
+    Lib_Memzero0_memzero(key->hp_rk, sizeof key->hp_rk);
     if(key->alg == TLS_aead_AES_128_GCM)
       EverCrypt_aes128_free(key->pne.case_aes128);
     if(key->alg == TLS_aead_AES_256_GCM)
@@ -63,6 +63,21 @@ int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsi
 // NB: NOT DOT ENCRYPT TWICE WITH THE SAME KEY AND SN
 int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, /*out*/ unsigned char *cipher, uint64_t sn, const unsigned char *ad, uint32_t ad_len, const unsigned char *plain, uint32_t plain_len);
 
+// One packet of a batch: the arguments of quic_crypto_encrypt
+typedef struct quic_packet {
+  unsigned char *cipher;
+  uint64_t sn;
+  const unsigned char *ad;
+  uint32_t ad_len;
+  const unsigned char *plain;
+  uint32_t plain_len;
+} quic_packet;
+
+// Encrypts n packets under the same key, as quic_crypto_encrypt
+// would for each of them (e.g. for GSO sends). Returns 1 if all
+// packets were encrypted.
+int MITLS_CALLCONV quic_crypto_encrypt_batch(quic_key *key, quic_packet *pkts, size_t n);
+
 // AEAD-decrypts cipher and authenticate additional data ad, using
 // counter; when successful, writes cipher_len - 16 bytes to the
 // output plain. The input and output buffers must not overlap.
@@ -73,6 +88,13 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, /*out*/ unsigned char *pla
 // 5 bytes will be written to *mask
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask);
 
+// Computes the masks of n packets at once, as n calls to
+// quic_crypto_hp_mask would: samples[i] points to the 16-byte sample
+// of packet i, and its 5-byte mask is written to masks + 5*i.
+// Several samples are processed in parallel (8 AES blocks or 8/4
+// ChaCha20 lanes).
+int MITLS_CALLCONV quic_crypto_hp_mask_batch(quic_key *key, const unsigned char **samples, unsigned char *masks, size_t n);
+
 // Keys allocated by quic_crypto_derive_key and quic_crypto_create must be freed
 int MITLS_CALLCONV quic_crypto_free_key(quic_key *key);
 
@@ -472,6 +472,24 @@ void test_crypto(const quic_secret *secret, const unsigned char *expected_cipher
     }
     check_result("quic_crypto_decrypt", decrypted, plain, sizeof(decrypted));
 
+    // A batch must produce the same packets as one call per packet
+    unsigned char batch_cipher[3][plain_len+16];
+    unsigned char single_cipher[plain_len+16];
+    quic_packet pkts[3];
+    for (int i=0; i<3; ++i) {
+        pkts[i] = (quic_packet){ batch_cipher[i], sn + i, ad, ad_len, plain, plain_len - i };
+    }
+    result = quic_crypto_encrypt_batch(key, pkts, 3);
+    if (result == 0) {
+        printf("FAIL: quic_crypto_encrypt_batch failed\n");
+        exit(1);
+    }
+    check_result("quic_crypto_encrypt_batch", batch_cipher[0], expected_cipher, sizeof(cipher));
+    for (int i=1; i<3; ++i) {
+        quic_crypto_encrypt(key, single_cipher, sn + i, ad, ad_len, plain, plain_len - i);
+        check_result("quic_crypto_encrypt_batch", batch_cipher[i], single_cipher, plain_len - i + 16);
+    }
+
     result = quic_crypto_free_key(key);
     if (result == 0) {
         printf("FAIL: quic_crypto_free_key failed\n");
@@ -542,6 +560,79 @@ void test_pn_encrypt()
   }
 }
 
+/* Header protection samples and keys from RFC 9001, Appendix A.2 (client
+   Initial), A.3 (server Initial) and A.5 (ChaCha20-Poly1305 short header).
+   Each key is applied to all three samples; the RFC gives the mask of its own
+   sample, the other masks (and the AES-256 row, for which the RFC has no
+   vector) were computed with OpenSSL. */
+static const uint8_t hp_samples[3][16] = {
+  { 0xd1, 0xb1, 0xc9, 0x8d, 0xd7, 0x68, 0x9f, 0xb8, 0xec, 0x11, 0xd2, 0x42, 0xb1, 0x23, 0xdc, 0x9b },
+  { 0x2c, 0xd0, 0x99, 0x1c, 0xd2, 0x5b, 0x0a, 0xac, 0x40, 0x6a, 0x58, 0x16, 0xb6, 0x39, 0x41, 0x00 },
+  { 0x5e, 0x5c, 0xd5, 0x5c, 0x41, 0xf6, 0x90, 0x80, 0x57, 0x5d, 0x79, 0x99, 0xc2, 0x5a, 0x5b, 0xfb },
+};
+
+static const struct {
+  mitls_aead ae;
+  uint8_t hp[32];
+  uint8_t masks[3][5];
+} hp_vectors[] = {
+  { TLS_aead_AES_128_GCM,
+    { 0x9f, 0x50, 0x44, 0x9e, 0x04, 0xa0, 0xe8, 0x10, 0x28, 0x3a, 0x1e, 0x99, 0x33, 0xad, 0xed, 0xd2 },
+    { { 0x43, 0x7b, 0x9a, 0xec, 0x36 }, { 0xc1, 0x95, 0x8a, 0x2f, 0x73 }, { 0xe5, 0x77, 0x53, 0x0d, 0x67 } } },
+  { TLS_aead_AES_128_GCM,
+    { 0xc2, 0x06, 0xb8, 0xd9, 0xb9, 0xf0, 0xf3, 0x76, 0x44, 0x43, 0x0b, 0x49, 0x0e, 0xea, 0xa3, 0x14 },
+    { { 0x16, 0x52, 0x87, 0xd9, 0x18 }, { 0x2e, 0xc0, 0xd8, 0x35, 0x6a }, { 0xe8, 0x3f, 0xa3, 0x58, 0xdf } } },
+  { TLS_aead_CHACHA20_POLY1305,
+    { 0x25, 0xa2, 0x82, 0xb9, 0xe8, 0x2f, 0x06, 0xf2, 0x1f, 0x48, 0x89, 0x17, 0xa4, 0xfc, 0x8f, 0x1b,
+      0x73, 0x57, 0x36, 0x85, 0x60, 0x85, 0x97, 0xd0, 0xef, 0xcb, 0x07, 0x6b, 0x0a, 0xb7, 0xa7, 0xa4 },
+    { { 0xfe, 0xf1, 0x43, 0xa4, 0x16 }, { 0x72, 0xb1, 0xa6, 0x51, 0x07 }, { 0xae, 0xfe, 0xfe, 0x7d, 0x03 } } },
+  { TLS_aead_AES_256_GCM,
+    { 0x25, 0xa2, 0x82, 0xb9, 0xe8, 0x2f, 0x06, 0xf2, 0x1f, 0x48, 0x89, 0x17, 0xa4, 0xfc, 0x8f, 0x1b,
+      0x73, 0x57, 0x36, 0x85, 0x60, 0x85, 0x97, 0xd0, 0xef, 0xcb, 0x07, 0x6b, 0x0a, 0xb7, 0xa7, 0xa4 },
+    { { 0x2c, 0x13, 0x9a, 0xdf, 0x26 }, { 0x8f, 0xd9, 0xbd, 0x5f, 0xa4 }, { 0xe5, 0x8c, 0xee, 0xaf, 0x9d } } },
+};
+
+void test_hp_mask()
+{
+  printf("==== test_hp_mask() ====\n");
+
+  static const uint8_t raw_key[32] = {0};
+  static const uint8_t iv[12] = {0};
+  quic_key *key;
+  int result;
+
+  for (size_t v = 0; v < sizeof(hp_vectors) / sizeof(hp_vectors[0]); v++) {
+    result = quic_crypto_create(&key, hp_vectors[v].ae, raw_key, iv, hp_vectors[v].hp);
+    if (result == 0) {
+        printf("FAIL: quic_crypto_create failed\n");
+        exit(1);
+    }
+
+    uint8_t mask[5];
+    for (int i = 0; i < 3; i++) {
+      quic_crypto_hp_mask(key, hp_samples[i], mask);
+      check_result("quic_crypto_hp_mask", mask, hp_vectors[v].masks[i], 5);
+    }
+
+    // More samples than lanes, so that the last group is partial
+    const unsigned char *samples[11];
+    uint8_t masks[11*5];
+    for (int i = 0; i < 11; i++) {
+      samples[i] = hp_samples[i % 3];
+    }
+    result = quic_crypto_hp_mask_batch(key, samples, masks, 11);
+    if (result == 0) {
+        printf("FAIL: quic_crypto_hp_mask_batch failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < 11; i++) {
+      check_result("quic_crypto_hp_mask_batch", masks + 5*i, hp_vectors[v].masks[i % 3], 5);
+    }
+
+    quic_crypto_free_key(key);
+  }
+}
+
 void test_initial_secrets()
 {
     int result;
@@ -595,6 +686,7 @@ void exhaustive(void)
     }
 
     test_pn_encrypt();
+    test_hp_mask();
     test_initial_secrets();
 }
 
@@ -609,5 +701,10 @@ int CDECL main(int argc, char **argv)
     coverage();
     exhaustive();
 
+    // AES-GCM keys then fall back on the legacy EverCrypt calls
+    printf("==== Without AES-NI ====\n");
+    EverCrypt_AutoConfig2_disable_aesni();
+    exhaustive();
+
     printf("==== ALL TESTS PASS ====\n");
 }
@@ -0,0 +1,238 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#define MAXLEN  4200
+#define MAXSEGS 64
+#define ROUNDS  100000
+#define HDRLEN  40
+#define PKTLEN  1400
+
+// GCM spec (McGrew & Viega), Test Case 4.
+static uint8_t gcm_key[16] = {
+  0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08
+};
+static uint8_t gcm_iv[12] = {
+  0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+static uint8_t gcm_aad[20] = {
+  0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+  0xab, 0xad, 0xda, 0xd2
+};
+static uint8_t gcm_plain[60] = {
+  0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+  0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+  0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+  0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39
+};
+static uint8_t gcm_cipher[60] = {
+  0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+  0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+  0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+  0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91
+};
+static uint8_t gcm_tag[16] = {
+  0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47
+};
+
+static uint8_t key[32];
+static uint8_t iv[60];
+static uint8_t aad[300];
+static uint8_t plain[MAXLEN];
+static uint8_t cipher[MAXLEN];
+static uint8_t out[MAXLEN];
+static uint8_t back[MAXLEN];
+
+// Cuts buf[0..len) into segments whose sizes cycle through pattern.
+static uint32_t split(EverCrypt_AEAD_iovec *v, uint8_t *buf, uint32_t len, const uint32_t *pattern, uint32_t n) {
+  uint32_t k = 0, off = 0;
+  while (off < len && k < MAXSEGS - 1) {
+    uint32_t l = pattern[k % n];
+    if (l > len - off) l = len - off;
+    v[k].base = buf + off;
+    v[k].len = l;
+    off += l;
+    k++;
+  }
+  if (off < len) {
+    v[k].base = buf + off;
+    v[k].len = len - off;
+    k++;
+  }
+  return k;
+}
+
+static const uint32_t pat_a[] = { 1, 7, 16, 0, 3, 64, 33 };
+static const uint32_t pat_b[] = { 40, 5, 100, 17 };
+static const uint32_t pat_c[] = { 13, 2, 1, 256, 15 };
+
+bool check_kat() {
+  EverCrypt_AEAD_state_s *s;
+  if (EverCrypt_AEAD_create_in(Spec_Agile_AEAD_AES128_GCM, &s, gcm_key) != EverCrypt_Error_Success) {
+    printf("AES128-GCM iov known answer: not supported on this machine, skipping\n");
+    return true;
+  }
+  EverCrypt_AEAD_iovec va[MAXSEGS], vp[MAXSEGS], vc[MAXSEGS];
+  uint8_t tag[16];
+  uint32_t na = split(va, gcm_aad, 20, pat_a, 7);
+  uint32_t np = split(vp, gcm_plain, 60, pat_a, 7);
+  uint32_t nc = split(vc, cipher, 60, pat_b, 4);
+  bool ok = EverCrypt_AEAD_encrypt_iov(s, gcm_iv, 12, va, na, vp, np, vc, nc, tag) == EverCrypt_Error_Success;
+  printf("AES128-GCM iov known answer:\n");
+  ok = compare_and_print(60, cipher, gcm_cipher) && ok;
+  ok = compare_and_print(16, tag, gcm_tag) && ok;
+  EverCrypt_AEAD_free(s);
+  return ok;
+}
+
+bool check_alg(const char *name, Spec_Agile_AEAD_alg a) {
+  EverCrypt_AEAD_state_s *s;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success) {
+    printf("%s iov: not supported on this machine, skipping\n", name);
+    return true;
+  }
+  uint32_t lens[] = { 0, 1, 15, 16, 17, 63, 64, 65, 100, 255, 256, 1000, 1500, 4100 };
+  uint32_t ad_lens[] = { 0, 1, 13, 20, 64, 300 };
+  uint32_t iv_lens[] = { 12, 1, 16, 60 };
+  uint32_t n_iv = a == Spec_Agile_AEAD_CHACHA20_POLY1305 ? 1 : 4;
+  EverCrypt_AEAD_iovec va[MAXSEGS], vp[MAXSEGS], vc[MAXSEGS], vd[MAXSEGS];
+  uint8_t tag[16], tag1[16];
+  bool ok = true;
+
+  for (uint32_t x = 0; x < n_iv; x++)
+  for (uint32_t y = 0; y < sizeof ad_lens / sizeof ad_lens[0]; y++)
+  for (uint32_t z = 0; z < sizeof lens / sizeof lens[0]; z++) {
+    uint32_t il = iv_lens[x], al = ad_lens[y], len = lens[z];
+    ok = ok && EverCrypt_AEAD_encrypt(s, iv, il, aad, al, plain, len, cipher, tag) == EverCrypt_Error_Success;
+
+    uint32_t na = split(va, aad, al, pat_c, 5);
+    uint32_t np = split(vp, plain, len, pat_a, 7);
+    uint32_t nc = split(vc, out, len, pat_b, 4);
+    memset(out, 0, len);
+    ok = ok && EverCrypt_AEAD_encrypt_iov(s, iv, il, va, na, vp, np, vc, nc, tag1) == EverCrypt_Error_Success;
+    ok = ok && memcmp(out, cipher, len) == 0 && memcmp(tag, tag1, 16) == 0;
+
+    // Decrypt with yet another split, then in place.
+    nc = split(vc, cipher, len, pat_c, 5);
+    uint32_t nd = split(vd, back, len, pat_a, 7);
+    memset(back, 0, len);
+    ok = ok && EverCrypt_AEAD_decrypt_iov(s, iv, il, va, na, vc, nc, tag, vd, nd) == EverCrypt_Error_Success;
+    ok = ok && memcmp(back, plain, len) == 0;
+    ok = ok && EverCrypt_AEAD_decrypt_iov(s, iv, il, va, na, vc, nc, tag, vc, nc) == EverCrypt_Error_Success;
+    ok = ok && memcmp(cipher, plain, len) == 0;
+
+    // A bad tag must leave the output untouched. With at most one segment per
+    // list, decrypt_iov forwards to EverCrypt_AEAD_decrypt, which does not
+    // make that promise.
+    if (len > 0 && (na > 1 || nc > 1 || nd > 1)) {
+      ok = ok && EverCrypt_AEAD_encrypt(s, iv, il, aad, al, plain, len, cipher, tag) == EverCrypt_Error_Success;
+      tag[len % 16] ^= 0x80;
+      memset(back, 0xaa, len);
+      ok = ok && EverCrypt_AEAD_decrypt_iov(s, iv, il, va, na, vc, nc, tag, vd, nd) == EverCrypt_Error_AuthenticationFailure;
+      ok = ok && back[0] == 0xaa && back[len - 1] == 0xaa;
+    }
+  }
+
+  // Mismatched input and output lengths are rejected.
+  uint32_t np = split(vp, plain, 100, pat_a, 7);
+  uint32_t nc = split(vc, out, 99, pat_b, 4);
+  ok = ok && EverCrypt_AEAD_encrypt_iov(s, iv, 12, NULL, 0, vp, np, vc, nc, tag) == EverCrypt_Error_DecodeError;
+
+  // A failed encryption must not write to the cipher segments.
+  uint32_t bad_iv = a == Spec_Agile_AEAD_CHACHA20_POLY1305 ? 16 : 0;
+  nc = split(vc, out, 100, pat_b, 4);
+  memset(out, 0xaa, 100);
+  ok = ok && EverCrypt_AEAD_encrypt_iov(s, iv, bad_iv, NULL, 0, vp, np, vc, nc, tag) == EverCrypt_Error_InvalidIVLength;
+  for (uint32_t i = 0; i < 100; i++)
+    ok = ok && out[i] == 0xaa;
+
+  if (ok)
+    printf("%s iov against contiguous: Success!\n", name);
+  else
+    printf("%s iov against contiguous: **FAILED**\n", name);
+  EverCrypt_AEAD_free(s);
+  return ok;
+}
+
+// A packet whose header and payload live in separate buffers: staging them
+// into one buffer for the contiguous API, against handing both to encrypt_iov.
+void perf(const char *name, Spec_Agile_AEAD_alg a) {
+  EverCrypt_AEAD_state_s *s;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return;
+  static uint8_t hdr[HDRLEN], payload[PKTLEN], staging[HDRLEN + PKTLEN], dst[HDRLEN + PKTLEN];
+  uint8_t tag[16];
+  EverCrypt_AEAD_iovec vp[2] = { { hdr, HDRLEN }, { payload, PKTLEN } };
+  EverCrypt_AEAD_iovec vc[1] = { { dst, HDRLEN + PKTLEN } };
+  EverCrypt_AEAD_iovec va[1] = { { aad, 13 } };
+  uint64_t count = (uint64_t)ROUNDS * (HDRLEN + PKTLEN);
+  int res = 0;
+  cycles c0, c1;
+  clock_t t1, t2;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    memcpy(staging, hdr, HDRLEN);
+    memcpy(staging + HDRLEN, payload, PKTLEN);
+    EverCrypt_AEAD_encrypt(s, iv, 12, aad, 13, staging, HDRLEN + PKTLEN, dst, tag);
+    res ^= tag[0];
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = c1 - c0;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_AEAD_encrypt_iov(s, iv, 12, va, 1, vp, 2, vc, 1, tag);
+    res ^= tag[0];
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = c1 - c0;
+
+  printf("%s staged + contiguous encrypt PERF:\n", name); print_time(count, tdiff1, cdiff1);
+  printf("%s encrypt_iov (2 segments) PERF:\n", name); print_time(count, tdiff2, cdiff2);
+  if (res == 256) printf(" ");
+  EverCrypt_AEAD_free(s);
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (uint32_t i = 0; i < 32; i++) key[i] = (uint8_t)(i * 13 + 1);
+  for (uint32_t i = 0; i < 60; i++) iv[i] = (uint8_t)(i * 5 + 3);
+  for (uint32_t i = 0; i < 300; i++) aad[i] = (uint8_t)(i * 3 + 7);
+  for (uint32_t i = 0; i < MAXLEN; i++) plain[i] = (uint8_t)(i * 7 + (i >> 8));
+
+  bool ok = check_kat();
+  ok = check_alg("AES128-GCM", Spec_Agile_AEAD_AES128_GCM) && ok;
+  ok = check_alg("AES256-GCM", Spec_Agile_AEAD_AES256_GCM) && ok;
+  ok = check_alg("Chacha20Poly1305", Spec_Agile_AEAD_CHACHA20_POLY1305) && ok;
+
+  perf("AES128-GCM", Spec_Agile_AEAD_AES128_GCM);
+  perf("Chacha20Poly1305", Spec_Agile_AEAD_CHACHA20_POLY1305);
+
+  // The same again on the 128-bit AES-GCM kernels.
+  if (EverCrypt_AutoConfig2_has_vaes()) {
+    EverCrypt_AutoConfig2_disable_vaes();
+    printf("Without VAES:\n");
+    ok = check_kat() && ok;
+    ok = check_alg("AES128-GCM", Spec_Agile_AEAD_AES128_GCM) && ok;
+    ok = check_alg("AES256-GCM", Spec_Agile_AEAD_AES256_GCM) && ok;
+    perf("AES128-GCM", Spec_Agile_AEAD_AES128_GCM);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,506 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Blake2b_32.h"
+#include "Hacl_Blake2s_32.h"
+#include "Hacl_Streaming_Blake2.h"
+#if EVERCRYPT_CAN_COMPILE_VEC256
+#include "Hacl_Blake2b_256.h"
+#endif
+
+#include "test_helpers.h"
+
+#define MSG_LEN 2600
+#define PERF_LEN (1 << 20)
+#define ROUNDS 50
+
+static uint8_t msg[MSG_LEN];
+static uint8_t key[64];
+
+// A straightforward BLAKE2b/BLAKE2s written from RFC 7693, with an explicit
+// parameter block and last-node flag, independent of the code under test.
+
+static const uint8_t sigma[10][16] = {
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+  { 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+  { 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+  { 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+  { 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+  { 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+  { 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+  { 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+  { 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+  { 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 }
+};
+
+static const uint64_t iv_b[8] = {
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+  0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const uint32_t iv_s[8] = {
+  0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+  0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U
+};
+
+#define ROTR(x, n, w) (((x) >> (n)) | ((x) << ((w) - (n))))
+
+#define G(W, v, a, b, c, d, x, y, r1, r2, r3, r4)       \
+  do {                                                  \
+    v[a] = v[a] + v[b] + (x); v[d] = ROTR(v[d] ^ v[a], r1, W); \
+    v[c] = v[c] + v[d];       v[b] = ROTR(v[b] ^ v[c], r2, W); \
+    v[a] = v[a] + v[b] + (y); v[d] = ROTR(v[d] ^ v[a], r3, W); \
+    v[c] = v[c] + v[d];       v[b] = ROTR(v[b] ^ v[c], r4, W); \
+  } while (0)
+
+#define ROUNDS_OF(W, v, m, nr, r1, r2, r3, r4)                                   \
+  for (int r = 0; r < nr; r++) {                                                 \
+    const uint8_t *s = sigma[r % 10];                                            \
+    G(W, v, 0, 4, 8, 12, m[s[0]], m[s[1]], r1, r2, r3, r4);                      \
+    G(W, v, 1, 5, 9, 13, m[s[2]], m[s[3]], r1, r2, r3, r4);                      \
+    G(W, v, 2, 6, 10, 14, m[s[4]], m[s[5]], r1, r2, r3, r4);                     \
+    G(W, v, 3, 7, 11, 15, m[s[6]], m[s[7]], r1, r2, r3, r4);                     \
+    G(W, v, 0, 5, 10, 15, m[s[8]], m[s[9]], r1, r2, r3, r4);                     \
+    G(W, v, 1, 6, 11, 12, m[s[10]], m[s[11]], r1, r2, r3, r4);                   \
+    G(W, v, 2, 7, 8, 13, m[s[12]], m[s[13]], r1, r2, r3, r4);                    \
+    G(W, v, 3, 4, 9, 14, m[s[14]], m[s[15]], r1, r2, r3, r4);                    \
+  }
+
+static void ref_compress_b(uint64_t *h, const uint8_t *block, uint64_t t, bool final, bool last) {
+  uint64_t v[16], m[16];
+  for (int i = 0; i < 16; i++) {
+    m[i] = 0;
+    for (int j = 0; j < 8; j++) m[i] |= (uint64_t)block[8 * i + j] << (8 * j);
+  }
+  for (int i = 0; i < 8; i++) { v[i] = h[i]; v[i + 8] = iv_b[i]; }
+  v[12] ^= t;
+  if (final) v[14] = ~v[14];
+  if (last) v[15] = ~v[15];
+  ROUNDS_OF(64, v, m, 12, 32, 24, 16, 63);
+  for (int i = 0; i < 8; i++) h[i] ^= v[i] ^ v[i + 8];
+}
+
+static void ref_compress_s(uint32_t *h, const uint8_t *block, uint64_t t, bool final, bool last) {
+  uint32_t v[16], m[16];
+  for (int i = 0; i < 16; i++) {
+    m[i] = 0;
+    for (int j = 0; j < 4; j++) m[i] |= (uint32_t)block[4 * i + j] << (8 * j);
+  }
+  for (int i = 0; i < 8; i++) { v[i] = h[i]; v[i + 8] = iv_s[i]; }
+  v[12] ^= (uint32_t)t;
+  v[13] ^= (uint32_t)(t >> 32);
+  if (final) v[14] = ~v[14];
+  if (last) v[15] = ~v[15];
+  ROUNDS_OF(32, v, m, 10, 16, 12, 8, 7);
+  for (int i = 0; i < 8; i++) h[i] ^= v[i] ^ v[i + 8];
+}
+
+typedef struct {
+  const char *name;
+  uint32_t block, leaves, inner;
+  Hacl_Streaming_Blake2_blake2bp_state *(*create_in)(uint32_t, uint8_t *);
+  void (*init)(uint32_t, uint8_t *, Hacl_Streaming_Blake2_blake2bp_state *);
+  void (*update)(uint32_t, Hacl_Streaming_Blake2_blake2bp_state *, uint8_t *, uint32_t);
+  void (*finish)(uint32_t, Hacl_Streaming_Blake2_blake2bp_state *, uint8_t *);
+  void (*free)(uint32_t, Hacl_Streaming_Blake2_blake2bp_state *);
+  void (*hash)(uint32_t, uint8_t *, uint32_t, uint8_t *, uint32_t, uint8_t *);
+} tree_instance;
+
+// One node of the tree: the parameter block of the spec XORed into the IV,
+// then plain sequential hashing of data, of which the last block is final.
+static void ref_node(tree_instance *t, uint8_t *out, uint32_t outlen, uint32_t nn, uint32_t kk,
+                     uint32_t offset, uint32_t depth, const uint8_t *data, size_t len, bool last) {
+  uint8_t p[64] = { 0 }, block[128];
+  p[0] = (uint8_t)nn;
+  p[1] = (uint8_t)kk;
+  p[2] = (uint8_t)t->leaves;
+  p[3] = 2;
+  if (t->block == 128) {
+    p[8] = (uint8_t)offset;
+    p[16] = (uint8_t)depth;
+    p[17] = (uint8_t)t->inner;
+  } else {
+    p[8] = (uint8_t)offset;
+    p[14] = (uint8_t)depth;
+    p[15] = (uint8_t)t->inner;
+  }
+  uint64_t hb[8];
+  uint32_t hs[8];
+  for (int i = 0; i < 8; i++) {
+    uint64_t w = 0;
+    for (int j = 0; j < 8; j++) w |= (uint64_t)p[8 * i + j] << (8 * j);
+    hb[i] = iv_b[i] ^ w;
+    uint32_t ws = 0;
+    for (int j = 0; j < 4; j++) ws |= (uint32_t)p[4 * i + j] << (8 * j);
+    hs[i] = iv_s[i] ^ ws;
+  }
+  uint64_t ctr = 0;
+  do {
+    size_t n = len > t->block ? t->block : len;
+    memset(block, 0, sizeof(block));
+    memcpy(block, data, n);
+    ctr += n;
+    bool final = len <= t->block;
+    if (t->block == 128) ref_compress_b(hb, block, ctr, final, final && last);
+    else ref_compress_s(hs, block, ctr, final, final && last);
+    data += n;
+    len -= n;
+  } while (len > 0);
+  for (uint32_t i = 0; i < outlen; i++)
+    out[i] = t->block == 128 ? (uint8_t)(hb[i / 8] >> (8 * (i % 8))) : (uint8_t)(hs[i / 4] >> (8 * (i % 4)));
+}
+
+// Leaf i hashes the padded key block, if any, then blocks i, i + leaves, ...
+// of the input; the root hashes the concatenated leaf digests.
+static void ref_tree(tree_instance *t, uint32_t nn, uint8_t *out, uint32_t ll, uint8_t *d,
+                     uint32_t kk, uint8_t *k) {
+  uint8_t *leaf = malloc(MSG_LEN + 128);
+  uint8_t hashes[256];
+  for (uint32_t i = 0; i < t->leaves; i++) {
+    size_t len = 0;
+    if (kk > 0) {
+      memset(leaf, 0, t->block);
+      memcpy(leaf, k, kk);
+      len = t->block;
+    }
+    for (uint32_t j = i * t->block; j < ll; j += t->leaves * t->block) {
+      uint32_t n = ll - j < t->block ? ll - j : t->block;
+      memcpy(leaf + len, d + j, n);
+      len += n;
+    }
+    ref_node(t, hashes + i * t->inner, t->inner, nn, kk, i, 0, leaf, len, i == t->leaves - 1);
+  }
+  ref_node(t, out, nn, nn, kk, 0, 1, hashes, t->leaves * t->inner, true);
+  free(leaf);
+}
+
+bool check_against_reference(tree_instance *t, const char *impl) {
+  static const uint32_t nns[] = { 1, 20, 32, 64 };
+  static const uint32_t kks[] = { 0, 1, 17, 32, 64 };
+  uint8_t out[64], expected[64];
+  bool ok = true;
+  for (size_t a = 0; a < sizeof(nns) / sizeof(nns[0]); a++) {
+    uint32_t nn = nns[a];
+    if (nn > t->inner) continue;
+    for (size_t b = 0; b < sizeof(kks) / sizeof(kks[0]); b++) {
+      uint32_t kk = kks[b];
+      if (kk > t->inner) continue;
+      for (uint32_t len = 0; len <= MSG_LEN; len += (len < 1100 ? 1 : 97)) {
+        t->hash(nn, out, len, msg, kk, key);
+        ref_tree(t, nn, expected, len, msg, kk, key);
+        ok = ok && memcmp(out, expected, nn) == 0;
+      }
+    }
+  }
+  printf("%s (%s) against reference: %s\n", t->name, impl, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Every chunking must agree with the one-shot hash, and finish must leave the
+// state usable for more input.
+bool check_streaming(tree_instance *t, const char *impl) {
+  static const uint32_t chunks[] = { 1, 63, 64, 65, 127, 128, 129, 383, 384, 385, 511, 512, 513,
+                                     1023, 1024, 1025, MSG_LEN };
+  static const uint32_t kks[] = { 0, 32 };
+  uint8_t out[64], expected[64];
+  bool ok = true;
+  for (size_t b = 0; b < sizeof(kks) / sizeof(kks[0]); b++) {
+    uint32_t kk = kks[b];
+    Hacl_Streaming_Blake2_blake2bp_state *s = t->create_in(kk, key);
+    for (size_t k = 0; k < sizeof(chunks) / sizeof(chunks[0]); k++) {
+      for (uint32_t len = 0; len <= MSG_LEN; len += 71) {
+        t->init(kk, key, s);
+        for (uint32_t i = 0; i < len; i += chunks[k]) {
+          uint32_t n = len - i < chunks[k] ? len - i : chunks[k];
+          t->update(kk, s, msg + i, n);
+          t->update(kk, s, NULL, 0);
+          if (i == 0 && n < len) {
+            t->finish(kk, s, out);
+            t->hash(t->inner, expected, n, msg, kk, key);
+            ok = ok && memcmp(out, expected, t->inner) == 0;
+          }
+        }
+        t->finish(kk, s, out);
+        t->hash(t->inner, expected, len, msg, kk, key);
+        ok = ok && memcmp(out, expected, t->inner) == 0;
+      }
+    }
+    t->free(kk, s);
+  }
+  printf("Streaming %s (%s) against one-shot: %s\n", t->name, impl, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Known-answer tests from the reference implementation: blake2bp-kat.txt and
+// blake2sp-kat.txt (keyed with 00 01 02 ..., full-length key) and the unkeyed
+// entries of blake2-kat.json, over the input 00 01 02 ... of the given length.
+typedef struct {
+  uint32_t len;
+  uint8_t bp[64];
+  uint8_t bp_keyed[64];
+  uint8_t sp[32];
+  uint8_t sp_keyed[32];
+} kat;
+
+static const kat kats[] = {
+  { 0,
+    {
+      0xb5, 0xef, 0x81, 0x1a, 0x80, 0x38, 0xf7, 0x0b, 0x62, 0x8f, 0xa8, 0xb2, 0x94, 0xda, 0xae, 0x74,
+      0x92, 0xb1, 0xeb, 0xe3, 0x43, 0xa8, 0x0e, 0xaa, 0xbb, 0xf1, 0xf6, 0xae, 0x66, 0x4d, 0xd6, 0x7b,
+      0x9d, 0x90, 0xb0, 0x12, 0x07, 0x91, 0xea, 0xb8, 0x1d, 0xc9, 0x69, 0x85, 0xf2, 0x88, 0x49, 0xf6,
+      0xa3, 0x05, 0x18, 0x6a, 0x85, 0x50, 0x1b, 0x40, 0x51, 0x14, 0xbf, 0xa6, 0x78, 0xdf, 0x93, 0x80
+    },
+    {
+      0x9d, 0x94, 0x61, 0x07, 0x3e, 0x4e, 0xb6, 0x40, 0xa2, 0x55, 0x35, 0x7b, 0x83, 0x9f, 0x39, 0x4b,
+      0x83, 0x8c, 0x6f, 0xf5, 0x7c, 0x9b, 0x68, 0x6a, 0x3f, 0x76, 0x10, 0x7c, 0x10, 0x66, 0x72, 0x8f,
+      0x3c, 0x99, 0x56, 0xbd, 0x78, 0x5c, 0xbc, 0x3b, 0xf7, 0x9d, 0xc2, 0xab, 0x57, 0x8c, 0x5a, 0x0c,
+      0x06, 0x3b, 0x9d, 0x9c, 0x40, 0x58, 0x48, 0xde, 0x1d, 0xbe, 0x82, 0x1c, 0xd0, 0x5c, 0x94, 0x0a
+    },
+    {
+      0xdd, 0x0e, 0x89, 0x17, 0x76, 0x93, 0x3f, 0x43, 0xc7, 0xd0, 0x32, 0xb0, 0x8a, 0x91, 0x7e, 0x25,
+      0x74, 0x1f, 0x8a, 0xa9, 0xa1, 0x2c, 0x12, 0xe1, 0xca, 0xc8, 0x80, 0x15, 0x00, 0xf2, 0xca, 0x4f
+    },
+    {
+      0x71, 0x5c, 0xb1, 0x38, 0x95, 0xae, 0xb6, 0x78, 0xf6, 0x12, 0x41, 0x60, 0xbf, 0xf2, 0x14, 0x65,
+      0xb3, 0x0f, 0x4f, 0x68, 0x74, 0x19, 0x3f, 0xc8, 0x51, 0xb4, 0x62, 0x10, 0x43, 0xf0, 0x9c, 0xc6
+    } },
+  { 1,
+    {
+      0xa1, 0x39, 0x28, 0x0e, 0x72, 0x75, 0x7b, 0x72, 0x3e, 0x64, 0x73, 0xd5, 0xbe, 0x59, 0xf3, 0x6e,
+      0x9d, 0x50, 0xfc, 0x5c, 0xd7, 0xd4, 0x58, 0x5c, 0xbc, 0x09, 0x80, 0x48, 0x95, 0xa3, 0x6c, 0x52,
+      0x12, 0x42, 0xfb, 0x27, 0x89, 0xf8, 0x5c, 0xb9, 0xe3, 0x54, 0x91, 0xf3, 0x1d, 0x4a, 0x69, 0x52,
+      0xf9, 0xd8, 0xe0, 0x97, 0xae, 0xf9, 0x4f, 0xa1, 0xca, 0x0b, 0x12, 0x52, 0x57, 0x21, 0xf0, 0x3d
+    },
+    {
+      0xff, 0x8e, 0x90, 0xa3, 0x7b, 0x94, 0x62, 0x39, 0x32, 0xc5, 0x9f, 0x75, 0x59, 0xf2, 0x60, 0x35,
+      0x02, 0x9c, 0x37, 0x67, 0x32, 0xcb, 0x14, 0xd4, 0x16, 0x02, 0x00, 0x1c, 0xbb, 0x73, 0xad, 0xb7,
+      0x92, 0x93, 0xa2, 0xdb, 0xda, 0x5f, 0x60, 0x70, 0x30, 0x25, 0x14, 0x4d, 0x15, 0x8e, 0x27, 0x35,
+      0x52, 0x95, 0x96, 0x25, 0x1c, 0x73, 0xc0, 0x34, 0x5c, 0xa6, 0xfc, 0xcb, 0x1f, 0xb1, 0xe9, 0x7e
+    },
+    {
+      0xa6, 0xb9, 0xee, 0xcc, 0x25, 0x22, 0x7a, 0xd7, 0x88, 0xc9, 0x9d, 0x3f, 0x23, 0x6d, 0xeb, 0xc8,
+      0xda, 0x40, 0x88, 0x49, 0xe9, 0xa5, 0x17, 0x89, 0x78, 0x72, 0x7a, 0x81, 0x45, 0x7f, 0x72, 0x39
+    },
+    {
+      0x40, 0x57, 0x8f, 0xfa, 0x52, 0xbf, 0x51, 0xae, 0x18, 0x66, 0xf4, 0x28, 0x4d, 0x3a, 0x15, 0x7f,
+      0xc1, 0xbc, 0xd3, 0x6a, 0xc1, 0x3c, 0xbd, 0xcb, 0x03, 0x77, 0xe4, 0xd0, 0xcd, 0x0b, 0x66, 0x03
+    } },
+  { 2,
+    {
+      0xef, 0x8c, 0xda, 0x96, 0x35, 0xd5, 0x06, 0x3a, 0xf8, 0x11, 0x15, 0xda, 0x3c, 0x52, 0x32, 0x5a,
+      0x86, 0xe8, 0x40, 0x74, 0xf9, 0xf7, 0x24, 0xb7, 0xcb, 0xd0, 0xb0, 0x85, 0x6f, 0xf0, 0x01, 0x77,
+      0xcd, 0xd2, 0x83, 0xc2, 0x98, 0x32, 0x6c, 0xd0, 0x91, 0x77, 0x54, 0xc5, 0x24, 0x1f, 0x14, 0x80,
+      0xfb, 0x50, 0x9c, 0xf2, 0xd2, 0xc4, 0x49, 0x81, 0x80, 0x77, 0xae, 0x35, 0xfc, 0x33, 0x07, 0x37
+    },
+    {
+      0xd6, 0x22, 0x0c, 0xa1, 0x95, 0xa0, 0xf3, 0x56, 0xa4, 0x79, 0x5e, 0x07, 0x1c, 0xee, 0x1f, 0x54,
+      0x12, 0xec, 0xd9, 0x5d, 0x8a, 0x5e, 0x01, 0xd7, 0xc2, 0xb8, 0x67, 0x50, 0xca, 0x53, 0xd7, 0xf6,
+      0x4c, 0x29, 0xcb, 0xb3, 0xd2, 0x89, 0xc6, 0xf4, 0xec, 0xc6, 0xc0, 0x1e, 0x3c, 0xa9, 0x33, 0x89,
+      0x71, 0x17, 0x03, 0x88, 0xe3, 0xe4, 0x02, 0x28, 0x47, 0x90, 0x06, 0xd1, 0xbb, 0xeb, 0xad, 0x51
+    },
+    {
+      0xda, 0xca, 0xde, 0xce, 0x7a, 0x8e, 0x6b, 0xf3, 0xab, 0xfe, 0x32, 0x4c, 0xa6, 0x95, 0x43, 0x69,
+      0x84, 0xb8, 0x19, 0x5d, 0x29, 0xf6, 0xbb, 0xd8, 0x96, 0xe4, 0x1e, 0x18, 0xe2, 0x1c, 0x91, 0x45
+    },
+    {
+      0x67, 0xe3, 0x09, 0x75, 0x45, 0xba, 0xd7, 0xe8, 0x52, 0xd7, 0x4d, 0x4e, 0xb5, 0x48, 0xec, 0xa7,
+      0xc2, 0x19, 0xc2, 0x02, 0xa7, 0xd0, 0x88, 0xdb, 0x0e, 0xfe, 0xac, 0x0e, 0xac, 0x30, 0x42, 0x49
+    } },
+  { 3,
+    {
+      0x8c, 0xf9, 0x33, 0xa2, 0xd3, 0x61, 0xa3, 0xe6, 0xa1, 0x36, 0xdb, 0xe4, 0xa0, 0x1e, 0x79, 0x03,
+      0x79, 0x7a, 0xd6, 0xce, 0x76, 0x6e, 0x2b, 0x91, 0xb9, 0xb4, 0xa4, 0x03, 0x51, 0x27, 0xd6, 0x5f,
+      0x4b, 0xe8, 0x65, 0x50, 0x11, 0x94, 0x18, 0xe2, 0x2d, 0xa0, 0x0f, 0xd0, 0x6b, 0xf2, 0xb2, 0x75,
+      0x96, 0xb3, 0x7f, 0x06, 0xbe, 0x0a, 0x15, 0x4a, 0xaf, 0x7e, 0xca, 0x54, 0xc4, 0x52, 0x0b, 0x97
+    },
+    {
+      0x30, 0x30, 0x2c, 0x3f, 0xc9, 0x99, 0x06, 0x5d, 0x10, 0xdc, 0x98, 0x2c, 0x8f, 0xee, 0xf4, 0x1b,
+      0xbb, 0x66, 0x42, 0x71, 0x8f, 0x62, 0x4a, 0xf6, 0xe3, 0xea, 0xbe, 0xa0, 0x83, 0xe7, 0xfe, 0x78,
+      0x53, 0x40, 0xdb, 0x4b, 0x08, 0x97, 0xef, 0xff, 0x39, 0xce, 0xe1, 0xdc, 0x1e, 0xb7, 0x37, 0xcd,
+      0x1e, 0xea, 0x0f, 0xe7, 0x53, 0x84, 0x98, 0x4e, 0x7d, 0x8f, 0x44, 0x6f, 0xaa, 0x68, 0x3b, 0x80
+    },
+    {
+      0xed, 0x14, 0x41, 0x3b, 0x40, 0xda, 0x68, 0x9f, 0x1f, 0x7f, 0xed, 0x2b, 0x08, 0xdf, 0xf4, 0x5b,
+      0x80, 0x92, 0xdb, 0x5e, 0xc2, 0xc3, 0x61, 0x0e, 0x02, 0x72, 0x4d, 0x20, 0x2f, 0x42, 0x3c, 0x46
+    },
+    {
+      0x8d, 0xbc, 0xc0, 0x58, 0x9a, 0x3d, 0x17, 0x29, 0x6a, 0x7a, 0x58, 0xe2, 0xf1, 0xef, 0xf0, 0xe2,
+      0xaa, 0x42, 0x10, 0xb5, 0x8d, 0x1f, 0x88, 0xb8, 0x6d, 0x7b, 0xa5, 0xf2, 0x9d, 0xd3, 0xb5, 0x83
+    } },
+  { 64,
+    {
+      0x6b, 0x9d, 0x86, 0xf1, 0x5c, 0x09, 0x0a, 0x00, 0xfc, 0x3d, 0x90, 0x7f, 0x90, 0x6c, 0x5e, 0xb7,
+      0x92, 0x65, 0xe5, 0x8b, 0x88, 0xeb, 0x64, 0x29, 0x4b, 0x4c, 0xc4, 0xe2, 0xb8, 0x9b, 0x1a, 0x7c,
+      0x5e, 0xe3, 0x12, 0x7e, 0xd2, 0x1b, 0x45, 0x68, 0x62, 0xde, 0x6b, 0x2a, 0xbd, 0xa5, 0x9e, 0xaa,
+      0xcf, 0x2d, 0xcb, 0xe9, 0x22, 0xca, 0x75, 0x5e, 0x40, 0x73, 0x5b, 0xe8, 0x1d, 0x9c, 0x88, 0xa5
+    },
+    {
+      0x22, 0xb8, 0x24, 0x9e, 0xaf, 0x72, 0x29, 0x64, 0xce, 0x42, 0x4f, 0x71, 0xa7, 0x4d, 0x03, 0x8f,
+      0xf9, 0xb6, 0x15, 0xfb, 0xa5, 0xc7, 0xc2, 0x2c, 0xb6, 0x27, 0x97, 0xf5, 0x39, 0x82, 0x24, 0xc3,
+      0xf0, 0x72, 0xeb, 0xc1, 0xda, 0xcb, 0xa3, 0x2f, 0xc6, 0xf6, 0x63, 0x60, 0xb3, 0xe1, 0x65, 0x8d,
+      0x0f, 0xa0, 0xda, 0x1e, 0xd1, 0xc1, 0xda, 0x66, 0x2a, 0x20, 0x37, 0xda, 0x82, 0x3a, 0x33, 0x83
+    },
+    {
+      0x52, 0x60, 0x3b, 0x6c, 0xbf, 0xad, 0x49, 0x66, 0xcb, 0x04, 0x4c, 0xb2, 0x67, 0x56, 0x83, 0x85,
+      0xcf, 0x35, 0xf2, 0x1e, 0x6c, 0x45, 0xcf, 0x30, 0xae, 0xd1, 0x98, 0x32, 0xcb, 0x51, 0xe9, 0xf5
+    },
+    {
+      0x1d, 0x37, 0x01, 0xa5, 0x66, 0x1b, 0xd3, 0x1a, 0xb2, 0x05, 0x62, 0xbd, 0x07, 0xb7, 0x4d, 0xd1,
+      0x9a, 0xc8, 0xf3, 0x52, 0x4b, 0x73, 0xce, 0x7b, 0xc9, 0x96, 0xb7, 0x88, 0xaf, 0xd2, 0xf3, 0x17
+    } },
+  { 128,
+    {
+      0x05, 0xad, 0x0f, 0x27, 0x1f, 0xaf, 0x7e, 0x36, 0x13, 0x20, 0x51, 0x84, 0x52, 0x81, 0x3f, 0xf9,
+      0xfb, 0x99, 0x76, 0xac, 0x37, 0x80, 0x50, 0xb6, 0xee, 0xfb, 0x05, 0xf7, 0x86, 0x7b, 0x57, 0x7b,
+      0x8f, 0x14, 0x47, 0x57, 0x94, 0xcf, 0xf6, 0x1b, 0x2b, 0xc0, 0x62, 0xd3, 0x46, 0xa7, 0xc6, 0x5c,
+      0x6e, 0x00, 0x67, 0xc6, 0x0a, 0x37, 0x4a, 0xf7, 0x94, 0x0f, 0x10, 0xaa, 0x44, 0x9d, 0x5f, 0xb9
+    },
+    {
+      0x92, 0x80, 0xf4, 0xd1, 0x15, 0x70, 0x32, 0xab, 0x31, 0x5c, 0x10, 0x0d, 0x63, 0x62, 0x83, 0xfb,
+      0xf4, 0xfb, 0xa2, 0xfb, 0xad, 0x0f, 0x8b, 0xc0, 0x20, 0x72, 0x1d, 0x76, 0xbc, 0x1c, 0x89, 0x73,
+      0xce, 0xd2, 0x88, 0x71, 0xcc, 0x90, 0x7d, 0xab, 0x60, 0xe5, 0x97, 0x56, 0x98, 0x7b, 0x0e, 0x0f,
+      0x86, 0x7f, 0xa2, 0xfe, 0x9d, 0x90, 0x41, 0xf2, 0xc9, 0x61, 0x80, 0x74, 0xe4, 0x4f, 0xe5, 0xe9
+    },
+    {
+      0x05, 0xcf, 0x3a, 0x90, 0x04, 0x91, 0x16, 0xdc, 0x60, 0xef, 0xc3, 0x15, 0x36, 0xaa, 0xa3, 0xd1,
+      0x67, 0x76, 0x29, 0x94, 0x89, 0x28, 0x76, 0xdc, 0xb7, 0xef, 0x3f, 0xbe, 0xcd, 0x74, 0x49, 0xc0
+    },
+    {
+      0x0c, 0x6c, 0xe3, 0x2a, 0x3e, 0xa0, 0x56, 0x12, 0xc5, 0xf8, 0x09, 0x0f, 0x6a, 0x7e, 0x87, 0xf5,
+      0xab, 0x30, 0xe4, 0x1b, 0x70, 0x7d, 0xcb, 0xe5, 0x41, 0x55, 0x62, 0x0a, 0xd7, 0x70, 0xa3, 0x40
+    } },
+  { 255,
+    {
+      0x3f, 0x35, 0xc4, 0x5d, 0x24, 0xfc, 0xfb, 0x4a, 0xcc, 0xa6, 0x51, 0x07, 0x6c, 0x08, 0x00, 0x0e,
+      0x27, 0x9e, 0xbb, 0xff, 0x37, 0xa1, 0x33, 0x3c, 0xe1, 0x9f, 0xd5, 0x77, 0x20, 0x2d, 0xbd, 0x24,
+      0xb5, 0x8c, 0x51, 0x4e, 0x36, 0xdd, 0x9b, 0xa6, 0x4a, 0xf4, 0xd7, 0x8e, 0xea, 0x4e, 0x2d, 0xd1,
+      0x3b, 0xc1, 0x8d, 0x79, 0x88, 0x87, 0xdd, 0x97, 0x13, 0x76, 0xbc, 0xae, 0x00, 0x87, 0xe1, 0x7e
+    },
+    {
+      0x96, 0xfb, 0xcb, 0xb6, 0x0b, 0xd3, 0x13, 0xb8, 0x84, 0x50, 0x33, 0xe5, 0xbc, 0x05, 0x8a, 0x38,
+      0x02, 0x74, 0x38, 0x57, 0x2d, 0x7e, 0x79, 0x57, 0xf3, 0x68, 0x4f, 0x62, 0x68, 0xaa, 0xdd, 0x3a,
+      0xd0, 0x8d, 0x21, 0x76, 0x7e, 0xd6, 0x87, 0x86, 0x85, 0x33, 0x1b, 0xa9, 0x85, 0x71, 0x48, 0x7e,
+      0x12, 0x47, 0x0a, 0xad, 0x66, 0x93, 0x26, 0x71, 0x6e, 0x46, 0x66, 0x7f, 0x69, 0xf8, 0xd7, 0xe8
+    },
+    {
+      0x25, 0x05, 0x9f, 0x10, 0x60, 0x5e, 0x67, 0xad, 0xfe, 0x68, 0x13, 0x50, 0x66, 0x6e, 0x15, 0xae,
+      0x97, 0x6a, 0x5a, 0x57, 0x1c, 0x13, 0xcf, 0x5b, 0xc8, 0x05, 0x3f, 0x43, 0x0e, 0x12, 0x0a, 0x52
+    },
+    {
+      0x0c, 0x8a, 0x36, 0x59, 0x7d, 0x74, 0x61, 0xc6, 0x3a, 0x94, 0x73, 0x28, 0x21, 0xc9, 0x41, 0x85,
+      0x6c, 0x66, 0x83, 0x76, 0x60, 0x6c, 0x86, 0xa5, 0x2d, 0xe0, 0xee, 0x41, 0x04, 0xc6, 0x15, 0xdb
+    } }
+};
+
+bool check_kat(const char *impl) {
+  uint8_t in[256], out[64];
+  bool ok = true;
+  for (uint32_t i = 0; i < sizeof(in); i++) in[i] = (uint8_t)i;
+  for (size_t i = 0; i < sizeof(kats) / sizeof(kats[0]); i++) {
+    const kat *v = &kats[i];
+    Hacl_Streaming_Blake2_blake2bp(64, out, v->len, in, 0, NULL);
+    ok = ok && memcmp(out, v->bp, 64) == 0;
+    Hacl_Streaming_Blake2_blake2bp(64, out, v->len, in, 64, key);
+    ok = ok && memcmp(out, v->bp_keyed, 64) == 0;
+    Hacl_Streaming_Blake2_blake2sp(32, out, v->len, in, 0, NULL);
+    ok = ok && memcmp(out, v->sp, 32) == 0;
+    Hacl_Streaming_Blake2_blake2sp(32, out, v->len, in, 32, key);
+    ok = ok && memcmp(out, v->sp_keyed, 32) == 0;
+  }
+  printf("BLAKE2bp/BLAKE2sp (%s) known answers: %s\n", impl, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+void perf_one(const char *name, void (*hash)(uint32_t, uint8_t *, uint32_t, uint8_t *, uint32_t, uint8_t *),
+              uint32_t nn, uint8_t *buf) {
+  uint8_t out[64];
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    hash(nn, out, PERF_LEN, buf, 0, NULL);
+    res ^= out[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("%s PERF (1 MiB messages):\n", name);
+  print_time((uint64_t)ROUNDS * PERF_LEN, t2 - t1, b - a);
+  if (res == 256) printf(" ");
+}
+
+void perf(const char *impl) {
+  uint8_t *buf = malloc(PERF_LEN);
+  char name[64];
+  memset(buf, 'P', PERF_LEN);
+  perf_one("BLAKE2b (Hacl_Blake2b_32)", Hacl_Blake2b_32_blake2b, 64, buf);
+#if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_avx2())
+    perf_one("BLAKE2b (Hacl_Blake2b_256)", Hacl_Blake2b_256_blake2b, 64, buf);
+#endif
+  snprintf(name, sizeof(name), "BLAKE2bp (%s)", impl);
+  perf_one(name, Hacl_Streaming_Blake2_blake2bp, 64, buf);
+  perf_one("BLAKE2s (Hacl_Blake2s_32)", Hacl_Blake2s_32_blake2s, 32, buf);
+  snprintf(name, sizeof(name), "BLAKE2sp (%s)", impl);
+  perf_one(name, Hacl_Streaming_Blake2_blake2sp, 32, buf);
+  free(buf);
+}
+
+bool check_all(tree_instance *ts, size_t nt, const char *impl) {
+  bool ok = check_kat(impl);
+  for (size_t i = 0; i < nt; i++) {
+    ok = check_against_reference(&ts[i], impl) && ok;
+    ok = check_streaming(&ts[i], impl) && ok;
+  }
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (uint32_t i = 0; i < MSG_LEN; i++) msg[i] = (uint8_t)(i * 13 + 5);
+  for (uint32_t i = 0; i < sizeof(key); i++) key[i] = (uint8_t)i;
+
+  // The BLAKE2sp state has the same layout, with 32-bit words.
+  tree_instance ts[] = {
+    { "BLAKE2bp", 128, 4, 64, Hacl_Streaming_Blake2_blake2bp_with_key_create_in,
+      Hacl_Streaming_Blake2_blake2bp_with_key_init, Hacl_Streaming_Blake2_blake2bp_with_key_update,
+      Hacl_Streaming_Blake2_blake2bp_with_key_finish, Hacl_Streaming_Blake2_blake2bp_with_key_free,
+      Hacl_Streaming_Blake2_blake2bp },
+    { "BLAKE2sp", 64, 8, 32,
+      (Hacl_Streaming_Blake2_blake2bp_state *(*)(uint32_t, uint8_t *))Hacl_Streaming_Blake2_blake2sp_with_key_create_in,
+      (void (*)(uint32_t, uint8_t *, Hacl_Streaming_Blake2_blake2bp_state *))Hacl_Streaming_Blake2_blake2sp_with_key_init,
+      (void (*)(uint32_t, Hacl_Streaming_Blake2_blake2bp_state *, uint8_t *, uint32_t))Hacl_Streaming_Blake2_blake2sp_with_key_update,
+      (void (*)(uint32_t, Hacl_Streaming_Blake2_blake2bp_state *, uint8_t *))Hacl_Streaming_Blake2_blake2sp_with_key_finish,
+      (void (*)(uint32_t, Hacl_Streaming_Blake2_blake2bp_state *))Hacl_Streaming_Blake2_blake2sp_with_key_free,
+      Hacl_Streaming_Blake2_blake2sp },
+  };
+  size_t nt = sizeof(ts) / sizeof(ts[0]);
+
+  // The no_key variants are the with_key ones at key size 0.
+  uint8_t out[64], expected[64];
+  Hacl_Streaming_Blake2_blake2sp_state *s = Hacl_Streaming_Blake2_blake2sp_no_key_create_in();
+  Hacl_Streaming_Blake2_blake2sp_no_key_update(s, msg, MSG_LEN);
+  Hacl_Streaming_Blake2_blake2sp_no_key_finish(s, out);
+  Hacl_Streaming_Blake2_blake2sp_no_key_free(s);
+  Hacl_Streaming_Blake2_blake2sp(32, expected, MSG_LEN, msg, 0, NULL);
+  bool ok = memcmp(out, expected, 32) == 0;
+  printf("Streaming BLAKE2sp without a key: %s\n", ok ? "Success!" : "**FAILED**");
+
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  ok = check_all(ts, nt, has_avx2 ? "AVX2" : "portable") && ok;
+  perf(has_avx2 ? "AVX2" : "portable");
+  if (has_avx2) {
+    EverCrypt_AutoConfig2_disable_avx2();
+    ok = check_all(ts, nt, "portable") && ok;
+    perf("portable");
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
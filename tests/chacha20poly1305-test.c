@@ -21,6 +21,10 @@
 #include "Hacl_Chacha20Poly1305_256.h"
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+#include "Hacl_Chacha20Poly1305_512.h"
+#endif
+
 #include "EverCrypt_AutoConfig2.h"
 
 #include "chacha20poly1305_vectors.h"
@@ -78,8 +82,60 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, int aad_l
   }
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    Hacl_Chacha20Poly1305_512_aead_encrypt(key, nonce, aad_len, aad, in_len, in, ciphertext, mac);
+    printf("Chacha20Poly1305 (512-bit) Result (chacha20):\n");
+    ok = ok && print_result(in_len,ciphertext,exp_cipher);
+    printf("(poly1305):\n");
+    ok = ok && print_result(16,mac,exp_mac);
+
+    res = Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, aad_len, aad, in_len, plaintext, exp_cipher, exp_mac);
+    if (res != 0) printf("AEAD Decrypt (Chacha20/Poly1305) failed \n.");
+    ok = ok && (res == 0);
+    ok = ok && print_result(in_len,plaintext,in);
+  }
+#endif
+
+  return ok;
+}
+
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+// The test vectors are too short to reach the 16-block ChaCha20 and 8-block
+// Poly1305 loops, so compare against the 32-bit version on every length and
+// AAD length around those boundaries.
+bool test_512_lengths() {
+  uint8_t key[32];
+  uint8_t nonce[12];
+  uint8_t aad[300];
+  uint8_t in[2200];
+  uint8_t c1[2200], c2[2200];
+  uint8_t m1[16], m2[16];
+  for (int i = 0; i < 32; i++) key[i] = (uint8_t)(i * 13 + 1);
+  for (int i = 0; i < 12; i++) nonce[i] = (uint8_t)(i * 5);
+  for (int i = 0; i < 300; i++) aad[i] = (uint8_t)(i * 3 + 7);
+  for (int i = 0; i < 2200; i++) in[i] = (uint8_t)(i * 7 + (i >> 8));
+
+  bool ok = true;
+  uint32_t aad_lens[4] = { 0, 12, 128, 300 };
+  for (int k = 0; k < 4; k++) {
+    for (uint32_t len = 0; len <= 2200; len++) {
+      Hacl_Chacha20Poly1305_32_aead_encrypt(key, nonce, aad_lens[k], aad, len, in, c1, m1);
+      Hacl_Chacha20Poly1305_512_aead_encrypt(key, nonce, aad_lens[k], aad, len, in, c2, m2);
+      ok = ok && memcmp(c1, c2, len) == 0 && memcmp(m1, m2, 16) == 0;
+      ok = ok && Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, aad_lens[k], aad, len, c2, c1, m1) == 0;
+      ok = ok && memcmp(c2, in, len) == 0;
+    }
+  }
+  m1[3] ^= 1;
+  ok = ok && Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, 12, aad, 2200, c2, c1, m1) == 1;
+  if (ok)
+    printf("Chacha20Poly1305 (512-bit) against 32-bit: Success!\n");
+  else
+    printf("Chacha20Poly1305 (512-bit) against 32-bit: **FAILED**\n");
   return ok;
 }
+#endif
 
 int main(){
   EverCrypt_AutoConfig2_init();
@@ -88,6 +144,10 @@ int main(){
   for (int i = 0; i < sizeof(vectors)/sizeof(chacha20poly1305_test_vector); ++i) {
     ok &= print_test(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].aad_len,vectors[i].aad,vectors[i].tag,vectors[i].cipher);
   }
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512())
+    ok &= test_512_lengths();
+#endif
 
   uint8_t plain[SIZE];
   uint8_t cipher[SIZE];
@@ -158,6 +218,27 @@ int main(){
   cycles cdiff3 = b - a;
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    memset(plain,'P',SIZE);
+    memset(aead_key,'K',32);
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_encrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_encrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+      res ^= tag[0] ^ tag[15];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff7 = t2 - t1;
+  cycles cdiff7 = b - a;
+#endif
+
   int res1 = 0;
   for (int j = 0; j < ROUNDS; j++) {
     res1 = Hacl_Chacha20Poly1305_32_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
@@ -218,6 +299,22 @@ int main(){
   cycles cdiff6 = b - a;
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    res1 = 0;
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+      res1 ^= res1;
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff8 = t2 - t1;
+  cycles cdiff8 = b - a;
+#endif
+
   // JP: I don't understand what this does since this variable is almost always
   // zeroed-out.
   printf ("\n res1: %i \n", res1);
@@ -235,6 +332,12 @@ int main(){
     printf("Chacha20Poly1305 Encrypt (256-bit) PERF:\n"); print_time(count,tdiff3,cdiff3);
   }
 #endif
+
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Chacha20Poly1305 Encrypt (512-bit) PERF:\n"); print_time(count,tdiff7,cdiff7);
+  }
+#endif
   printf("Chacha20Poly1305 Decrypt (32-bit) PERF:\n");  print_time(count,tdiff4,cdiff4);
 
 #if defined(EVERCRYPT_CAN_COMPILE_VEC128)
@@ -247,6 +350,12 @@ int main(){
   }
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Chacha20Poly1305 Decrypt (512-bit) PERF:\n"); print_time(count,tdiff8,cdiff8);
+  }
+#endif
+
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
 }
@@ -0,0 +1,109 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Curve25519.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 20000
+
+// RFC 7748, section 6.1
+static uint8_t alice_priv[32] = {
+  0x77, 0x07, 0x6d, 0x0a, 0x73, 0x18, 0xa5, 0x7d, 0x3c, 0x16, 0xc1, 0x72, 0x51, 0xb2, 0x66, 0x45,
+  0xdf, 0x4c, 0x2f, 0x87, 0xeb, 0xc0, 0x99, 0x2a, 0xb1, 0x77, 0xfb, 0xa5, 0x1d, 0xb9, 0x2c, 0x2a
+};
+
+static uint8_t alice_pub[32] = {
+  0x85, 0x20, 0xf0, 0x09, 0x89, 0x30, 0xa7, 0x54, 0x74, 0x8b, 0x7d, 0xdc, 0xb4, 0x3e, 0xf7, 0x5a,
+  0x0d, 0xbf, 0x3a, 0x0d, 0x26, 0x38, 0x1a, 0xf4, 0xeb, 0xa4, 0xa9, 0x8e, 0xaa, 0x9b, 0x4e, 0x6a
+};
+
+static uint8_t bob_priv[32] = {
+  0x5d, 0xab, 0x08, 0x7e, 0x62, 0x4a, 0x8a, 0x4b, 0x79, 0xe1, 0x7f, 0x8b, 0x83, 0x80, 0x0e, 0xe6,
+  0x6f, 0x3b, 0xb1, 0x29, 0x26, 0x18, 0xb6, 0xfd, 0x1c, 0x2f, 0x8b, 0x27, 0xff, 0x88, 0xe0, 0xeb
+};
+
+static uint8_t bob_pub[32] = {
+  0xde, 0x9e, 0xdb, 0x7d, 0x7b, 0x7d, 0xc1, 0xb4, 0xd3, 0x5b, 0x61, 0xc2, 0xec, 0xe4, 0x35, 0x37,
+  0x3f, 0x83, 0x43, 0xc8, 0x5b, 0x78, 0x67, 0x4d, 0xad, 0xfc, 0x7e, 0x14, 0x6f, 0x88, 0x2b, 0x4f
+};
+
+bool check_kat() {
+  uint8_t pub[32];
+  bool ok = true;
+  EverCrypt_Curve25519_secret_to_public(pub, alice_priv);
+  printf("X25519 fixed-base, RFC 7748 Alice:\n");
+  ok = compare_and_print(32, pub, alice_pub) && ok;
+  EverCrypt_Curve25519_secret_to_public(pub, bob_priv);
+  printf("X25519 fixed-base, RFC 7748 Bob:\n");
+  ok = compare_and_print(32, pub, bob_pub) && ok;
+  return ok;
+}
+
+// The comb must agree with the ladder on the base point for any 32 bytes,
+// including the bits that clamping clears.
+bool check_against_ladder() {
+  uint8_t priv[32], pub0[32], pub1[32];
+  bool ok = true;
+  for (uint32_t i = 0; i < 32; i++) priv[i] = (uint8_t)(i * 37 + 11);
+  for (int j = 0; j < 1000; j++) {
+    if (j == 0) memset(priv, 0, 32);
+    if (j == 1) memset(priv, 0xff, 32);
+    Hacl_Curve25519_51_secret_to_public(pub0, priv);
+    Hacl_Ed25519_x25519_secret_to_public(pub1, priv);
+    ok = ok && memcmp(pub0, pub1, 32) == 0;
+    // Next key: the previous public key, perturbed
+    memcpy(priv, pub1, 32);
+    priv[j % 32] ^= (uint8_t)j;
+  }
+  printf("X25519 fixed-base against ladder: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+void perf() {
+  uint8_t priv[32], pub[32];
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+  memset(priv, 'S', 32);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Curve25519_scalarmult(pub, priv, alice_pub);
+    res ^= pub[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("X25519 variable-base PERF (per scalar multiplication):\n");
+  print_time(ROUNDS, t2 - t1, b - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Curve25519_secret_to_public(pub, priv);
+    res ^= pub[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("X25519 fixed-base PERF (per scalar multiplication):\n");
+  print_time(ROUNDS, t2 - t1, b - a);
+  if (res == 256) printf(" ");
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+
+  bool ok = check_kat();
+  ok = check_against_ladder() && ok;
+
+  perf();
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
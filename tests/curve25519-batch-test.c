@@ -0,0 +1,110 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Curve25519.h"
+
+#include "test_helpers.h"
+#include "curve25519_vectors.h"
+
+#define MAX_N 64
+#define ROUNDS 4000
+
+static uint8_t priv[MAX_N * 32], pub[MAX_N * 32], out[MAX_N * 32];
+
+// RFC 7748 vectors, packed into one batch that covers a full group and a tail.
+bool check_kat() {
+  size_t nv = sizeof(vectors) / sizeof(curve25519_test_vector);
+  uint32_t n = 6;
+  for (uint32_t i = 0; i < n; i++) {
+    memcpy(priv + 32 * i, vectors[i % nv].scalar, 32);
+    memcpy(pub + 32 * i, vectors[i % nv].public, 32);
+  }
+  EverCrypt_Curve25519_scalarmult_batch(out, priv, pub, n);
+  bool ok = true;
+  for (uint32_t i = 0; i < n; i++) {
+    ok = ok && memcmp(out + 32 * i, vectors[i % nv].secret, 32) == 0;
+  }
+  printf("Curve25519 batch, RFC 7748 vectors: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Every batch size up to two groups plus a larger one must agree with single
+// calls, including u-coordinates at and above p and with the top bit set.
+bool check_against_single(const char *name,
+                          void (*batch)(uint8_t *, uint8_t *, uint8_t *, uint32_t)) {
+  static const uint32_t sizes[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, MAX_N };
+  uint8_t r[32];
+  for (uint32_t i = 0; i < sizeof(priv); i++) priv[i] = (uint8_t)(i * 13 + 7);
+  for (uint32_t i = 0; i < sizeof(pub); i++) pub[i] = (uint8_t)(i * 29 + 3);
+  memset(pub, 0, 32);
+  memset(pub + 32, 0, 32); pub[32] = 1;
+  memset(pub + 64, 0xff, 32); pub[64] = 0xec; pub[95] = 0x7f;
+  memset(pub + 96, 0xff, 32);
+  memset(pub + 128, 0xff, 32); pub[128] = 0xed; pub[159] = 0x7f;
+  memset(pub + 160, 0xff, 32); pub[160] = 0xee; pub[191] = 0x7f;
+
+  bool ok = true;
+  for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+    uint32_t n = sizes[k];
+    memset(out, 0, sizeof(out));
+    batch(out, priv, pub, n);
+    for (uint32_t i = 0; i < n; i++) {
+      Hacl_Curve25519_51_scalarmult(r, priv + 32 * i, pub + 32 * i);
+      ok = ok && memcmp(r, out + 32 * i, 32) == 0;
+    }
+  }
+  printf("%s against single calls: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+void perf() {
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_Curve25519_scalarmult(out, priv, pub);
+    res ^= out[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Curve25519 single PERF (per scalar multiplication):\n");
+  print_time(ROUNDS, t2 - t1, b - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / MAX_N; j++) {
+    EverCrypt_Curve25519_scalarmult_batch(out, priv, pub, MAX_N);
+    res ^= out[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("Curve25519 batch of %d PERF (per scalar multiplication):\n", MAX_N);
+  print_time(ROUNDS / MAX_N * MAX_N, t2 - t1, b - a);
+  if (res == 256) printf(" ");
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+
+  bool ok = check_kat();
+  ok = check_against_single("EverCrypt_Curve25519_scalarmult_batch",
+                            EverCrypt_Curve25519_scalarmult_batch) && ok;
+#if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_avx2())
+    ok = check_against_single("Hacl_Curve25519_Vec256_scalarmult_batch",
+                              Hacl_Curve25519_Vec256_scalarmult_batch) && ok;
+#endif
+
+  perf();
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -66,6 +66,71 @@ bool test_nist()
 }
 
 
+static uint8_t g_x[32] = {
+	0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40, 0xf2,
+	0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2, 0x96
+};
+
+static uint8_t g_y[32] = {
+	0x4f, 0xe3, 0x42, 0xe2, 0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a, 0x7c, 0x0f, 0x9e, 0x16,
+	0x2b, 0xce, 0x33, 0x57, 0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68, 0x37, 0xbf, 0x51, 0xf5
+};
+
+static uint8_t neg_g_y[32] = {
+	0xb0, 0x1c, 0xbd, 0x1c, 0x01, 0xe5, 0x80, 0x65, 0x71, 0x18, 0x14, 0xb5, 0x83, 0xf0, 0x61, 0xe9,
+	0xd4, 0x31, 0xcc, 0xa9, 0x94, 0xce, 0xa1, 0x31, 0x34, 0x49, 0xbf, 0x97, 0xc8, 0x40, 0xae, 0x0a
+};
+
+/* (2^256 - 1) * G = (2^256 - 1 - n) * G */
+static uint8_t max_x[32] = {
+	0xf7, 0x2c, 0xbd, 0x24, 0x0e, 0x26, 0xc0, 0xd2, 0x1b, 0x10, 0x23, 0x17, 0x95, 0x86, 0xeb, 0x53,
+	0x2c, 0x61, 0x02, 0xc4, 0x9c, 0x36, 0x77, 0xcc, 0x1a, 0x3d, 0x13, 0x2b, 0x9d, 0xb9, 0xd3, 0x1a
+};
+
+static uint8_t max_y[32] = {
+	0x43, 0xe4, 0xca, 0x77, 0xe2, 0xa3, 0x66, 0x21, 0xdc, 0x0d, 0xbd, 0x91, 0xbf, 0xe7, 0xa5, 0xd2,
+	0x23, 0x25, 0x0e, 0xf0, 0xcd, 0xca, 0x83, 0x1e, 0xe4, 0x53, 0xd9, 0x3f, 0xa8, 0x34, 0x08, 0xa7
+};
+
+static uint8_t order[32] = {
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51
+};
+
+/* Scalars at the edges of the fixed-base comb: 0 and n give the point at
+   infinity, the others wrap around the group order. */
+bool test_fixed_base_edges()
+{
+	uint8_t result[64];
+	uint8_t scalar[32];
+	bool ok = true;
+
+	printf("%s\n", "ECDH fixed-base edge cases: \n");
+
+	memset(scalar, 0, 32);
+	ok = ok && !Hacl_P256_ecp256dh_i(result, scalar);
+	ok = ok && !Hacl_P256_ecp256dh_i(result, order);
+
+	scalar[31] = 1;
+	ok = ok && Hacl_P256_ecp256dh_i(result, scalar);
+	ok = ok && compare_and_print(32, result, g_x) && compare_and_print(32, result + 32, g_y);
+
+	memcpy(scalar, order, 32);
+	scalar[31] = order[31] + 1;
+	ok = ok && Hacl_P256_ecp256dh_i(result, scalar);
+	ok = ok && compare_and_print(32, result, g_x) && compare_and_print(32, result + 32, g_y);
+
+	scalar[31] = order[31] - 1;
+	ok = ok && Hacl_P256_ecp256dh_i(result, scalar);
+	ok = ok && compare_and_print(32, result, g_x) && compare_and_print(32, result + 32, neg_g_y);
+
+	memset(scalar, 0xff, 32);
+	ok = ok && Hacl_P256_ecp256dh_i(result, scalar);
+	ok = ok && compare_and_print(32, result, max_x) && compare_and_print(32, result + 32, max_y);
+
+	return ok;
+}
+
 bool test_compression()
 {
 	// The start of compression tests
@@ -222,6 +287,11 @@ int main()
   		printf("%s\n", "ECDH NIST tests have failed");
     	return EXIT_FAILURE;
     }
+  if (!test_fixed_base_edges())
+  	{
+  		printf("%s\n", "ECDH fixed-base tests have failed");
+    	return EXIT_FAILURE;
+    }
   if (!test_compression())
      {
   		printf("%s\n", "ECDSA Compression tests have failed");
@@ -0,0 +1,219 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "test_helpers.h"
+
+#include "EverCrypt_Ed25519.h"
+
+#define ROUNDS 100
+#define BATCH  64
+#define MSGLEN 64
+
+// RFC 8032, Section 7.1, TEST 1
+static uint8_t sk1[32] = {
+  0x9d, 0x61, 0xb1, 0x9d, 0xef, 0xfd, 0x5a, 0x60, 0xba, 0x84, 0x4a, 0xf4, 0x92, 0xec, 0x2c, 0xc4,
+  0x44, 0x49, 0xc5, 0x69, 0x7b, 0x32, 0x69, 0x19, 0x70, 0x3b, 0xac, 0x03, 0x1c, 0xae, 0x7f, 0x60
+};
+static uint8_t pk1[32] = {
+  0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7, 0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a,
+  0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25, 0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a
+};
+static uint8_t sig1[64] = {
+  0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72, 0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+  0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74, 0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+  0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac, 0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+  0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24, 0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b
+};
+
+static uint8_t sks[BATCH][32];
+static uint8_t pks[BATCH][32];
+static uint8_t msgs_[BATCH][MSGLEN];
+static uint8_t sigs[BATCH][64];
+
+static uint8_t *pk_ptrs[BATCH];
+static uint8_t *msg_ptrs[BATCH];
+static uint8_t *sig_ptrs[BATCH];
+static uint32_t msg_lens[BATCH];
+
+bool test_vector() {
+  uint8_t pk[32];
+  uint8_t sig[64];
+  EverCrypt_Ed25519_secret_to_public(pk, sk1);
+  printf("Ed25519 secret_to_public:\n");
+  bool ok = compare_and_print(32, pk, pk1);
+  EverCrypt_Ed25519_sign(sig, sk1, 0, NULL);
+  printf("Ed25519 sign:\n");
+  ok = compare_and_print(64, sig, sig1) && ok;
+  ok = EverCrypt_Ed25519_verify(pk1, 0, NULL, sig1) && ok;
+  return ok;
+}
+
+bool check_batch(uint32_t n, bool *expected) {
+  bool results[BATCH];
+  bool all = true;
+  for (uint32_t i = 0; i < n; i++)
+    all = all && expected[i];
+  bool ok = EverCrypt_Ed25519_verify_batch(n, pk_ptrs, msg_lens, msg_ptrs, sig_ptrs, results) == all;
+  for (uint32_t i = 0; i < n; i++) {
+    ok = ok && results[i] == expected[i];
+    ok = ok && EverCrypt_Ed25519_verify(pk_ptrs[i], msg_lens[i], msg_ptrs[i], sig_ptrs[i]) == expected[i];
+  }
+  return ok;
+}
+
+bool test_batch() {
+  bool expected[BATCH];
+  for (uint32_t i = 0; i < BATCH; i++) {
+    memset(sks[i], (int)i + 1, 32);
+    for (uint32_t j = 0; j < MSGLEN; j++)
+      msgs_[i][j] = (uint8_t)(i * 7 + j);
+    EverCrypt_Ed25519_secret_to_public(pks[i], sks[i]);
+    msg_lens[i] = i % (MSGLEN + 1);
+    EverCrypt_Ed25519_sign(sigs[i], sks[i], msg_lens[i], msgs_[i]);
+    pk_ptrs[i] = pks[i];
+    msg_ptrs[i] = msgs_[i];
+    sig_ptrs[i] = sigs[i];
+    expected[i] = true;
+  }
+
+  bool ok = true;
+  ok = ok && check_batch(0, expected);
+  ok = ok && check_batch(1, expected);
+  ok = ok && check_batch(BATCH, expected);
+
+  // A forged S, a message/key mismatch, and an S >= q must all be singled out.
+  sigs[3][40] ^= 0x01;
+  expected[3] = false;
+  pk_ptrs[10] = pks[11];
+  expected[10] = false;
+  memset(sigs[42] + 32, 0xff, 32);
+  expected[42] = false;
+  ok = ok && check_batch(BATCH, expected);
+
+  if (ok)
+    printf("Ed25519 batch verification: Success!\n");
+  else
+    printf("Ed25519 batch verification: **FAILED**\n");
+  return ok;
+}
+
+// Signs with the scalar of sk1 under the public key A' = A + T, where T = (0, -1)
+// has order 2, so that [S]B - [k]A' = R + [k mod 2]T. For even k both equations
+// hold; for odd k only the cofactored one does. Such an entry must be accepted by
+// the batch whatever the other entries are, while EverCrypt_Ed25519_verify
+// rejects it.
+bool test_small_order() {
+  uint8_t ks[96];
+  uint8_t pk[32];
+  uint8_t msg[1];
+  uint8_t sig[64];
+  uint8_t *pk_ptr = pk;
+  uint8_t *msg_ptr = msg;
+  uint8_t *sig_ptr = sig;
+  uint32_t msg_len = 1;
+  bool results[2];
+
+  // A + (0, -1) = (-x, -y): encode p - y and flip the sign of x.
+  EverCrypt_Ed25519_expand_keys(ks, sk1);
+  int borrow = 0;
+  for (uint32_t i = 0; i < 32; i++) {
+    int pi = i == 0 ? 0xed : (i == 31 ? 0x7f : 0xff);
+    int yi = i == 31 ? ks[i] & 0x7f : ks[i];
+    int d = pi - yi - borrow;
+    borrow = d < 0;
+    pk[i] = (uint8_t)d;
+  }
+  pk[31] |= (ks[31] & 0x80) ^ 0x80;
+  memcpy(ks, pk, 32);
+
+  bool ok = true;
+  bool seen_odd = false;
+  bool seen_even = false;
+  for (uint32_t m = 0; m < 16; m++) {
+    msg[0] = (uint8_t)m;
+    EverCrypt_Ed25519_sign_expanded(sig, ks, msg_len, msg);
+    bool single = EverCrypt_Ed25519_verify(pk, msg_len, msg, sig);
+    seen_odd = seen_odd || !single;
+    seen_even = seen_even || single;
+    ok = ok && EverCrypt_Ed25519_verify_batch(1, &pk_ptr, &msg_len, &msg_ptr, &sig_ptr, results);
+    ok = ok && results[0];
+
+    // Next to a bad entry, the combined check fails and the entry is re-checked
+    // on its own: the verdict must not change.
+    uint8_t *pks2[2] = { pk, pk1 };
+    uint8_t *msgs2[2] = { msg, msg };
+    uint8_t *sigs2[2] = { sig, sig1 };
+    uint32_t lens2[2] = { msg_len, msg_len };
+    ok = ok && !EverCrypt_Ed25519_verify_batch(2, pks2, lens2, msgs2, sigs2, results);
+    ok = ok && results[0] && !results[1];
+  }
+  ok = ok && seen_odd && seen_even;
+
+  if (ok)
+    printf("Ed25519 batch verification (small-order component): Success!\n");
+  else
+    printf("Ed25519 batch verification (small-order component): **FAILED**\n");
+  return ok;
+}
+
+int main() {
+  bool ok = test_vector();
+  ok = test_batch() && ok;
+  ok = test_small_order() && ok;
+
+  // Re-sign so that the whole batch is valid again for the benchmark.
+  pk_ptrs[10] = pks[10];
+  EverCrypt_Ed25519_sign(sigs[3], sks[3], msg_lens[3], msgs_[3]);
+  EverCrypt_Ed25519_sign(sigs[42], sks[42], msg_lens[42], msgs_[42]);
+
+  bool results[BATCH];
+  bool res = true;
+  cycles a,b;
+  clock_t t1,t2;
+
+  uint8_t sig[64];
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < BATCH; i++)
+      EverCrypt_Ed25519_sign(sig, sks[i], msg_lens[i], msg_ptrs[i]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff0 = t2 - t1;
+  cycles cdiff0 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < BATCH; i++)
+      res &= EverCrypt_Ed25519_verify(pk_ptrs[i], msg_lens[i], msg_ptrs[i], sig_ptrs[i]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    res &= EverCrypt_Ed25519_verify_batch(BATCH, pk_ptrs, msg_lens, msg_ptrs, sig_ptrs, results);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  ok = ok && res;
+  uint64_t count = ROUNDS * BATCH;
+  printf("Ed25519 sign PERF (per signature):\n"); print_time(count,tdiff0,cdiff0);
+  printf("Ed25519 verify PERF (per signature):\n"); print_time(count,tdiff1,cdiff1);
+  printf("Ed25519 verify_batch PERF (per signature):\n"); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,180 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_HKDF.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 1000000
+
+static uint8_t key[200], data[300];
+
+// RFC 4231, test case 2
+static uint8_t rfc4231_tc2_256[32] = {
+  0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+  0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+};
+
+static uint8_t rfc4231_tc2_512[64] = {
+  0x16, 0x4b, 0x7a, 0x7b, 0xfc, 0xf8, 0x19, 0xe2, 0xe3, 0x95, 0xfb, 0xe7, 0x3b, 0x56, 0xe0, 0xa3,
+  0x87, 0xbd, 0x64, 0x22, 0x2e, 0x83, 0x1f, 0xd6, 0x10, 0x27, 0x0c, 0xd7, 0xea, 0x25, 0x05, 0x54,
+  0x97, 0x58, 0xbf, 0x75, 0xc0, 0x5a, 0x99, 0x4a, 0x6d, 0x03, 0x4f, 0x65, 0xf8, 0xf0, 0xe6, 0xfd,
+  0xca, 0xea, 0xb1, 0xa3, 0x4d, 0x4a, 0x6b, 0x4b, 0x63, 0x6e, 0x07, 0x0a, 0x38, 0xbc, 0xe7, 0x37
+};
+
+// RFC 5869, test case 1
+static uint8_t rfc5869_tc1_okm[42] = {
+  0x3c, 0xb2, 0x5f, 0x25, 0xfa, 0xac, 0xd5, 0x7a, 0x90, 0x43, 0x4f, 0x64, 0xd0, 0x36, 0x2f, 0x2a,
+  0x2d, 0x2d, 0x0a, 0x90, 0xcf, 0x1a, 0x5a, 0x4c, 0x5d, 0xb0, 0x2d, 0x56, 0xec, 0xc4, 0xc5, 0xbf,
+  0x34, 0x00, 0x72, 0x08, 0xd5, 0xb8, 0x87, 0x18, 0x58, 0x65
+};
+
+bool check_kat() {
+  uint8_t mac[64];
+  bool ok = true;
+  EverCrypt_HMAC_ctx_s *ctx =
+    EverCrypt_HMAC_key_init(Spec_Hash_Definitions_SHA2_256, (uint8_t *)"Jefe", 4);
+  EverCrypt_HMAC_compute_with_ctx(ctx, mac, (uint8_t *)"what do ya want for nothing?", 28);
+  printf("HMAC-SHA2-256 with context, RFC 4231 test case 2:\n");
+  ok = compare_and_print(32, mac, rfc4231_tc2_256) && ok;
+  EverCrypt_HMAC_ctx_free(ctx);
+
+  ctx = EverCrypt_HMAC_key_init(Spec_Hash_Definitions_SHA2_512, (uint8_t *)"Jefe", 4);
+  EverCrypt_HMAC_compute_with_ctx(ctx, mac, (uint8_t *)"what do ya want for nothing?", 28);
+  printf("HMAC-SHA2-512 with context, RFC 4231 test case 2:\n");
+  ok = compare_and_print(64, mac, rfc4231_tc2_512) && ok;
+  EverCrypt_HMAC_ctx_free(ctx);
+
+  uint8_t ikm[22], salt[13], info[10], prk[32], okm[42];
+  memset(ikm, 0x0b, 22);
+  for (int i = 0; i < 13; i++) salt[i] = i;
+  for (int i = 0; i < 10; i++) info[i] = 0xf0 + i;
+  EverCrypt_HKDF_extract_sha2_256(prk, salt, 13, ikm, 22);
+  EverCrypt_HKDF_expand_sha2_256(okm, prk, 32, info, 10, 42);
+  printf("HKDF-SHA2-256, RFC 5869 test case 1:\n");
+  ok = compare_and_print(42, okm, rfc5869_tc1_okm) && ok;
+  return ok;
+}
+
+// The context must agree with the one-shot function for every supported hash,
+// including keys longer than a block and empty messages.
+bool check_alg(const char *name, Spec_Hash_Definitions_hash_alg a) {
+  static const uint32_t key_lens[] = { 0, 1, 20, 64, 65, 128, 129, 200 };
+  static const uint32_t data_lens[] = { 0, 1, 55, 56, 64, 111, 112, 128, 300 };
+  uint8_t mac0[64], mac1[64];
+  uint32_t hlen = Hacl_Hash_Definitions_hash_len(a);
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(key_lens) / sizeof(key_lens[0]); i++) {
+    EverCrypt_HMAC_ctx_s ctx;
+    EverCrypt_HMAC_key_init_into(&ctx, a, key, key_lens[i]);
+    for (size_t j = 0; j < sizeof(data_lens) / sizeof(data_lens[0]); j++) {
+      EverCrypt_HMAC_compute(a, mac0, key, key_lens[i], data, data_lens[j]);
+      EverCrypt_HMAC_compute_with_ctx(&ctx, mac1, data, data_lens[j]);
+      ok = ok && memcmp(mac0, mac1, hlen) == 0;
+    }
+  }
+  // Output aliasing the input, as in the DRBG loop
+  uint8_t v[64];
+  memcpy(v, data, hlen);
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, a, key, 32);
+  EverCrypt_HMAC_compute(a, mac0, key, 32, v, hlen);
+  EverCrypt_HMAC_compute_with_ctx(&ctx, v, v, hlen);
+  ok = ok && memcmp(mac0, v, hlen) == 0;
+
+  printf("HMAC-%s context against one-shot: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Feeds data in uneven chunks and checks the MAC of every prefix reached, which
+// also checks that finish leaves the state usable.
+bool check_incremental(const char *name, Spec_Hash_Definitions_hash_alg a) {
+  static const uint32_t chunks[] = { 0, 1, 3, 60, 64, 5, 128, 39 };
+  static const uint32_t key_lens[] = { 0, 32, 200 };
+  uint8_t mac0[64], mac1[64];
+  uint32_t hlen = Hacl_Hash_Definitions_hash_len(a);
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(key_lens) / sizeof(key_lens[0]); i++) {
+    EverCrypt_HMAC_Incremental_state_s *s =
+      EverCrypt_HMAC_Incremental_create_in(a, key, key_lens[i]);
+    for (int round = 0; round < 2; round++) {
+      uint32_t off = 0;
+      for (size_t j = 0; j < sizeof(chunks) / sizeof(chunks[0]); j++) {
+        EverCrypt_HMAC_Incremental_update(s, data + off, chunks[j]);
+        off += chunks[j];
+        EverCrypt_HMAC_Incremental_finish(s, mac1);
+        EverCrypt_HMAC_compute(a, mac0, key, key_lens[i], data, off);
+        ok = ok && memcmp(mac0, mac1, hlen) == 0;
+      }
+      EverCrypt_HMAC_Incremental_init(s);
+    }
+    EverCrypt_HMAC_Incremental_free(s);
+  }
+  printf("HMAC-%s incremental against one-shot: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+void perf() {
+  uint8_t mac[32];
+  int res = 0;
+  cycles c0, c1;
+  clock_t t1, t2;
+  uint64_t count = (uint64_t)ROUNDS * 32;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute_sha2_256(mac, key, 32, data, 32);
+    res ^= mac[0];
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("HMAC-SHA2-256 one-shot (32-byte messages) PERF:\n");
+  print_time(count, t2 - t1, c1 - c0);
+
+  EverCrypt_HMAC_ctx_s ctx;
+  EverCrypt_HMAC_key_init_into(&ctx, Spec_Hash_Definitions_SHA2_256, key, 32);
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    EverCrypt_HMAC_compute_with_ctx(&ctx, mac, data, 32);
+    res ^= mac[0];
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("HMAC-SHA2-256 with context (32-byte messages) PERF:\n");
+  print_time(count, t2 - t1, c1 - c0);
+  if (res == 256) printf(" ");
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (uint32_t i = 0; i < sizeof(key); i++) key[i] = (uint8_t)(i * 11 + 5);
+  for (uint32_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i * 7 + 1);
+
+  bool ok = check_kat();
+  ok = check_alg("SHA1", Spec_Hash_Definitions_SHA1) && ok;
+  ok = check_alg("SHA2-256", Spec_Hash_Definitions_SHA2_256) && ok;
+  ok = check_alg("SHA2-384", Spec_Hash_Definitions_SHA2_384) && ok;
+  ok = check_alg("SHA2-512", Spec_Hash_Definitions_SHA2_512) && ok;
+  ok = check_alg("BLAKE2s", Spec_Hash_Definitions_Blake2S) && ok;
+  ok = check_alg("BLAKE2b", Spec_Hash_Definitions_Blake2B) && ok;
+
+  ok = check_incremental("SHA1", Spec_Hash_Definitions_SHA1) && ok;
+  ok = check_incremental("SHA2-256", Spec_Hash_Definitions_SHA2_256) && ok;
+  ok = check_incremental("SHA2-384", Spec_Hash_Definitions_SHA2_384) && ok;
+  ok = check_incremental("SHA2-512", Spec_Hash_Definitions_SHA2_512) && ok;
+  ok = check_incremental("BLAKE2s", Spec_Hash_Definitions_Blake2S) && ok;
+  ok = check_incremental("BLAKE2b", Spec_Hash_Definitions_Blake2B) && ok;
+
+  perf();
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <assert.h>
+#include <unistd.h>
 
 #include "EverCrypt_AutoConfig2.h"
 #include "MerkleTree.h"
@@ -32,6 +33,412 @@ void print_tree(const mt_p mt, size_t num_elts) {
   }
 }
 
+// Batch insertion must produce the same tree as inserting one by one,
+// including on a partially flushed tree and across several batches.
+bool test_insert_batch(uint32_t num_elts, uint32_t batch, uint64_t flush_to) {
+  uint8_t *ih = mt_init_hash(hash_size);
+  mt_p mt1 = mt_create(ih);
+  mt_p mt2 = mt_create(ih);
+  mt_free_hash(ih);
+
+  uint8_t *vs = malloc(num_elts * hash_size);
+  for (uint32_t i = 0; i < num_elts; i++)
+    for (uint32_t k = 0; k < hash_size; k++)
+      vs[i * hash_size + k] = (uint8_t)(i * 13 + k + (i >> 8));
+
+  uint8_t *hash = mt_init_hash(hash_size);
+  for (uint32_t i = 0; i < num_elts; i++) {
+    memcpy(hash, vs + i * hash_size, hash_size);
+    mt_insert(mt1, hash);
+    if (i + 1 == flush_to)
+      mt_flush_to(mt1, flush_to);
+  }
+  mt_free_hash(hash);
+
+  for (uint32_t i = 0; i < num_elts; i += batch) {
+    uint32_t n = num_elts - i < batch ? num_elts - i : batch;
+    // Flush at the same point as above so that the trees are comparable.
+    if (i < flush_to && flush_to < i + n) {
+      mt_insert_batch(mt2, vs + i * hash_size, flush_to - i);
+      mt_flush_to(mt2, flush_to);
+      mt_insert_batch(mt2, vs + flush_to * hash_size, i + n - flush_to);
+    } else {
+      if (!mt_insert_batch_pre(mt2, vs + i * hash_size, n))
+        return false;
+      mt_insert_batch(mt2, vs + i * hash_size, n);
+      if (i + n == flush_to)
+        mt_flush_to(mt2, flush_to);
+    }
+  }
+
+  uint8_t *r1 = mt_init_hash(hash_size);
+  uint8_t *r2 = mt_init_hash(hash_size);
+  mt_get_root(mt1, r1);
+  mt_get_root(mt2, r2);
+  bool ok = memcmp(r1, r2, hash_size) == 0;
+
+  for (uint64_t k = flush_to; ok && k <= num_elts; k += 1 + num_elts / 16) {
+    MerkleTree_Low_path *p = mt_init_path(hash_size);
+    uint32_t j = mt_get_path(mt2, k, p, r2);
+    ok = mt_verify(mt2, k, j, p, r2) && memcmp(r1, r2, hash_size) == 0;
+    mt_free_path(p);
+  }
+
+  mt_free_hash(r1);
+  mt_free_hash(r2);
+  free(vs);
+  mt_free(mt1);
+  mt_free(mt2);
+  printf("Batch insertion of %u hashes in batches of %u (flushed to %lu): %s\n",
+         num_elts, batch, flush_to, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+bool same_root(mt_p mt1, mt_p mt2) {
+  uint8_t *r1 = mt_init_hash(hash_size);
+  uint8_t *r2 = mt_init_hash(hash_size);
+  mt_get_root(mt1, r1);
+  mt_get_root(mt2, r2);
+  bool ok = memcmp(r1, r2, hash_size) == 0;
+  mt_free_hash(r1);
+  mt_free_hash(r2);
+  return ok;
+}
+
+void remove_mmap_dir(const char *dir) {
+  char path[128];
+  for (uint32_t lv = 0; lv < 32; lv++) {
+    snprintf(path, sizeof path, "%s/level.%u", dir, lv);
+    unlink(path);
+  }
+  snprintf(path, sizeof path, "%s/meta", dir);
+  unlink(path);
+  rmdir(dir);
+}
+
+// Compares a memory-mapped tree against a heap tree built from the same
+// hashes.
+bool test_mmap(uint32_t num_elts, uint32_t batch, uint64_t flush_to, uint64_t retract_to) {
+  char dir[] = "/tmp/merkle_tree_test.XXXXXX";
+  if (mkdtemp(dir) == NULL)
+    return false;
+
+  uint8_t *ih = mt_init_hash(hash_size);
+  mt_p mt1 = mt_create(ih);
+  mt_p mt2 = mt_create_mmap(dir, ih);
+  bool ok = mt2 != NULL && mt_create_mmap(dir, ih) == NULL;
+  mt_free_hash(ih);
+  if (!ok) {
+    remove_mmap_dir(dir);
+    return false;
+  }
+
+  uint8_t *vs = malloc(num_elts * hash_size);
+  for (uint32_t i = 0; i < num_elts; i++)
+    for (uint32_t k = 0; k < hash_size; k++)
+      vs[i * hash_size + k] = (uint8_t)(i * 29 + k + (i >> 8));
+
+  // Single insertions into the heap tree, batches into the mapped one.
+  // mt_insert uses its argument as scratch space, hence the copies.
+  uint8_t *hash = mt_init_hash(hash_size);
+  for (uint32_t i = 0; i < num_elts; i++) {
+    memcpy(hash, vs + i * hash_size, hash_size);
+    mt_insert(mt1, hash);
+  }
+  for (uint32_t i = 0; i < num_elts; i += batch) {
+    uint32_t n = num_elts - i < batch ? num_elts - i : batch;
+    if (i % 2 == 1 && n > 1) {
+      memcpy(hash, vs + i * hash_size, hash_size);
+      ok = mt_try_insert(mt2, hash) && ok;
+      ok = mt_insert_batch(mt2, vs + (i + 1) * hash_size, n - 1) && ok;
+    } else
+      ok = mt_insert_batch(mt2, vs + i * hash_size, n) && ok;
+  }
+  mt_free_hash(hash);
+  mt_flush_to(mt1, flush_to);
+  mt_flush_to(mt2, flush_to);
+  ok = ok && same_root(mt1, mt2);
+
+  // Reopen and check that nothing was lost.
+  mt_free(mt2);
+  mt2 = mt_open_mmap(dir, mt_sha256_compress);
+  ok = ok && mt2 != NULL && mt2->offset == mt1->offset && mt2->i == mt1->i && mt2->j == mt1->j;
+  ok = ok && same_root(mt1, mt2);
+
+  uint8_t *r1 = mt_init_hash(hash_size);
+  uint8_t *r2 = mt_init_hash(hash_size);
+  for (uint64_t k = flush_to; ok && k <= num_elts; k += 1 + num_elts / 16) {
+    MerkleTree_Low_path *p1 = mt_init_path(hash_size);
+    MerkleTree_Low_path *p2 = mt_init_path(hash_size);
+    uint32_t j1 = mt_get_path(mt1, k, p1, r1);
+    uint32_t j2 = mt_get_path(mt2, k, p2, r2);
+    ok = j1 == j2 && mt_verify(mt2, k, j2, p2, r2) && memcmp(r1, r2, hash_size) == 0;
+    ok = ok && p1->hashes.sz == p2->hashes.sz;
+    for (uint32_t s = 0; ok && s < p1->hashes.sz; s++)
+      ok = memcmp(p1->hashes.vs[s], p2->hashes.vs[s], hash_size) == 0;
+    mt_free_path(p1);
+    mt_free_path(p2);
+  }
+  mt_free_hash(r1);
+  mt_free_hash(r2);
+
+  // Retraction, then growth past the retracted point, serialization.
+  mt_retract_to(mt1, retract_to);
+  mt_retract_to(mt2, retract_to);
+  ok = ok && same_root(mt1, mt2);
+  mt_insert_batch(mt1, vs, num_elts);
+  mt_insert_batch(mt2, vs, num_elts);
+  ok = ok && same_root(mt1, mt2) && mt_sync(mt2);
+  uint64_t sz1 = mt_serialize_size(mt1);
+  uint64_t sz2 = mt_serialize_size(mt2);
+  ok = ok && sz1 == sz2;
+  if (ok) {
+    uint8_t *b1 = malloc(sz1);
+    uint8_t *b2 = malloc(sz2);
+    ok = mt_serialize(mt1, b1, sz1) == sz1 && mt_serialize(mt2, b2, sz2) == sz2 &&
+         memcmp(b1, b2, sz1) == 0;
+    free(b1);
+    free(b2);
+  }
+
+  free(vs);
+  mt_free(mt1);
+  if (mt2 != NULL)
+    mt_free(mt2);
+  remove_mmap_dir(dir);
+  printf("Memory-mapped tree with %u hashes in batches of %u (flushed to %lu, retracted to %lu): %s\n",
+         num_elts, batch, flush_to, retract_to, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Compares arena trees against a heap tree built from the same hashes. Two
+// arena trees are alive at once, each with its own address-space reservation;
+// one is filled with mt_insert and batches, the other with a single batch.
+bool test_arena(uint32_t num_elts, uint32_t batch, uint64_t flush_to, uint64_t retract_to) {
+  uint8_t *ih = mt_init_hash(hash_size);
+  mt_p mt1 = mt_create(ih);
+  mt_p mt2 = mt_create_arena(ih);
+  mt_p mt3 = mt_create_arena(ih);
+  mt_free_hash(ih);
+  bool ok = mt2 != NULL && mt3 != NULL && mt2->store != NULL && mt3->store != NULL;
+
+  uint8_t *vs = malloc(num_elts * hash_size);
+  for (uint32_t i = 0; i < num_elts; i++)
+    for (uint32_t k = 0; k < hash_size; k++)
+      vs[i * hash_size + k] = (uint8_t)(i * 31 + k + (i >> 7));
+
+  // mt_insert uses its argument as scratch space, hence the copies.
+  uint8_t *hash = mt_init_hash(hash_size);
+  for (uint32_t i = 0; i < num_elts; i++) {
+    memcpy(hash, vs + i * hash_size, hash_size);
+    mt_insert(mt1, hash);
+  }
+  for (uint32_t i = 0; ok && i < num_elts; i += batch) {
+    uint32_t n = num_elts - i < batch ? num_elts - i : batch;
+    memcpy(hash, vs + i * hash_size, hash_size);
+    mt_insert(mt2, hash);
+    ok = mt_insert_batch(mt2, vs + (i + 1) * hash_size, n - 1);
+  }
+  mt_free_hash(hash);
+  ok = ok && mt_insert_batch(mt3, vs, num_elts) && same_root(mt1, mt2) && same_root(mt1, mt3);
+
+  mt_flush_to(mt1, flush_to);
+  if (ok)
+    mt_flush_to(mt2, flush_to);
+  ok = ok && same_root(mt1, mt2);
+
+  uint8_t *r1 = mt_init_hash(hash_size);
+  uint8_t *r2 = mt_init_hash(hash_size);
+  for (uint64_t k = flush_to; ok && k <= num_elts; k += 1 + num_elts / 16) {
+    MerkleTree_Low_path *p1 = mt_init_path(hash_size);
+    MerkleTree_Low_path *p2 = mt_init_path(hash_size);
+    uint32_t j1 = mt_get_path(mt1, k, p1, r1);
+    uint32_t j2 = mt_get_path(mt2, k, p2, r2);
+    ok = j1 == j2 && mt_verify(mt2, k, j2, p2, r2) && memcmp(r1, r2, hash_size) == 0;
+    ok = ok && p1->hashes.sz == p2->hashes.sz;
+    for (uint32_t s = 0; ok && s < p1->hashes.sz; s++)
+      ok = memcmp(p1->hashes.vs[s], p2->hashes.vs[s], hash_size) == 0;
+    mt_free_path(p1);
+    mt_free_path(p2);
+  }
+  mt_free_hash(r1);
+  mt_free_hash(r2);
+
+  // Retraction, then growth past the retracted point.
+  mt_retract_to(mt1, retract_to);
+  if (ok)
+    mt_retract_to(mt2, retract_to);
+  ok = ok && same_root(mt1, mt2);
+  mt_insert_batch(mt1, vs, num_elts);
+  ok = ok && mt_insert_batch(mt2, vs, num_elts) && same_root(mt1, mt2);
+
+  free(vs);
+  mt_free(mt1);
+  if (mt2 != NULL)
+    mt_free(mt2);
+  if (mt3 != NULL)
+    mt_free(mt3);
+  printf("Arena trees with %u hashes in batches of %u (flushed to %lu, retracted to %lu): %s\n",
+         num_elts, batch, flush_to, retract_to, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Flushing and retracting a memory-mapped tree must not touch what its last
+// mt_sync recorded: a second handle opened before the next sync still sees
+// the old tree, flushed hashes included.
+bool test_mmap_deferred(uint32_t num_elts, uint64_t flush_to, uint64_t retract_to) {
+  char dir[] = "/tmp/merkle_tree_test.XXXXXX";
+  if (mkdtemp(dir) == NULL)
+    return false;
+
+  uint8_t *ih = mt_init_hash(hash_size);
+  mt_p mt1 = mt_create_mmap(dir, ih);
+  mt_free_hash(ih);
+  bool ok = mt1 != NULL;
+  uint8_t *vs = malloc(num_elts * hash_size);
+  for (uint32_t i = 0; i < num_elts; i++)
+    for (uint32_t k = 0; k < hash_size; k++)
+      vs[i * hash_size + k] = (uint8_t)(i * 31 + k);
+  ok = ok && mt_insert_batch(mt1, vs, num_elts) && mt_sync(mt1);
+  uint8_t *root = mt_init_hash(hash_size);
+  if (ok)
+    mt_get_root(mt1, root);
+  uint64_t j = ok ? mt1->j : 0;
+
+  if (ok) {
+    mt_flush_to(mt1, flush_to);
+    mt_retract_to(mt1, retract_to);
+  }
+  mt_p mt2 = ok ? mt_open_mmap(dir, mt_sha256_compress) : NULL;
+  ok = ok && mt2 != NULL && mt2->i == 0 && mt2->j == j;
+  uint8_t *r2 = mt_init_hash(hash_size);
+  for (uint64_t k = 0; ok && k < flush_to; k += 1 + flush_to / 8) {
+    MerkleTree_Low_path *p = mt_init_path(hash_size);
+    uint32_t j2 = mt_get_path(mt2, k, p, r2);
+    ok = mt_verify(mt2, k, j2, p, r2) && memcmp(root, r2, hash_size) == 0;
+    mt_free_path(p);
+  }
+  mt_free_hash(r2);
+  if (mt2 != NULL)
+    mt_free(mt2);
+
+  // Once synced, the flushed and retracted state is the one that reopens.
+  if (mt1 != NULL) {
+    ok = ok && mt_sync(mt1);
+    uint64_t i1 = mt1->i;
+    uint64_t j1 = mt1->j;
+    mt_get_root(mt1, root);
+    mt_free(mt1);
+    mt2 = ok ? mt_open_mmap(dir, mt_sha256_compress) : NULL;
+    ok = ok && mt2 != NULL && mt2->i == i1 && mt2->j == j1;
+    if (mt2 != NULL)
+      mt_free(mt2);
+  }
+
+  mt_free_hash(root);
+  free(vs);
+  remove_mmap_dir(dir);
+  printf("Memory-mapped tree with %u hashes, flushed to %lu and retracted to %lu "
+         "before syncing: %s\n",
+         num_elts, flush_to, retract_to, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Multi-paths for the leaves idx[0..n-1] (sorted) must verify, be no longer
+// than the single paths together, and survive serialization.
+bool check_multipath(mt_p mt, const uint64_t *idx, uint32_t n) {
+  uint8_t *root = mt_init_hash(hash_size);
+  MerkleTree_Low_path *p = mt_init_path(hash_size);
+  if (!mt_get_paths_pre(mt, idx, n, p, root))
+    return false;
+  uint32_t j = mt_get_paths(mt, idx, n, p, root);
+  uint64_t max = mt->offset + j;
+  bool ok = mt_verify_paths_pre(mt, idx, n, max, p, root) &&
+            mt_verify_paths(mt, idx, n, max, p, root);
+
+  uint32_t single = 0;
+  for (uint32_t t = 0; t < n; t++) {
+    MerkleTree_Low_path *p1 = mt_init_path(hash_size);
+    mt_get_path(mt, idx[t], p1, root);
+    single += mt_get_path_length(p1);
+    mt_free_path(p1);
+  }
+  ok = ok && mt_get_path_length(p) <= single;
+
+  uint64_t len = 20 + 4 * n + hash_size * mt_get_path_length(p);
+  uint8_t *buf = malloc(len);
+  uint64_t *idx2 = malloc(n * sizeof(uint64_t));
+  uint32_t n2 = 0;
+  uint64_t max2 = 0;
+  ok = ok && mt_serialize_paths(idx, n, max, p, buf, len) == len;
+  MerkleTree_Low_path *p2 = mt_deserialize_paths(buf, len, idx2, n, &n2, &max2);
+  ok = ok && p2 != NULL && n2 == n && max2 == max && memcmp(idx, idx2, n * sizeof(uint64_t)) == 0;
+  ok = ok && mt_verify_paths(mt, idx2, n2, max2, p2, root);
+  ok = ok && (n < 2 || mt_deserialize_paths(buf, len, idx2, n - 1, &n2, &max2) == NULL);
+
+  // Any altered hash, or a different set of leaves, must be rejected.
+  if (ok && p2 != NULL) {
+    for (uint32_t s = 0; ok && s < p2->hashes.sz; s++) {
+      p2->hashes.vs[s][s % hash_size] ^= 1;
+      ok = !mt_verify_paths(mt, idx2, n2, max2, p2, root);
+      p2->hashes.vs[s][s % hash_size] ^= 1;
+    }
+    if (ok && idx2[n2 - 1] + 1 < max2) {
+      idx2[n2 - 1]++;
+      ok = !mt_verify_paths(mt, idx2, n2, max2, p2, root);
+    }
+  }
+  // A relative index of 0 would name the leaf max itself.
+  memset(buf + 16 + 4 * (n - 1), 0, 4);
+  ok = ok && mt_deserialize_paths(buf, len, idx2, n, &n2, &max2) == NULL;
+
+  if (p2 != NULL) {
+    for (uint32_t s = 0; s < p2->hashes.sz; s++)
+      mt_free_hash(p2->hashes.vs[s]);
+    mt_free_path(p2);
+  }
+  free(idx2);
+  free(buf);
+  mt_free_path(p);
+  mt_free_hash(root);
+  return ok;
+}
+
+bool test_multipath(uint32_t num_elts, uint64_t flush_to, bool arena) {
+  uint8_t *ih = mt_init_hash(hash_size);
+  mt_p mt = arena ? mt_create_arena(ih) : mt_create(ih);
+  mt_free_hash(ih);
+  if (mt == NULL)
+    return false;
+  uint8_t *vs = malloc(num_elts * hash_size);
+  for (uint32_t i = 0; i < num_elts * hash_size; i++)
+    vs[i] = (uint8_t)(i * 7 + (i >> 9));
+  mt_insert_batch(mt, vs, num_elts);
+  mt_flush_to(mt, flush_to);
+  free(vs);
+
+  uint64_t total = num_elts + 1;
+  uint64_t *idx = malloc(total * sizeof(uint64_t));
+  bool ok = true;
+  uint64_t strides[5] = { 1, 2, 3, 17, total };
+  for (uint32_t s = 0; s < 5; s++) {
+    // Every stride-th leaf, a cluster at the right edge, and a single leaf.
+    uint32_t n = 0;
+    for (uint64_t k = flush_to; k < total; k += strides[s])
+      idx[n++] = k;
+    ok = check_multipath(mt, idx, n) && ok;
+    n = 0;
+    for (uint64_t k = total > flush_to + strides[s] ? total - strides[s] : flush_to; k < total; k++)
+      idx[n++] = k;
+    ok = check_multipath(mt, idx, n) && ok;
+  }
+  free(idx);
+  mt_free(mt);
+  printf("Multi-paths in a%s tree of %u hashes (flushed to %lu): %s\n",
+         arena ? "n arena" : "", num_elts + 1, flush_to, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
 int main(int argc, char *argv[]) {
 
   uint64_t num_elts = 1;
@@ -209,5 +616,31 @@ int main(int argc, char *argv[]) {
 
   printf("The Merkle tree is freed\n");
 
+  bool ok = true;
+  ok = test_insert_batch(1, 1, 0) && ok;
+  ok = test_insert_batch(2, 2, 0) && ok;
+  ok = test_insert_batch(100, 7, 0) && ok;
+  ok = test_insert_batch(1000, 1000, 0) && ok;
+  ok = test_insert_batch(1000, 333, 500) && ok;
+  ok = test_insert_batch(5000, 4096, 1234) && ok;
+  ok = test_mmap(1, 1, 0, 0) && ok;
+  ok = test_mmap(100, 7, 0, 50) && ok;
+  ok = test_mmap(5000, 1000, 1234, 3000) && ok;
+  ok = test_mmap(70000, 4096, 40000, 69999) && ok;
+  ok = test_arena(1, 1, 0, 0) && ok;
+  ok = test_arena(100, 7, 0, 50) && ok;
+  ok = test_arena(5000, 1000, 1234, 3000) && ok;
+  ok = test_arena(70000, 4096, 40000, 69999) && ok;
+  ok = test_mmap_deferred(70000, 40000, 50000) && ok;
+  ok = test_multipath(0, 0, false) && ok;
+  ok = test_multipath(1, 0, false) && ok;
+  ok = test_multipath(12, 0, false) && ok;
+  ok = test_multipath(1000, 0, false) && ok;
+  ok = test_multipath(1000, 300, false) && ok;
+  ok = test_multipath(1023, 0, true) && ok;
+  ok = test_multipath(4500, 2000, true) && ok;
+  if (!ok)
+    return 1;
+
   return 0;
 }
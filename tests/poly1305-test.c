@@ -21,6 +21,10 @@
 #include "Hacl_Poly1305_256.h"
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+#include "Hacl_Poly1305_512.h"
+#endif
+
 #include "EverCrypt_AutoConfig2.h"
 
 #include "poly1305_vectors.h"
@@ -52,6 +56,14 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* exp){
     ok = ok && print_result(comp, exp);
   }
 #endif
+
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    Hacl_Poly1305_512_poly1305_mac(comp,in_len,in,key);
+    printf("Poly1305 (512-bit) Result:\n");
+    ok = ok && print_result(comp, exp);
+  }
+#endif
   return ok;
 }
 
@@ -127,6 +139,27 @@ int main() {
   cycles cdiff3 = b - a;
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    memset(plain,'P',SIZE);
+    memset(key,'K',16);
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Poly1305_512_poly1305_mac(plain,SIZE,plain,key);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Poly1305_512_poly1305_mac(tag,SIZE,plain,key);
+      res ^= tag[0] ^ tag[15];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff4 = t2 - t1;
+  cycles cdiff4 = b - a;
+#endif
+
   uint64_t count = ROUNDS * SIZE;
   printf("Poly1305 (32-bit) PERF: %d\n",(int)res); print_time(count,tdiff1,cdiff1);
 
@@ -140,6 +173,12 @@ int main() {
   }
 #endif
 
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Poly1305 (512-bit) PERF:\n"); print_time(count,tdiff4,cdiff4);
+  }
+#endif
+
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
 }
@@ -0,0 +1,97 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <sys/wait.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#include <unistd.h>
+
+#include "Lib_RandomBuffer_System.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 1000000
+
+// Two 16-byte draws colliding means the generator is broken.
+bool check_distinct(const char *name) {
+  uint8_t a[16], b[16], big[1000];
+  Lib_RandomBuffer_System_crypto_random(a, 16);
+  Lib_RandomBuffer_System_crypto_random(b, 16);
+  bool ok = memcmp(a, b, 16) != 0;
+  // Larger than the pool, and crossing a refill
+  for (int i = 0; i < 40; i++) {
+    Lib_RandomBuffer_System_crypto_random(big, 1000);
+    Lib_RandomBuffer_System_crypto_random(a, 13);
+    ok = ok && memcmp(a, b, 13) != 0;
+    memcpy(b, a, 13);
+  }
+  printf("%s: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// A child must not replay the bytes the parent is about to draw from its pool.
+// With raw, the child is created by the fork syscall itself, which skips the
+// pthread_atfork handlers.
+bool check_fork(bool raw) {
+  uint8_t warm[8], parent[16], child[16];
+  int fds[2];
+  Lib_RandomBuffer_System_crypto_random(warm, 8);
+  if (pipe(fds) != 0) return false;
+#ifdef SYS_fork
+  pid_t pid = raw ? (pid_t)syscall(SYS_fork) : fork();
+#else
+  pid_t pid = fork();
+#endif
+  if (pid == 0) {
+    Lib_RandomBuffer_System_crypto_random(child, 16);
+    ssize_t w = write(fds[1], child, 16);
+    _exit(w == 16 ? 0 : 1);
+  }
+  Lib_RandomBuffer_System_crypto_random(parent, 16);
+  ssize_t r = read(fds[0], child, 16);
+  waitpid(pid, NULL, 0);
+  close(fds[0]);
+  close(fds[1]);
+  bool ok = r == 16 && memcmp(parent, child, 16) != 0;
+  printf("Buffered mode after %s: %s\n", raw ? "a raw fork syscall" : "fork", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+void perf(const char *name) {
+  uint8_t nonce[12];
+  int res = 0;
+  cycles c0, c1;
+  clock_t t1, t2;
+  uint64_t count = (uint64_t)ROUNDS * 12;
+
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Lib_RandomBuffer_System_crypto_random(nonce, 12);
+    res ^= nonce[0];
+  }
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("%s (12-byte requests) PERF:\n", name);
+  print_time(count, t2 - t1, c1 - c0);
+  if (res == 256) printf(" ");
+}
+
+int main() {
+  bool ok = check_distinct("Unbuffered mode");
+  perf("Unbuffered mode");
+
+  Lib_RandomBuffer_System_set_buffered(true);
+  ok = check_distinct("Buffered mode") && ok;
+  ok = check_fork(false) && ok;
+  ok = check_fork(true) && ok;
+  perf("Buffered mode");
+  Lib_RandomBuffer_System_set_buffered(false);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -47,10 +47,62 @@ bool print_test(
   bool ver = Hacl_RSAPSS_rsapss_verify(Spec_Hash_Definitions_SHA2_256, modBits, eBits, pkey, saltLen, nbLen, sgnt, msgLen, msg);
   if (ver) printf("Success!\n");
   ok = ok && ver;
+
+  // The cached context, on both the e = 65537 chain and the generic exponentiation
+  Hacl_RSAPSS_rsapss_verify_ctx *ctx = Hacl_RSAPSS_new_verify_ctx(modBits, eBits, nb, eb);
+  bool ver_ctx = ctx != NULL;
+  for (int generic = 0; ver_ctx && generic < 2; generic++) {
+    if (generic) ctx->e_is_65537 = false;
+    ver_ctx = ver_ctx
+      && Hacl_RSAPSS_rsapss_verify_with_ctx(Spec_Hash_Definitions_SHA2_256, ctx, saltLen, nbLen, sgnt, msgLen, msg);
+    sgnt[nbLen - 1] ^= 1;
+    ver_ctx = ver_ctx
+      && !Hacl_RSAPSS_rsapss_verify_with_ctx(Spec_Hash_Definitions_SHA2_256, ctx, saltLen, nbLen, sgnt, msgLen, msg);
+    sgnt[nbLen - 1] ^= 1;
+  }
+  if (ctx != NULL) Hacl_RSAPSS_rsapss_verify_ctx_free(ctx);
+  printf("RSAPSS verify with context: %s\n", ver_ctx ? "Success!" : "**FAILED**");
+  ok = ok && ver_ctx;
   return ok;
 }
 
 
+// The CRT signer must produce the same signature as the plain one for the same
+// salt, and must refuse to output a signature computed from a bad qInv.
+bool test_crt(uint32_t msgLen, uint8_t *msg, uint32_t saltLen, uint8_t *salt) {
+  uint32_t modBits = 2048, eBits = 17, pBits = 1024;
+  uint32_t nbLen = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint8_t sgnt[nbLen], sgnt_expected[nbLen];
+  memset(sgnt, 0U, nbLen * sizeof (sgnt[0U]));
+
+  Hacl_RSAPSS_rsapss_skey_sign(Spec_Hash_Definitions_SHA2_256, modBits, eBits, modBits,
+    crt1_n, crt1_e, crt1_d, saltLen, salt, msgLen, msg, sgnt_expected);
+  Hacl_RSAPSS_rsapss_crt_ctx *ctx = Hacl_RSAPSS_new_rsapss_crt_ctx(modBits, eBits, pBits,
+    crt1_n, crt1_e, crt1_p, crt1_q, crt1_dP, crt1_dQ, crt1_qInv);
+  bool ok = ctx != NULL;
+  if (ok) {
+    ok = Hacl_RSAPSS_rsapss_crt_sign(Spec_Hash_Definitions_SHA2_256, ctx, saltLen, salt, msgLen, msg, sgnt);
+    Hacl_RSAPSS_rsapss_crt_ctx_free(ctx);
+  }
+  printf("RSAPSS CRT sign Result:\n");
+  ok = print_result(nbLen, sgnt, sgnt_expected) && ok;
+
+  uint8_t qInv[128];
+  memcpy(qInv, crt1_qInv, 128);
+  qInv[127] ^= 1;
+  ctx = Hacl_RSAPSS_new_rsapss_crt_ctx(modBits, eBits, pBits,
+    crt1_n, crt1_e, crt1_p, crt1_q, crt1_dP, crt1_dQ, qInv);
+  bool bad = ctx != NULL
+    && !Hacl_RSAPSS_rsapss_crt_sign(Spec_Hash_Definitions_SHA2_256, ctx, saltLen, salt, msgLen, msg, sgnt);
+  if (ctx != NULL)
+    Hacl_RSAPSS_rsapss_crt_ctx_free(ctx);
+  // q does not divide n
+  bool bad_q = Hacl_RSAPSS_new_rsapss_crt_ctx(modBits, eBits, pBits,
+    crt1_n, crt1_e, crt1_p, crt1_p, crt1_dP, crt1_dQ, crt1_qInv) == NULL;
+  printf("RSAPSS CRT bad key: %s\n", bad && bad_q ? "Success!" : "**FAILED**");
+  return ok && bad && bad_q;
+}
+
 int main() {
   bool ok = true;
   for (int i = 0; i < sizeof(vectors)/sizeof(rsapss_test_vector); ++i) {
@@ -58,6 +110,8 @@ int main() {
 		     vectors[i].msgLen,vectors[i].msg,vectors[i].saltLen,vectors[i].salt,vectors[i].sgnt_expected);
   }
 
+  ok &= test_crt(vectors[3].msgLen, vectors[3].msg, vectors[3].saltLen, vectors[3].salt);
+
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
 }
@@ -297,3 +297,94 @@ static rsapss_test_vector vectors[] = {
     .sgnt_expected = test4_sgnt_expected
   }
 };
+
+// A 2048-bit key with its CRT components, for Hacl_RSAPSS_rsapss_crt_sign.
+
+static uint8_t crt1_n[256] = {
+  0xea, 0x1a, 0x4f, 0xb6, 0x74, 0xcc, 0xaf, 0xf9, 0x36, 0x27, 0x34, 0x9f, 0x38, 0xaa, 0x36, 0x5b,
+  0x5b, 0x1e, 0x5d, 0x38, 0x83, 0xe6, 0x0f, 0xc7, 0x68, 0x3b, 0xcc, 0x6a, 0xb0, 0xaa, 0x11, 0x56,
+  0x15, 0x84, 0x91, 0xdf, 0x5a, 0x89, 0xf3, 0xff, 0x47, 0x2d, 0xc0, 0x05, 0xe3, 0x52, 0x9b, 0xbb,
+  0x73, 0x5a, 0xca, 0x1d, 0xa0, 0xa1, 0xd1, 0x2d, 0xb7, 0x3f, 0x0c, 0xd2, 0xa6, 0x92, 0x8e, 0x3f,
+  0x97, 0xa5, 0x48, 0x4f, 0x9f, 0xfb, 0xca, 0x2c, 0x97, 0xd9, 0xb9, 0xf6, 0x9f, 0xa0, 0xa0, 0x21,
+  0xb3, 0x2e, 0xd0, 0x28, 0xae, 0x1a, 0x44, 0x2d, 0x28, 0x54, 0x0c, 0x77, 0x41, 0x19, 0x7f, 0xf6,
+  0xa9, 0x7a, 0x8c, 0x58, 0xc0, 0x40, 0xaf, 0x63, 0x44, 0xb6, 0x61, 0x30, 0x9a, 0x0b, 0xd6, 0x01,
+  0xd2, 0x08, 0x2e, 0xe0, 0x23, 0x01, 0xdb, 0xfa, 0x5c, 0x3c, 0x18, 0x9a, 0xfa, 0xd7, 0xb3, 0x82,
+  0x59, 0x52, 0x95, 0xfa, 0x33, 0x3c, 0x1e, 0x4a, 0x31, 0xa7, 0x4e, 0xfe, 0x2e, 0x49, 0xed, 0x26,
+  0xd2, 0x4b, 0xb9, 0xb8, 0x62, 0x50, 0x77, 0x51, 0x45, 0x25, 0x56, 0xad, 0xf5, 0x9e, 0xf0, 0x4b,
+  0x56, 0x56, 0x78, 0xe3, 0x45, 0x41, 0x45, 0xcd, 0x2a, 0xfd, 0xcb, 0x7a, 0x47, 0xa3, 0x5f, 0x30,
+  0x24, 0xad, 0x84, 0x5c, 0x5b, 0x64, 0x87, 0x71, 0x7d, 0x10, 0x7c, 0x0c, 0x93, 0x1f, 0x55, 0xdd,
+  0xf0, 0x80, 0x2d, 0x89, 0x31, 0x37, 0xb8, 0xb3, 0xf4, 0xca, 0x41, 0x08, 0x1a, 0xd9, 0xf6, 0xe6,
+  0xc3, 0x79, 0xa5, 0x28, 0xd8, 0x71, 0xf3, 0x5d, 0x7d, 0xe3, 0x92, 0x18, 0x0c, 0x69, 0xf2, 0xfa,
+  0x39, 0x20, 0x8c, 0x2f, 0xdc, 0xed, 0xa9, 0x9f, 0xd4, 0x6e, 0x29, 0xea, 0xcc, 0xa4, 0xe1, 0x9e,
+  0x7e, 0x5d, 0x1c, 0x87, 0xbf, 0x3a, 0x80, 0xc0, 0x9e, 0x8a, 0x77, 0x59, 0xcf, 0x3a, 0xbd, 0x0d };
+
+static uint8_t crt1_e[3] = { 0x01, 0x00, 0x01 };
+
+static uint8_t crt1_d[256] = {
+  0x45, 0x7c, 0xcb, 0xde, 0x6f, 0xaa, 0xf6, 0x2c, 0xf5, 0xfb, 0x0b, 0x2e, 0x9b, 0xc6, 0x42, 0x5e,
+  0x39, 0x9c, 0xb8, 0xb4, 0xf6, 0xc9, 0xca, 0x33, 0x39, 0x68, 0x4e, 0x93, 0xf8, 0x9e, 0x72, 0x88,
+  0xe7, 0xd8, 0x32, 0xe8, 0x66, 0x5a, 0x7e, 0x77, 0x6e, 0xac, 0x50, 0xcc, 0x2e, 0x9e, 0xad, 0xa5,
+  0x25, 0x67, 0x74, 0x88, 0xf8, 0xce, 0x2f, 0x65, 0xef, 0x77, 0xa2, 0x99, 0xc0, 0x61, 0xce, 0x21,
+  0x68, 0x24, 0xe2, 0x62, 0xe8, 0x2c, 0xf7, 0xe4, 0xe6, 0xa9, 0xf4, 0xfe, 0x14, 0x81, 0xbc, 0x26,
+  0x64, 0xa6, 0x67, 0x99, 0x3b, 0x9c, 0x86, 0x52, 0x15, 0x1f, 0x65, 0x97, 0xdc, 0x55, 0xf2, 0x5a,
+  0xc8, 0x11, 0x9d, 0x29, 0x16, 0xdf, 0xdc, 0x6f, 0x8d, 0xcc, 0xc8, 0xea, 0x81, 0x3f, 0x34, 0x25,
+  0xd4, 0x2f, 0x23, 0xa2, 0xda, 0x21, 0x4a, 0x27, 0x75, 0x4b, 0x4d, 0x4e, 0x6b, 0x58, 0xad, 0x6a,
+  0x59, 0x37, 0xd7, 0x9e, 0x1c, 0x76, 0xf6, 0x47, 0xe4, 0x38, 0xac, 0x90, 0x33, 0x38, 0xae, 0xbc,
+  0x65, 0x62, 0xa3, 0xdd, 0x8a, 0xff, 0x33, 0x65, 0xd9, 0x32, 0xc0, 0xea, 0x07, 0xe3, 0x94, 0x35,
+  0x10, 0x46, 0x08, 0xa6, 0x46, 0x8c, 0xfa, 0xe2, 0xbe, 0x64, 0x2f, 0x31, 0x15, 0xb9, 0x95, 0x0a,
+  0x4a, 0x9d, 0x4a, 0x39, 0x61, 0x51, 0xdb, 0x0c, 0xbe, 0xa4, 0xc0, 0x14, 0x9a, 0x85, 0x67, 0xf3,
+  0xb4, 0x27, 0x9f, 0x1c, 0x7d, 0x00, 0xd9, 0x55, 0x4d, 0x7d, 0xff, 0xea, 0x1e, 0xff, 0x6a, 0x80,
+  0x7e, 0xf6, 0xe9, 0x18, 0xfe, 0x42, 0xcb, 0xe4, 0xac, 0x09, 0x10, 0x6c, 0x41, 0xa4, 0x34, 0xd6,
+  0xd9, 0x8e, 0x44, 0xc7, 0x78, 0x14, 0xad, 0x66, 0x92, 0x27, 0x2c, 0xdf, 0x60, 0x29, 0x61, 0x32,
+  0x7f, 0xd1, 0xc7, 0x52, 0xca, 0xdf, 0xa5, 0x86, 0x43, 0x08, 0x77, 0x55, 0x02, 0x66, 0x0d, 0x4d };
+
+static uint8_t crt1_p[128] = {
+  0xf9, 0x63, 0xfa, 0xa9, 0x48, 0xb7, 0x83, 0xb4, 0xbb, 0xe6, 0x65, 0x10, 0xe3, 0x39, 0x9e, 0xab,
+  0x4f, 0x27, 0xe4, 0xb4, 0x4f, 0x17, 0x23, 0x12, 0xa1, 0x68, 0x9f, 0x4c, 0x70, 0x14, 0xca, 0xa3,
+  0x30, 0x6b, 0x10, 0x96, 0x57, 0xdd, 0x1c, 0xa1, 0x9f, 0xd9, 0x39, 0xb3, 0x07, 0x8d, 0x93, 0x08,
+  0xdd, 0x4d, 0x10, 0x20, 0xb0, 0xbb, 0x4b, 0xe6, 0x7e, 0x58, 0x71, 0xa1, 0xdf, 0xd9, 0x5a, 0x15,
+  0xfe, 0xbc, 0x90, 0x46, 0x28, 0xee, 0xf7, 0xb2, 0x5a, 0x51, 0x07, 0x7a, 0x49, 0x51, 0x0b, 0xc9,
+  0x7d, 0x6c, 0x69, 0x78, 0xf0, 0x1b, 0xb2, 0x32, 0x36, 0xe9, 0x05, 0x58, 0x15, 0x84, 0x8b, 0x56,
+  0xff, 0xc0, 0xd3, 0xb9, 0xc8, 0xbb, 0xf6, 0x44, 0x4d, 0x51, 0xbc, 0xbd, 0x2e, 0x26, 0x52, 0x19,
+  0xd7, 0xb8, 0xc2, 0xef, 0x9a, 0x38, 0x00, 0x40, 0x6b, 0xf0, 0xf5, 0x7b, 0xd1, 0xcf, 0x94, 0x6b };
+
+static uint8_t crt1_q[128] = {
+  0xf0, 0x4e, 0x9c, 0x4a, 0x5f, 0xe0, 0x91, 0x98, 0xf7, 0x91, 0x9b, 0x4f, 0xaa, 0x9e, 0x94, 0x3e,
+  0x00, 0x4d, 0xb4, 0x23, 0xd8, 0x4f, 0x72, 0x1a, 0x99, 0x91, 0xdd, 0xbb, 0x57, 0x38, 0xca, 0x8a,
+  0xce, 0xee, 0x61, 0xf0, 0xaf, 0xd0, 0x06, 0xe7, 0xc0, 0xcb, 0xfb, 0x79, 0xac, 0x76, 0x24, 0xf5,
+  0x50, 0xac, 0x56, 0x16, 0x89, 0x0c, 0x29, 0xfe, 0x2c, 0xb8, 0x30, 0x67, 0xa3, 0xa7, 0x04, 0xc1,
+  0x31, 0x23, 0x56, 0x09, 0xf4, 0xcd, 0x95, 0xf5, 0x49, 0xbb, 0xc1, 0x8c, 0x0b, 0x06, 0x02, 0x94,
+  0x64, 0x21, 0x43, 0x01, 0x5c, 0xde, 0xee, 0x77, 0x46, 0xd9, 0xbf, 0xce, 0x5f, 0xab, 0x59, 0x9f,
+  0x1c, 0xef, 0x0a, 0x76, 0xd4, 0xb2, 0x11, 0xc0, 0x1a, 0x0e, 0xdf, 0x15, 0x4f, 0xf2, 0x2d, 0xd2,
+  0x0b, 0x53, 0x2d, 0x7c, 0xe6, 0xa3, 0x9d, 0x19, 0x36, 0xc3, 0x02, 0x46, 0x82, 0x73, 0x92, 0x67 };
+
+static uint8_t crt1_dP[128] = {
+  0x7e, 0x90, 0xca, 0xe9, 0x96, 0xc9, 0xeb, 0xc1, 0x91, 0x8a, 0xbf, 0xc7, 0xee, 0x49, 0x93, 0xc9,
+  0x05, 0x07, 0x0d, 0xfe, 0xa4, 0x14, 0xed, 0xeb, 0xca, 0x96, 0xba, 0x21, 0xa4, 0xd0, 0x28, 0x76,
+  0xe1, 0x5f, 0xb4, 0xaf, 0x58, 0x30, 0x13, 0x13, 0xc3, 0x78, 0x0e, 0xdc, 0x58, 0xfc, 0xf4, 0x9e,
+  0x0f, 0x11, 0xc9, 0x19, 0x8e, 0x17, 0xbf, 0xd1, 0x5e, 0x55, 0xac, 0x75, 0xa6, 0x91, 0x3c, 0x32,
+  0xe5, 0x70, 0xf5, 0x17, 0x66, 0x36, 0xc0, 0xe6, 0x77, 0x07, 0xa0, 0x6f, 0xe3, 0x3d, 0x8a, 0x69,
+  0xdb, 0x89, 0x65, 0x8d, 0xc6, 0xed, 0x87, 0x66, 0x0c, 0x8f, 0xfd, 0xf2, 0x52, 0x19, 0x4e, 0x4d,
+  0xfc, 0xc5, 0xf3, 0xad, 0xd9, 0xbd, 0xea, 0xa1, 0x87, 0x4b, 0xf0, 0x29, 0x62, 0x7e, 0x78, 0x34,
+  0x3d, 0x52, 0xbb, 0x3b, 0xb6, 0x5c, 0xad, 0x64, 0x04, 0x63, 0xe9, 0x71, 0xc9, 0x6d, 0x3b, 0xb9 };
+
+static uint8_t crt1_dQ[128] = {
+  0x93, 0x05, 0x85, 0x59, 0x7b, 0x8f, 0x49, 0x84, 0xec, 0xf2, 0x88, 0xb3, 0x15, 0x10, 0x30, 0x62,
+  0x3e, 0x8d, 0x4b, 0xc9, 0x22, 0x6e, 0x78, 0xc1, 0x0d, 0x73, 0xd0, 0xd4, 0xed, 0x68, 0x31, 0x82,
+  0xfb, 0x57, 0x9d, 0x54, 0x44, 0x3c, 0x61, 0xfd, 0x28, 0x57, 0xa4, 0x63, 0xac, 0xc0, 0x1b, 0x9c,
+  0x7a, 0xde, 0xf5, 0x4c, 0x94, 0x4c, 0x7c, 0xe4, 0xa5, 0x37, 0x8b, 0x65, 0xdd, 0x1a, 0x32, 0x2e,
+  0x80, 0x81, 0xbe, 0x02, 0x19, 0x64, 0x2e, 0x7b, 0x03, 0xc1, 0x7b, 0x88, 0xd2, 0xb5, 0xba, 0x9e,
+  0x4f, 0x24, 0x8a, 0x7a, 0x2a, 0xf7, 0xb9, 0xae, 0x00, 0x0a, 0xf8, 0xee, 0xaa, 0x59, 0x8b, 0x5b,
+  0x6d, 0xb8, 0x52, 0x0e, 0xa1, 0xd2, 0xd0, 0x49, 0x57, 0xa8, 0x01, 0x94, 0x68, 0x75, 0x22, 0xd3,
+  0x7f, 0x5a, 0x44, 0x5a, 0x46, 0x41, 0x93, 0xbb, 0xf9, 0x65, 0x15, 0xdf, 0x4d, 0xb0, 0xa7, 0xc1 };
+
+static uint8_t crt1_qInv[128] = {
+  0xed, 0x6c, 0x03, 0x7d, 0xc8, 0xe3, 0x63, 0xab, 0xe0, 0x34, 0x6e, 0x96, 0xfe, 0xcd, 0x78, 0x9c,
+  0x17, 0xb4, 0xd2, 0x15, 0xc7, 0x54, 0x04, 0x6a, 0x40, 0x37, 0x20, 0xe8, 0x13, 0x4d, 0xd3, 0xc4,
+  0xc0, 0x4c, 0xf9, 0x0b, 0xf5, 0x95, 0x23, 0x58, 0x28, 0xff, 0x53, 0xd4, 0x1b, 0x31, 0xa0, 0xbd,
+  0x40, 0x7b, 0xbf, 0xad, 0xa8, 0x1f, 0xe0, 0xdb, 0xb4, 0xd2, 0x61, 0x3f, 0x33, 0x7b, 0xe1, 0x44,
+  0x4a, 0x72, 0xed, 0x24, 0x04, 0x83, 0x86, 0x08, 0xf4, 0xb1, 0x11, 0x69, 0x16, 0x22, 0x5c, 0xc6,
+  0x4e, 0x7e, 0x63, 0x47, 0x67, 0xdc, 0x70, 0x9f, 0x8e, 0xd1, 0xfd, 0x7d, 0xc5, 0xf4, 0x9d, 0xcf,
+  0x76, 0x32, 0xf0, 0xaa, 0x8e, 0x8c, 0x39, 0xb9, 0x21, 0xf1, 0xe1, 0xf1, 0xfd, 0x7b, 0x40, 0xc2,
+  0x31, 0x33, 0x35, 0x60, 0xb8, 0x8f, 0xef, 0x7d, 0x56, 0x81, 0xd7, 0xba, 0x69, 0x50, 0xba, 0x65 };
+
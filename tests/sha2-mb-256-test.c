@@ -0,0 +1,174 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_Hash.h"
+#include "Hacl_SHA2_Vec256.h"
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+#include "Hacl_SHA2_Vec512.h"
+#endif
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
+
+#define ROUNDS 1000
+#define NMSGS  37
+#define MAXLEN 4096
+#define PERF_N 64
+#define PERF_LEN 1024
+
+typedef void (*hash_fn)(uint8_t *input, uint32_t input_len, uint8_t *dst);
+typedef void (*multi_fn)(uint32_t n, uint8_t **dsts, uint8_t **inputs, uint32_t *input_lens);
+
+// Lengths around the padding boundaries of both block sizes, plus a few
+// longer ones, so that lanes finish at different times.
+static uint32_t lens[NMSGS] = {
+  0, 1, 3, 55, 56, 57, 63, 64, 65, 111, 112, 113, 119, 120, 127, 128, 129,
+  200, 255, 256, 257, 500, 1000, 1023, 1024, 1025, 2047, 4096, 4000, 17,
+  64, 128, 3000, 0, 77, 239, 240
+};
+
+static uint8_t msgs_[NMSGS][MAXLEN];
+static uint8_t *msg_ptrs[NMSGS];
+static uint8_t digests[NMSGS][64];
+static uint8_t *digest_ptrs[NMSGS];
+
+bool check(const char *name, uint32_t n, uint32_t hash_len, hash_fn ref, multi_fn multi) {
+  uint8_t expected[64];
+  bool ok = true;
+  memset(digests, 0, sizeof digests);
+  multi(n, digest_ptrs, msg_ptrs, lens);
+  for (uint32_t i = 0; i < n; i++) {
+    ref(msg_ptrs[i], lens[i], expected);
+    ok = ok && memcmp(digests[i], expected, hash_len) == 0;
+  }
+  if (ok)
+    printf("%s multi-buffer (%" PRIu32 " messages): Success!\n", name, n);
+  else
+    printf("%s multi-buffer (%" PRIu32 " messages): **FAILED**\n", name, n);
+  return ok;
+}
+
+bool check_evercrypt(const char *name, Spec_Hash_Definitions_hash_alg a, uint32_t hash_len) {
+  uint8_t expected[64];
+  bool ok = true;
+  memset(digests, 0, sizeof digests);
+  EverCrypt_Hash_hash_multi(a, NMSGS, digest_ptrs, msg_ptrs, lens);
+  for (uint32_t i = 0; i < NMSGS; i++) {
+    EverCrypt_Hash_hash(a, expected, msg_ptrs[i], lens[i]);
+    ok = ok && memcmp(digests[i], expected, hash_len) == 0;
+  }
+  if (ok)
+    printf("EverCrypt %s hash_multi: Success!\n", name);
+  else
+    printf("EverCrypt %s hash_multi: **FAILED**\n", name);
+  return ok;
+}
+
+bool check_compress() {
+  uint8_t expected[32];
+  bool ok = true;
+  memset(digests, 0, sizeof digests);
+  Hacl_SHA2_Vec256_sha256_compress_multi(NMSGS, digest_ptrs, msg_ptrs);
+  for (uint32_t i = 0; i < NMSGS; i++) {
+    uint32_t st[8];
+    Hacl_Hash_Core_SHA2_init_256(st);
+    Hacl_Hash_SHA2_update_multi_256(st, msg_ptrs[i], 1);
+    Hacl_Hash_Core_SHA2_finish_256(st, expected);
+    ok = ok && memcmp(digests[i], expected, 32) == 0;
+  }
+  if (ok)
+    printf("SHA2-256 compress_multi: Success!\n");
+  else
+    printf("SHA2-256 compress_multi: **FAILED**\n");
+  return ok;
+}
+
+void perf(const char *name, hash_fn single, multi_fn multi) {
+  uint32_t perf_lens[PERF_N];
+  uint8_t *perf_msgs[PERF_N];
+  uint8_t *perf_digests[PERF_N];
+  cycles a,b;
+  clock_t t1,t2;
+  for (uint32_t i = 0; i < PERF_N; i++) {
+    perf_lens[i] = PERF_LEN;
+    perf_msgs[i] = msgs_[i % NMSGS];
+    perf_digests[i] = digests[i % NMSGS];
+  }
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < PERF_N; i++)
+      single(perf_msgs[i], perf_lens[i], perf_digests[i]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    multi(PERF_N, perf_digests, perf_msgs, perf_lens);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  uint64_t count = (uint64_t)ROUNDS * PERF_N * PERF_LEN;
+  printf("%s one-by-one PERF:\n", name); print_time(count,tdiff1,cdiff1);
+  printf("%s multi-buffer PERF:\n", name); print_time(count,tdiff2,cdiff2);
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (uint32_t i = 0; i < NMSGS; i++) {
+    for (uint32_t j = 0; j < MAXLEN; j++)
+      msgs_[i][j] = (uint8_t)(i * 31 + j * 7 + (j >> 8));
+    msg_ptrs[i] = msgs_[i];
+    digest_ptrs[i] = digests[i];
+  }
+
+  bool ok = true;
+  uint32_t counts[5] = { 0, 1, 2, 9, NMSGS };
+  for (int i = 0; i < 5; i++) {
+    ok = check("SHA2-224", counts[i], 28, Hacl_Hash_SHA2_hash_224, Hacl_SHA2_Vec256_sha224_multi) && ok;
+    ok = check("SHA2-256", counts[i], 32, Hacl_Hash_SHA2_hash_256, Hacl_SHA2_Vec256_sha256_multi) && ok;
+    ok = check("SHA2-384", counts[i], 48, Hacl_Hash_SHA2_hash_384, Hacl_SHA2_Vec256_sha384_multi) && ok;
+    ok = check("SHA2-512", counts[i], 64, Hacl_Hash_SHA2_hash_512, Hacl_SHA2_Vec256_sha512_multi) && ok;
+  }
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_vec512()) {
+    for (int i = 0; i < 5; i++) {
+      ok = check("SHA2-224 (512-bit)", counts[i], 28, Hacl_Hash_SHA2_hash_224, Hacl_SHA2_Vec512_sha224_multi) && ok;
+      ok = check("SHA2-256 (512-bit)", counts[i], 32, Hacl_Hash_SHA2_hash_256, Hacl_SHA2_Vec512_sha256_multi) && ok;
+      ok = check("SHA2-384 (512-bit)", counts[i], 48, Hacl_Hash_SHA2_hash_384, Hacl_SHA2_Vec512_sha384_multi) && ok;
+      ok = check("SHA2-512 (512-bit)", counts[i], 64, Hacl_Hash_SHA2_hash_512, Hacl_SHA2_Vec512_sha512_multi) && ok;
+    }
+  }
+#endif
+  ok = check_compress() && ok;
+  ok = check_evercrypt("SHA2-224", Spec_Hash_Definitions_SHA2_224, 28) && ok;
+  ok = check_evercrypt("SHA2-256", Spec_Hash_Definitions_SHA2_256, 32) && ok;
+  ok = check_evercrypt("SHA2-384", Spec_Hash_Definitions_SHA2_384, 48) && ok;
+  ok = check_evercrypt("SHA2-512", Spec_Hash_Definitions_SHA2_512, 64) && ok;
+  ok = check_evercrypt("Blake2b", Spec_Hash_Definitions_Blake2B, 64) && ok;
+
+  perf("SHA2-256", Hacl_Hash_SHA2_hash_256, Hacl_SHA2_Vec256_sha256_multi);
+  perf("SHA2-512", Hacl_Hash_SHA2_hash_512, Hacl_SHA2_Vec256_sha512_multi);
+#if defined(EVERCRYPT_CAN_COMPILE_VEC512)
+  if (EverCrypt_AutoConfig2_has_vec512()) {
+    perf("SHA2-256 (512-bit)", Hacl_Hash_SHA2_hash_256, Hacl_SHA2_Vec512_sha256_multi);
+    perf("SHA2-512 (512-bit)", Hacl_Hash_SHA2_hash_512, Hacl_SHA2_Vec512_sha512_multi);
+  }
+#endif
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,178 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
+
+#include "test_helpers.h"
+
+#define MAX_LEN 700
+#define OUT_LEN 500
+#define RECORDS 4096
+#define RECORD_LEN 100
+
+#if EVERCRYPT_CAN_COMPILE_VEC256
+
+static uint8_t in[4][MAX_LEN], out[4][OUT_LEN], expected[OUT_LEN];
+
+typedef void (*fixed_4x)(uint32_t, uint8_t *, uint8_t *, uint8_t *, uint8_t *,
+                         uint8_t *, uint8_t *, uint8_t *, uint8_t *);
+typedef void (*xof_4x)(uint32_t, uint8_t *, uint8_t *, uint8_t *, uint8_t *,
+                       uint32_t, uint8_t *, uint8_t *, uint8_t *, uint8_t *);
+typedef void (*multi)(uint32_t, uint8_t **, uint8_t **, uint32_t *);
+
+// FIPS 202 example values
+static uint8_t sha3_256_abc[32] = {
+  0x3a, 0x98, 0x5d, 0xa7, 0x4f, 0xe2, 0x25, 0xb2, 0x04, 0x5c, 0x17, 0x2d, 0x6b, 0xd3, 0x90, 0xbd,
+  0x85, 0x5f, 0x08, 0x6e, 0x3e, 0x9d, 0x52, 0x5b, 0x46, 0xbf, 0xe2, 0x45, 0x11, 0x43, 0x15, 0x32
+};
+
+static uint8_t shake128_empty[32] = {
+  0x7f, 0x9c, 0x2b, 0xa4, 0xe8, 0x8f, 0x82, 0x7d, 0x61, 0x60, 0x45, 0x50, 0x76, 0x05, 0x85, 0x3e,
+  0xd7, 0x3b, 0x80, 0x93, 0xf6, 0xef, 0xbc, 0x88, 0xeb, 0x1a, 0x6e, 0xac, 0xfa, 0x66, 0xef, 0x26
+};
+
+bool check_kat() {
+  bool ok = true;
+  memcpy(in[0], "abc", 3);
+  memcpy(in[1], "abc", 3);
+  memcpy(in[2], "abc", 3);
+  memcpy(in[3], "abc", 3);
+  Hacl_SHA3_Vec256_sha3_256_4x(3, in[0], in[1], in[2], in[3], out[0], out[1], out[2], out[3]);
+  printf("SHA3-256 4x, \"abc\":\n");
+  for (int k = 0; k < 4; k++)
+    ok = compare_and_print(32, out[k], sha3_256_abc) && ok;
+  Hacl_SHA3_Vec256_shake128_4x(0, in[0], in[1], in[2], in[3], 32, out[0], out[1], out[2], out[3]);
+  printf("SHAKE128 4x, empty input:\n");
+  for (int k = 0; k < 4; k++)
+    ok = compare_and_print(32, out[k], shake128_empty) && ok;
+  return ok;
+}
+
+static void fill(uint32_t len) {
+  for (int k = 0; k < 4; k++)
+    for (uint32_t i = 0; i < len; i++)
+      in[k][i] = (uint8_t)(i * 31 + k * 97 + len);
+}
+
+// Every input length up to a few blocks, around each rate, in every lane.
+bool check_fixed(const char *name, fixed_4x f4, void (*f)(uint32_t, uint8_t *, uint8_t *),
+                 uint32_t hash_len) {
+  bool ok = true;
+  for (uint32_t len = 0; len < MAX_LEN; len++) {
+    fill(len);
+    f4(len, in[0], in[1], in[2], in[3], out[0], out[1], out[2], out[3]);
+    for (int k = 0; k < 4; k++) {
+      f(len, in[k], expected);
+      ok = ok && memcmp(out[k], expected, hash_len) == 0;
+    }
+  }
+  printf("%s 4x against one at a time: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+bool check_xof(const char *name, xof_4x f4, void (*f)(uint32_t, uint8_t *, uint32_t, uint8_t *)) {
+  bool ok = true;
+  for (uint32_t len = 0; len < MAX_LEN; len += 7) {
+    uint32_t out_len = (len * 13) % OUT_LEN;
+    fill(len);
+    f4(len, in[0], in[1], in[2], in[3], out_len, out[0], out[1], out[2], out[3]);
+    for (int k = 0; k < 4; k++) {
+      f(len, in[k], out_len, expected);
+      ok = ok && memcmp(out[k], expected, out_len) == 0;
+    }
+  }
+  printf("%s 4x against one at a time: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Mixed lengths within a group, and every group size including partial ones.
+bool check_multi(const char *name, multi fm, void (*f)(uint32_t, uint8_t *, uint8_t *),
+                 uint32_t hash_len) {
+  static uint8_t data[MAX_LEN], dsts[11][64];
+  uint8_t *inputs[11], *outs[11];
+  uint32_t lens[11];
+  bool ok = true;
+  for (uint32_t i = 0; i < MAX_LEN; i++) data[i] = (uint8_t)(i * 7 + 1);
+  for (uint32_t n = 0; n <= 11; n++) {
+    for (uint32_t i = 0; i < n; i++) {
+      lens[i] = (i * 167 + n * 29) % (MAX_LEN - 20);
+      inputs[i] = data + i;
+      outs[i] = dsts[i];
+    }
+    fm(n, outs, inputs, lens);
+    for (uint32_t i = 0; i < n; i++) {
+      f(lens[i], inputs[i], expected);
+      ok = ok && memcmp(dsts[i], expected, hash_len) == 0;
+    }
+  }
+  printf("%s multi against one at a time: %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+void perf() {
+  static uint8_t records[RECORDS][RECORD_LEN], digests[RECORDS][32];
+  static uint8_t *inputs[RECORDS], *dsts[RECORDS];
+  static uint32_t lens[RECORDS];
+  uint64_t res = 0;
+  cycles a, b;
+  clock_t t1, t2;
+  for (int i = 0; i < RECORDS; i++) {
+    memset(records[i], i, RECORD_LEN);
+    inputs[i] = records[i];
+    dsts[i] = digests[i];
+    lens[i] = RECORD_LEN;
+  }
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int i = 0; i < RECORDS; i++) {
+    Hacl_SHA3_sha3_256(RECORD_LEN, records[i], digests[i]);
+    res ^= digests[i][0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("SHA3-256 one at a time PERF (%d records of %d bytes):\n", RECORDS, RECORD_LEN);
+  print_time(RECORDS * RECORD_LEN, t2 - t1, b - a);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  Hacl_SHA3_Vec256_sha3_256_multi(RECORDS, dsts, inputs, lens);
+  b = cpucycles_end();
+  t2 = clock();
+  res ^= digests[0][0];
+  printf("SHA3-256 multi PERF (%d records of %d bytes):\n", RECORDS, RECORD_LEN);
+  print_time(RECORDS * RECORD_LEN, t2 - t1, b - a);
+  if (res == 256) printf(" ");
+}
+
+#endif
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+#if EVERCRYPT_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256()) {
+    ok = check_kat() && ok;
+    ok = check_fixed("SHA3-224", Hacl_SHA3_Vec256_sha3_224_4x, Hacl_SHA3_sha3_224, 28) && ok;
+    ok = check_fixed("SHA3-256", Hacl_SHA3_Vec256_sha3_256_4x, Hacl_SHA3_sha3_256, 32) && ok;
+    ok = check_fixed("SHA3-384", Hacl_SHA3_Vec256_sha3_384_4x, Hacl_SHA3_sha3_384, 48) && ok;
+    ok = check_fixed("SHA3-512", Hacl_SHA3_Vec256_sha3_512_4x, Hacl_SHA3_sha3_512, 64) && ok;
+    ok = check_xof("SHAKE128", Hacl_SHA3_Vec256_shake128_4x, Hacl_SHA3_shake128_hacl) && ok;
+    ok = check_xof("SHAKE256", Hacl_SHA3_Vec256_shake256_4x, Hacl_SHA3_shake256_hacl) && ok;
+    ok = check_multi("SHA3-224", Hacl_SHA3_Vec256_sha3_224_multi, Hacl_SHA3_sha3_224, 28) && ok;
+    ok = check_multi("SHA3-256", Hacl_SHA3_Vec256_sha3_256_multi, Hacl_SHA3_sha3_256, 32) && ok;
+    ok = check_multi("SHA3-384", Hacl_SHA3_Vec256_sha3_384_multi, Hacl_SHA3_sha3_384, 48) && ok;
+    ok = check_multi("SHA3-512", Hacl_SHA3_Vec256_sha3_512_multi, Hacl_SHA3_sha3_512, 64) && ok;
+    perf();
+  }
+#endif
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
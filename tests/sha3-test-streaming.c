@@ -0,0 +1,207 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
+#include "Hacl_SHA3.h"
+#include "Hacl_Streaming_SHA3.h"
+
+#include "test_helpers.h"
+
+#define MSG_LEN 1000
+#define XOF_LEN 1000
+
+static uint8_t msg[MSG_LEN];
+
+// FIPS 202 example values
+static uint8_t sha3_256_abc[32] = {
+  0x3a, 0x98, 0x5d, 0xa7, 0x4f, 0xe2, 0x25, 0xb2, 0x04, 0x5c, 0x17, 0x2d, 0x6b, 0xd3, 0x90, 0xbd,
+  0x85, 0x5f, 0x08, 0x6e, 0x3e, 0x9d, 0x52, 0x5b, 0x46, 0xbf, 0xe2, 0x45, 0x11, 0x43, 0x15, 0x32
+};
+
+static uint8_t shake128_empty[32] = {
+  0x7f, 0x9c, 0x2b, 0xa4, 0xe8, 0x8f, 0x82, 0x7d, 0x61, 0x60, 0x45, 0x50, 0x76, 0x05, 0x85, 0x3e,
+  0xd7, 0x3b, 0x80, 0x93, 0xf6, 0xef, 0xbc, 0x88, 0xeb, 0x1a, 0x6e, 0xac, 0xfa, 0x66, 0xef, 0x26
+};
+
+// Chunk sizes straddling every rate (72, 104, 136, 144, 168).
+static const uint32_t chunks[] = { 1, 7, 71, 72, 73, 104, 135, 136, 137, 144, 168, 169, 500, MSG_LEN };
+
+typedef struct {
+  const char *name;
+  uint32_t hash_len;
+  Spec_Hash_Definitions_hash_alg alg;
+  Hacl_Streaming_SHA3_state_sha3_224 *(*create_in)();
+  void (*init)(Hacl_Streaming_SHA3_state_sha3_224 *);
+  void (*update)(Hacl_Streaming_SHA3_state_sha3_224 *, uint8_t *, uint32_t);
+  void (*finish)(Hacl_Streaming_SHA3_state_sha3_224 *, uint8_t *);
+  void (*free)(Hacl_Streaming_SHA3_state_sha3_224 *);
+  void (*hash)(uint32_t, uint8_t *, uint8_t *);
+} sha3_instance;
+
+typedef struct {
+  const char *name;
+  Hacl_Streaming_SHA3_state_shake128 *(*create_in)();
+  void (*init)(Hacl_Streaming_SHA3_state_shake128 *);
+  void (*update)(Hacl_Streaming_SHA3_state_shake128 *, uint8_t *, uint32_t);
+  void (*squeeze)(Hacl_Streaming_SHA3_state_shake128 *, uint8_t *, uint32_t);
+  void (*free)(Hacl_Streaming_SHA3_state_shake128 *);
+  void (*hash)(uint32_t, uint8_t *, uint32_t, uint8_t *);
+} shake_instance;
+
+bool check_kat() {
+  uint8_t out[32];
+  bool ok = true;
+  Hacl_Streaming_SHA3_state_sha3_256 *s = Hacl_Streaming_SHA3_create_in_256();
+  Hacl_Streaming_SHA3_update_256(s, (uint8_t *)"a", 1);
+  Hacl_Streaming_SHA3_update_256(s, NULL, 0);
+  Hacl_Streaming_SHA3_update_256(s, (uint8_t *)"bc", 2);
+  Hacl_Streaming_SHA3_finish_256(s, out);
+  printf("Streaming SHA3-256, \"abc\":\n");
+  ok = compare_and_print(32, out, sha3_256_abc) && ok;
+  Hacl_Streaming_SHA3_free_256(s);
+
+  Hacl_Streaming_SHA3_state_shake128 *x = Hacl_Streaming_SHA3_create_in_shake128();
+  Hacl_Streaming_SHA3_squeeze_shake128(x, out, 5);
+  Hacl_Streaming_SHA3_squeeze_shake128(x, out + 5, 27);
+  printf("Streaming SHAKE128, empty input:\n");
+  ok = compare_and_print(32, out, shake128_empty) && ok;
+  Hacl_Streaming_SHA3_free_shake128(x);
+  return ok;
+}
+
+// Every chunking of every prefix length must agree with the one-shot hash, and
+// finish must leave the state usable for more input.
+bool check_sha3(sha3_instance *h) {
+  uint8_t out[64], expected[64];
+  bool ok = true;
+  Hacl_Streaming_SHA3_state_sha3_224 *s = h->create_in();
+  for (size_t k = 0; k < sizeof(chunks) / sizeof(chunks[0]); k++) {
+    for (uint32_t len = 0; len <= MSG_LEN; len += 53) {
+      h->init(s);
+      for (uint32_t i = 0; i < len; i += chunks[k]) {
+        uint32_t n = len - i < chunks[k] ? len - i : chunks[k];
+        h->update(s, msg + i, n);
+        if (i == 0 && n < len) {
+          h->finish(s, out);
+          h->hash(n, msg, expected);
+          ok = ok && memcmp(out, expected, h->hash_len) == 0;
+        }
+      }
+      h->finish(s, out);
+      h->hash(len, msg, expected);
+      ok = ok && memcmp(out, expected, h->hash_len) == 0;
+    }
+  }
+  h->free(s);
+  printf("Streaming %s against one-shot: %s\n", h->name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Squeezing in pieces must produce the prefix of one long squeeze; input given
+// after squeezing started is ignored.
+bool check_shake(shake_instance *h) {
+  uint8_t out[XOF_LEN], expected[XOF_LEN];
+  bool ok = true;
+  Hacl_Streaming_SHA3_state_shake128 *s = h->create_in();
+  for (size_t k = 0; k < sizeof(chunks) / sizeof(chunks[0]); k++) {
+    for (uint32_t len = 0; len <= MSG_LEN; len += 211) {
+      h->init(s);
+      for (uint32_t i = 0; i < len; i += chunks[k]) {
+        uint32_t n = len - i < chunks[k] ? len - i : chunks[k];
+        h->update(s, msg + i, n);
+      }
+      uint32_t step = chunks[sizeof(chunks) / sizeof(chunks[0]) - 1 - k];
+      for (uint32_t i = 0; i < XOF_LEN; i += step) {
+        uint32_t n = XOF_LEN - i < step ? XOF_LEN - i : step;
+        h->squeeze(s, out + i, n);
+        h->update(s, msg, 1);
+      }
+      h->hash(len, msg, XOF_LEN, expected);
+      ok = ok && memcmp(out, expected, XOF_LEN) == 0;
+    }
+  }
+  h->free(s);
+  printf("Streaming %s squeeze against one-shot: %s\n", h->name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+bool check_evercrypt(sha3_instance *h) {
+  uint8_t out[64], expected[64];
+  uint8_t *dsts[5], *inputs[5];
+  uint32_t lens[5];
+  uint8_t outs[5][64];
+  bool ok = true;
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s =
+    EverCrypt_Hash_Incremental_create_in(h->alg);
+  ok = ok && EverCrypt_Hash_Incremental_hash_len(h->alg) == h->hash_len;
+  for (size_t k = 0; k < sizeof(chunks) / sizeof(chunks[0]); k++) {
+    uint32_t len = MSG_LEN - (uint32_t)k * 37;
+    EverCrypt_Hash_Incremental_init(s);
+    for (uint32_t i = 0; i < len; i += chunks[k]) {
+      uint32_t n = len - i < chunks[k] ? len - i : chunks[k];
+      EverCrypt_Hash_Incremental_update(s, msg + i, n);
+    }
+    EverCrypt_Hash_Incremental_finish(s, out);
+    h->hash(len, msg, expected);
+    ok = ok && memcmp(out, expected, h->hash_len) == 0;
+    EverCrypt_Hash_hash(h->alg, out, msg, len);
+    ok = ok && memcmp(out, expected, h->hash_len) == 0;
+  }
+  EverCrypt_Hash_Incremental_free(s);
+
+  for (int i = 0; i < 5; i++) {
+    dsts[i] = outs[i];
+    inputs[i] = msg + i;
+    lens[i] = (uint32_t)i * 150;
+  }
+  EverCrypt_Hash_hash_multi(h->alg, 5, dsts, inputs, lens);
+  for (int i = 0; i < 5; i++) {
+    h->hash(lens[i], inputs[i], expected);
+    ok = ok && memcmp(outs[i], expected, h->hash_len) == 0;
+  }
+  printf("EverCrypt_Hash %s against one-shot: %s\n", h->name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (uint32_t i = 0; i < MSG_LEN; i++) msg[i] = (uint8_t)(i * 13 + 5);
+
+  sha3_instance hs[] = {
+    { "SHA3-224", 28, Spec_Hash_Definitions_SHA3_224, Hacl_Streaming_SHA3_create_in_224,
+      Hacl_Streaming_SHA3_init_224, Hacl_Streaming_SHA3_update_224,
+      Hacl_Streaming_SHA3_finish_224, Hacl_Streaming_SHA3_free_224, Hacl_SHA3_sha3_224 },
+    { "SHA3-256", 32, Spec_Hash_Definitions_SHA3_256, Hacl_Streaming_SHA3_create_in_256,
+      Hacl_Streaming_SHA3_init_256, Hacl_Streaming_SHA3_update_256,
+      Hacl_Streaming_SHA3_finish_256, Hacl_Streaming_SHA3_free_256, Hacl_SHA3_sha3_256 },
+    { "SHA3-384", 48, Spec_Hash_Definitions_SHA3_384, Hacl_Streaming_SHA3_create_in_384,
+      Hacl_Streaming_SHA3_init_384, Hacl_Streaming_SHA3_update_384,
+      Hacl_Streaming_SHA3_finish_384, Hacl_Streaming_SHA3_free_384, Hacl_SHA3_sha3_384 },
+    { "SHA3-512", 64, Spec_Hash_Definitions_SHA3_512, Hacl_Streaming_SHA3_create_in_512,
+      Hacl_Streaming_SHA3_init_512, Hacl_Streaming_SHA3_update_512,
+      Hacl_Streaming_SHA3_finish_512, Hacl_Streaming_SHA3_free_512, Hacl_SHA3_sha3_512 },
+  };
+  shake_instance xs[] = {
+    { "SHAKE128", Hacl_Streaming_SHA3_create_in_shake128, Hacl_Streaming_SHA3_init_shake128,
+      Hacl_Streaming_SHA3_update_shake128, Hacl_Streaming_SHA3_squeeze_shake128,
+      Hacl_Streaming_SHA3_free_shake128, Hacl_SHA3_shake128_hacl },
+    { "SHAKE256", Hacl_Streaming_SHA3_create_in_shake256, Hacl_Streaming_SHA3_init_shake256,
+      Hacl_Streaming_SHA3_update_shake256, Hacl_Streaming_SHA3_squeeze_shake256,
+      Hacl_Streaming_SHA3_free_shake256, Hacl_SHA3_shake256_hacl },
+  };
+
+  bool ok = check_kat();
+  for (size_t i = 0; i < sizeof(hs) / sizeof(hs[0]); i++) {
+    ok = check_sha3(&hs[i]) && ok;
+    ok = check_evercrypt(&hs[i]) && ok;
+  }
+  for (size_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++)
+    ok = check_shake(&xs[i]) && ok;
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}